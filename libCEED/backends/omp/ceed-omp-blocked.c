@@ -0,0 +1,56 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ceed-omp.h"
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Omp(Ceed ceed) {
+  Ceed_Omp *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  CeedCallBackend(CeedFree(&data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Omp_Blocked(const char *resource, Ceed ceed) {
+  Ceed      ceed_opt;
+  Ceed_Omp *data;
+
+  CeedCheck(!strcmp(resource, "/cpu/self/omp") || !strcmp(resource, "/cpu/self/omp/blocked"), ceed, CEED_ERROR_BACKEND,
+            "OpenMP backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedSetDeterministic(ceed, true));
+
+  // Create optimized Ceed that implementation will be dispatched through unless overridden
+  CeedCallBackend(CeedInit("/cpu/self/opt/blocked", &ceed_opt));
+  CeedCallBackend(CeedSetDelegate(ceed, ceed_opt));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Omp));
+
+  // Set block size
+  CeedCallBackend(CeedCalloc(1, &data));
+  data->block_size = 8;
+  CeedCallBackend(CeedSetData(ceed, data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Omp_Blocked(void) { return CeedRegister("/cpu/self/omp/blocked", CeedInit_Omp_Blocked, 45); }
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,1030 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ceed-omp.h"
+
+// The element blocks of an operator are partitioned statically across the OpenMP threads.
+// Each thread owns its block E-vectors and Q-vectors and calls the user QFunction directly, so that the QFunction, CeedBasis, and
+// CeedElemRestriction objects are only read concurrently.
+// Output L-vectors written through strided restrictions receive disjoint entries from each block and are written in place by all threads.
+// Other output L-vectors are written in place by the first thread and accumulated privately by the others, followed by a parallel reduction.
+// The reduction adds the private accumulators in thread order, so repeated applications with the same number of threads give identical results,
+// but the element blocks summed by each thread, and hence the rounding, depend on the number of threads.
+
+//------------------------------------------------------------------------------
+// Setup Input/Output Fields
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFields_Omp(CeedQFunction qf, CeedOperator op, bool is_input, const CeedInt block_size, CeedElemRestriction *block_rstr,
+                                       CeedVector *e_vecs_full, CeedInt start_e, CeedInt num_fields) {
+  CeedQFunctionField *qf_fields;
+  CeedOperatorField  *op_fields;
+
+  if (is_input) {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, &op_fields, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_fields, NULL, NULL));
+  } else {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, NULL, NULL, &qf_fields));
+  }
+
+  // Loop over fields
+  for (CeedInt i = 0; i < num_fields; i++) {
+    CeedEvalMode eval_mode;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
+    if (eval_mode != CEED_EVAL_WEIGHT) {
+      Ceed                ceed_rstr;
+      CeedSize            l_size;
+      CeedInt             num_elem, elem_size, num_comp, comp_stride;
+      CeedRestrictionType rstr_type;
+      CeedElemRestriction rstr;
+
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &rstr));
+      CeedCallBackend(CeedElemRestrictionGetCeed(rstr, &ceed_rstr));
+      CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+      CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+
+      CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+      switch (rstr_type) {
+        case CEED_RESTRICTION_STANDARD: {
+          const CeedInt *offsets = NULL;
+
+          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                           CEED_COPY_VALUES, offsets, &block_rstr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+        } break;
+        case CEED_RESTRICTION_ORIENTED: {
+          const bool    *orients = NULL;
+          const CeedInt *offsets = NULL;
+
+          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionGetOrientations(rstr, CEED_MEM_HOST, &orients));
+          CeedCallBackend(CeedElemRestrictionCreateBlockedOriented(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                                                   CEED_MEM_HOST, CEED_COPY_VALUES, offsets, orients, &block_rstr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+          CeedCallBackend(CeedElemRestrictionRestoreOrientations(rstr, &orients));
+        } break;
+        case CEED_RESTRICTION_CURL_ORIENTED: {
+          const CeedInt8 *curl_orients = NULL;
+          const CeedInt  *offsets      = NULL;
+
+          CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionGetCurlOrientations(rstr, CEED_MEM_HOST, &curl_orients));
+          CeedCallBackend(CeedElemRestrictionCreateBlockedCurlOriented(ceed_rstr, num_elem, elem_size, block_size, num_comp, comp_stride, l_size,
+                                                                       CEED_MEM_HOST, CEED_COPY_VALUES, offsets, curl_orients,
+                                                                       &block_rstr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+          CeedCallBackend(CeedElemRestrictionRestoreCurlOrientations(rstr, &curl_orients));
+        } break;
+        case CEED_RESTRICTION_STRIDED: {
+          CeedInt strides[3];
+
+          CeedCallBackend(CeedElemRestrictionGetStrides(rstr, &strides));
+          CeedCallBackend(CeedElemRestrictionCreateBlockedStrided(ceed_rstr, num_elem, elem_size, block_size, num_comp, l_size, strides,
+                                                                  &block_rstr[i + start_e]));
+        } break;
+        case CEED_RESTRICTION_POINTS:
+          // Empty case - won't occur
+          break;
+      }
+      CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input/Output Fields for One Thread
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupThreadFields_Omp(CeedQFunction qf, CeedOperator op, bool is_input, const CeedInt block_size, CeedVector *e_vecs,
+                                             CeedVector *q_vecs, CeedInt num_fields, CeedInt Q) {
+  Ceed                ceed;
+  CeedSize            e_size, q_size;
+  CeedInt             num_comp, size, P;
+  CeedQFunctionField *qf_fields;
+  CeedOperatorField  *op_fields;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  if (is_input) {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, &op_fields, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_fields, NULL, NULL));
+  } else {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, NULL, NULL, &qf_fields));
+  }
+
+  // Loop over fields
+  for (CeedInt i = 0; i < num_fields; i++) {
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
+    CeedBasis    basis;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
+        e_size = (CeedSize)Q * size * block_size;
+        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
+        q_size = (CeedSize)Q * size * block_size;
+        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
+        CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
+        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+        e_size = (CeedSize)P * num_comp * block_size;
+        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
+        q_size = (CeedSize)Q * size * block_size;
+        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        break;
+      case CEED_EVAL_WEIGHT:  // Only on input fields
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        q_size = (CeedSize)Q * block_size;
+        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_vecs[i]));
+        break;
+    }
+    if (is_input && e_vecs[i]) {
+      CeedCallBackend(CeedVectorSetArray(e_vecs[i], CEED_MEM_HOST, CEED_COPY_VALUES, NULL));
+      // Active inputs without basis action are restricted directly into the Q-vector
+      CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec));
+      if (eval_mode == CEED_EVAL_NONE && vec == CEED_VECTOR_ACTIVE) {
+        CeedScalar *e_array;
+
+        CeedCallBackend(CeedVectorGetArray(e_vecs[i], CEED_MEM_HOST, &e_array));
+        CeedCallBackend(CeedVectorSetArray(q_vecs[i], CEED_MEM_HOST, CEED_USE_POINTER, e_array));
+        CeedCallBackend(CeedVectorRestoreArray(e_vecs[i], &e_array));
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Omp(CeedOperator op) {
+  bool                is_setup_done;
+  Ceed                ceed;
+  Ceed_Omp           *ceed_impl;
+  CeedInt             Q, num_input_fields, num_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Omp   *impl;
+
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  const CeedInt block_size  = ceed_impl->block_size;
+  const CeedInt num_threads = omp_get_max_threads();
+
+  // Allocate
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
+
+  impl->num_inputs  = num_input_fields;
+  impl->num_outputs = num_output_fields;
+
+  // Set up blocked restrictions and full E-vectors
+  // Infields
+  CeedCallBackend(CeedOperatorSetupFields_Omp(qf, op, true, block_size, impl->block_rstr, impl->e_vecs_full, 0, num_input_fields));
+  // Outfields
+  CeedCallBackend(CeedOperatorSetupFields_Omp(qf, op, false, block_size, impl->block_rstr, impl->e_vecs_full, num_input_fields, num_output_fields));
+
+  // Active input L-vector
+  impl->l_size_in = -1;
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector          vec;
+    CeedElemRestriction rstr;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &impl->l_size_in));
+      break;
+    }
+  }
+
+  // Output L-vectors, fields writing to the same vector share a target
+  CeedCallBackend(CeedCalloc(num_output_fields, &impl->output_targets));
+  CeedCallBackend(CeedCalloc(num_output_fields, &impl->target_sizes));
+  CeedCallBackend(CeedCalloc(num_output_fields, &impl->is_target_strided));
+  CeedCallBackend(CeedCalloc(num_output_fields, &impl->target_arrays));
+  impl->num_targets = 0;
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedInt             target = -1;
+    CeedVector          vec;
+    CeedRestrictionType rstr_type;
+    CeedElemRestriction rstr;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+    CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+    for (CeedInt j = 0; j < i; j++) {
+      CeedVector vec_j;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[j], &vec_j));
+      if (vec_j == vec) {
+        target = impl->output_targets[j];
+        break;
+      }
+    }
+    if (target < 0) {
+      target = impl->num_targets++;
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &impl->target_sizes[target]));
+      impl->is_target_strided[target] = true;
+    }
+    impl->is_target_strided[target] = impl->is_target_strided[target] && rstr_type == CEED_RESTRICTION_STRIDED;
+    impl->output_targets[i]         = target;
+  }
+
+  // Identity QFunctions
+  if (impl->is_identity_qf) {
+    CeedEvalMode in_mode, out_mode;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[0], &in_mode));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[0], &out_mode));
+    impl->is_identity_rstr_op = in_mode == CEED_EVAL_NONE && out_mode == CEED_EVAL_NONE;
+  }
+
+  // Per thread work vectors
+  impl->num_threads = num_threads;
+  CeedCallBackend(CeedCalloc(num_threads, &impl->threads));
+  CeedCallBackend(CeedCalloc(num_threads * impl->num_targets, &impl->accum_arrays));
+  for (CeedInt t = 0; t < num_threads; t++) {
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &thread->e_vecs_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &thread->e_vecs_out));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &thread->q_vecs_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &thread->q_vecs_out));
+    CeedCallBackend(
+        CeedOperatorSetupThreadFields_Omp(qf, op, true, block_size, thread->e_vecs_in, thread->q_vecs_in, num_input_fields, Q));
+    CeedCallBackend(
+        CeedOperatorSetupThreadFields_Omp(qf, op, false, block_size, thread->e_vecs_out, thread->q_vecs_out, num_output_fields, Q));
+    if (impl->is_identity_qf && !impl->is_identity_rstr_op) {
+      CeedCallBackend(CeedVectorReferenceCopy(thread->q_vecs_in[0], &thread->q_vecs_out[0]));
+    }
+
+    // L-vectors
+    if (impl->l_size_in >= 0) CeedCallBackend(CeedVectorCreate(ceed, impl->l_size_in, &thread->l_vec_in));
+    CeedCallBackend(CeedCalloc(impl->num_targets, &thread->l_vecs_out));
+    for (CeedInt k = 0; k < impl->num_targets; k++) {
+      CeedCallBackend(CeedVectorCreate(ceed, impl->target_sizes[k], &thread->l_vecs_out[k]));
+    }
+  }
+
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input Fields
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupInputs_Omp(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                              CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Omp *impl, CeedRequest *request) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    uint64_t     state;
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE) {
+      // Restrict
+      CeedCallBackend(CeedVectorGetState(vec, &state));
+      if (state != impl->input_states[i]) {
+        CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        impl->input_states[i] = state;
+      }
+      // Get evec
+      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Input Basis Action
+//------------------------------------------------------------------------------
+static inline int CeedOperatorInputBasis_Omp(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                             CeedInt num_input_fields, CeedInt block_size, bool skip_active, CeedScalar *e_data[2 * CEED_FIELD_MAX],
+                                             CeedOperator_Omp *impl, CeedOperatorThread_Omp *thread) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    bool                is_active_input = false;
+    CeedInt             elem_size, size, num_comp;
+    CeedEvalMode        eval_mode;
+    CeedVector          vec;
+    CeedElemRestriction elem_rstr;
+    CeedBasis           basis;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    // Skip active input
+    is_active_input = vec == CEED_VECTOR_ACTIVE;
+    if (skip_active && is_active_input) continue;
+
+    // Get elem_size, eval_mode, size
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
+    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    // Restrict block active input
+    if (is_active_input) {
+      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, thread->l_vec_in, thread->e_vecs_in[i],
+                                                    CEED_REQUEST_IMMEDIATE));
+    }
+    // Basis action
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        if (!is_active_input) {
+          CeedCallBackend(CeedVectorSetArray(thread->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][e * Q * size]));
+        }
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
+        if (!is_active_input) {
+          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+          CeedCallBackend(CeedVectorSetArray(thread->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][e * elem_size * num_comp]));
+        }
+        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, eval_mode, thread->e_vecs_in[i], thread->q_vecs_in[i]));
+        break;
+      case CEED_EVAL_WEIGHT:
+        break;  // No action
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Action
+//------------------------------------------------------------------------------
+static inline int CeedOperatorQFunction_Omp(CeedQFunctionUser f, void *ctx_data, CeedInt Q, CeedInt num_input_fields, CeedInt num_output_fields,
+                                            CeedOperatorThread_Omp *thread) {
+  const CeedScalar *inputs[CEED_FIELD_MAX];
+  CeedScalar       *outputs[CEED_FIELD_MAX];
+
+  // The user function is called directly, the backend QFunction apply keeps its field arrays in the shared CeedQFunction
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedVectorGetArrayRead(thread->q_vecs_in[i], CEED_MEM_HOST, &inputs[i]));
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedVectorGetArrayWrite(thread->q_vecs_out[i], CEED_MEM_HOST, &outputs[i]));
+  }
+  CeedCallBackend(f(ctx_data, Q, inputs, outputs));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedVectorRestoreArrayRead(thread->q_vecs_in[i], &inputs[i]));
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedVectorRestoreArray(thread->q_vecs_out[i], &outputs[i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Output Basis Action
+//------------------------------------------------------------------------------
+static inline int CeedOperatorOutputBasis_Omp(CeedInt e, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+                                              CeedInt block_size, CeedInt num_output_fields, CeedOperator op, CeedOperator_Omp *impl,
+                                              CeedOperatorThread_Omp *thread) {
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedEvalMode eval_mode;
+    CeedBasis    basis;
+
+    // Get eval_mode
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    // Basis action
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        break;  // No action
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
+        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, thread->q_vecs_out[i], thread->e_vecs_out[i]));
+        break;
+      // LCOV_EXCL_START
+      case CEED_EVAL_WEIGHT: {
+        Ceed ceed;
+        CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+        return CeedError(ceed, CEED_ERROR_BACKEND, "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
+        // LCOV_EXCL_STOP
+      }
+    }
+    // Restrict output block
+    CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i + impl->num_inputs], e / block_size, CEED_TRANSPOSE, thread->e_vecs_out[i],
+                                                  thread->l_vecs_out[impl->output_targets[i]], CEED_REQUEST_IMMEDIATE));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply Operator to One Element Block
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyBlock_Omp(CeedOperator op, CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                      CeedInt num_input_fields, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+                                      CeedInt num_output_fields, CeedInt block_size, CeedQFunctionUser f, void *ctx_data,
+                                      CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Omp *impl, CeedOperatorThread_Omp *thread) {
+  // Restriction only operator
+  if (impl->is_identity_rstr_op) {
+    CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[0], e / block_size, CEED_NOTRANSPOSE, thread->l_vec_in, thread->e_vecs_in[0],
+                                                  CEED_REQUEST_IMMEDIATE));
+    CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[1], e / block_size, CEED_TRANSPOSE, thread->e_vecs_in[0],
+                                                  thread->l_vecs_out[impl->output_targets[0]], CEED_REQUEST_IMMEDIATE));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Input basis apply
+  CeedCallBackend(
+      CeedOperatorInputBasis_Omp(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, false, e_data, impl, thread));
+
+  // Q function
+  if (!impl->is_identity_qf) {
+    CeedCallBackend(CeedOperatorQFunction_Omp(f, ctx_data, Q * block_size, num_input_fields, num_output_fields, thread));
+  }
+
+  // Output basis apply and restriction
+  CeedCallBackend(CeedOperatorOutputBasis_Omp(e, qf_output_fields, op_output_fields, block_size, num_output_fields, op, impl, thread));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Bind Shared Arrays to Thread Vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorThreadBegin_Omp(CeedInt t, CeedQFunctionField *qf_output_fields, CeedInt num_output_fields, const CeedScalar *in_array,
+                                       CeedOperator_Omp *impl, CeedOperatorThread_Omp *thread) {
+  // Active input
+  if (impl->l_size_in >= 0) {
+    CeedCallBackend(CeedVectorSetArray(thread->l_vec_in, CEED_MEM_HOST, CEED_USE_POINTER, (CeedScalar *)in_array));
+  }
+
+  // Output L-vectors, written in place or accumulated privately
+  for (CeedInt k = 0; k < impl->num_targets; k++) {
+    if (t == 0 || impl->is_target_strided[k]) {
+      CeedCallBackend(CeedVectorSetArray(thread->l_vecs_out[k], CEED_MEM_HOST, CEED_USE_POINTER, impl->target_arrays[k]));
+    } else {
+      CeedCallBackend(CeedVectorSetValue(thread->l_vecs_out[k], 0.0));
+    }
+  }
+
+  // Outputs without basis action are restricted directly from the Q-vector
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedEvalMode eval_mode;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    if (eval_mode == CEED_EVAL_NONE) {
+      CeedScalar *e_array;
+
+      CeedCallBackend(CeedVectorGetArrayWrite(thread->e_vecs_out[i], CEED_MEM_HOST, &e_array));
+      CeedCallBackend(CeedVectorSetArray(thread->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_array));
+      CeedCallBackend(CeedVectorRestoreArray(thread->e_vecs_out[i], &e_array));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Publish Private Accumulators
+//------------------------------------------------------------------------------
+static int CeedOperatorThreadGetAccumulators_Omp(CeedInt t, CeedOperator_Omp *impl, CeedOperatorThread_Omp *thread) {
+  for (CeedInt k = 0; k < impl->num_targets; k++) {
+    if (t > 0 && !impl->is_target_strided[k]) {
+      CeedCallBackend(CeedVectorGetArrayRead(thread->l_vecs_out[k], CEED_MEM_HOST, &impl->accum_arrays[t * impl->num_targets + k]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Reduce Private Accumulators, called by all threads of the team
+//------------------------------------------------------------------------------
+static void CeedOperatorReduceOutputs_Omp(CeedInt num_threads, CeedOperator_Omp *impl) {
+  if (num_threads == 1) return;
+  for (CeedInt k = 0; k < impl->num_targets; k++) {
+    if (impl->is_target_strided[k]) continue;
+
+    CeedScalar    *target_array = impl->target_arrays[k];
+    const CeedSize target_size  = impl->target_sizes[k];
+
+#pragma omp for schedule(static)
+    for (CeedSize i = 0; i < target_size; i++) {
+      CeedScalar sum = 0.0;
+
+      for (CeedInt t = 1; t < num_threads; t++) {
+        const CeedScalar *accum_array = impl->accum_arrays[t * impl->num_targets + k];
+
+        if (accum_array) sum += accum_array[i];
+      }
+      target_array[i] += sum;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Release Shared Arrays from Thread Vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorThreadEnd_Omp(CeedInt t, CeedOperator_Omp *impl, CeedOperatorThread_Omp *thread) {
+  if (impl->l_size_in >= 0) {
+    CeedCallBackend(CeedVectorTakeArray(thread->l_vec_in, CEED_MEM_HOST, NULL));
+  }
+  for (CeedInt k = 0; k < impl->num_targets; k++) {
+    if (t == 0 || impl->is_target_strided[k]) {
+      CeedCallBackend(CeedVectorTakeArray(thread->l_vecs_out[k], CEED_MEM_HOST, NULL));
+    } else if (impl->accum_arrays[t * impl->num_targets + k]) {
+      CeedCallBackend(CeedVectorRestoreArrayRead(thread->l_vecs_out[k], &impl->accum_arrays[t * impl->num_targets + k]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Restore Input Vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestoreInputs_Omp(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Omp *impl) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE) {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data[i]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Omp(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  int                 ierr = CEED_ERROR_SUCCESS;
+  Ceed                ceed;
+  Ceed_Omp           *ceed_impl;
+  CeedInt             Q, num_input_fields, num_output_fields, num_elem;
+  void               *ctx_data = NULL;
+  const CeedScalar   *in_array = NULL;
+  CeedScalar         *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedVector          target_vecs[CEED_FIELD_MAX] = {0};
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunctionUser   f = NULL;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Omp   *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  const CeedInt block_size = ceed_impl->block_size;
+  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Omp(op));
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Omp(num_input_fields, qf_input_fields, op_input_fields, e_data, impl, request));
+
+  // Input and output L-vector arrays
+  if (impl->l_size_in >= 0) CeedCallBackend(CeedVectorGetArrayRead(in_vec, CEED_MEM_HOST, &in_array));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    const CeedInt target = impl->output_targets[i];
+
+    if (target_vecs[target]) continue;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &target_vecs[target]));
+    if (target_vecs[target] == CEED_VECTOR_ACTIVE) target_vecs[target] = out_vec;
+    CeedCallBackend(CeedVectorGetArray(target_vecs[target], CEED_MEM_HOST, &impl->target_arrays[target]));
+  }
+
+  // QFunction user function and context
+  if (!impl->is_identity_qf) {
+    CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+    CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+  }
+
+  // Loop through element blocks
+#pragma omp parallel num_threads(impl->num_threads)
+  {
+    const CeedInt           t           = omp_get_thread_num();
+    const CeedInt           num_threads = omp_get_num_threads();
+    CeedOperatorThread_Omp *thread      = &impl->threads[t];
+    int                     ierr_t      = CeedOperatorThreadBegin_Omp(t, qf_output_fields, num_output_fields, in_array, impl, thread);
+
+#pragma omp for schedule(static)
+    for (CeedInt b = 0; b < num_blocks; b++) {
+      if (!ierr_t) {
+        ierr_t = CeedOperatorApplyBlock_Omp(op, b * block_size, Q, qf_input_fields, op_input_fields, num_input_fields, qf_output_fields,
+                                            op_output_fields, num_output_fields, block_size, f, ctx_data, e_data, impl, thread);
+      }
+    }
+
+    // Reduce private accumulators into the output L-vectors
+    for (CeedInt k = 0; k < impl->num_targets; k++) impl->accum_arrays[t * impl->num_targets + k] = NULL;
+    if (!ierr_t) ierr_t = CeedOperatorThreadGetAccumulators_Omp(t, impl, thread);
+#pragma omp barrier
+    CeedOperatorReduceOutputs_Omp(num_threads, impl);
+    if (!ierr_t) ierr_t = CeedOperatorThreadEnd_Omp(t, impl, thread);
+    if (ierr_t) {
+#pragma omp critical
+      ierr = ierr_t;
+    }
+  }
+
+  // Restore arrays
+  if (!impl->is_identity_qf) CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+  for (CeedInt k = 0; k < impl->num_targets; k++) {
+    CeedCallBackend(CeedVectorRestoreArray(target_vecs[k], &impl->target_arrays[k]));
+  }
+  if (impl->l_size_in >= 0) CeedCallBackend(CeedVectorRestoreArrayRead(in_vec, &in_array));
+  CeedCallBackend(CeedOperatorRestoreInputs_Omp(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
+  CeedCallBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble QFunction for One Element Block
+//------------------------------------------------------------------------------
+static int CeedOperatorAssembleQFunctionBlock_Omp(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                  CeedInt num_input_fields, CeedQFunctionField *qf_output_fields,
+                                                  CeedOperatorField *op_output_fields, CeedInt num_output_fields, CeedInt block_size,
+                                                  CeedQFunctionUser f, void *ctx_data, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Omp *impl,
+                                                  CeedOperatorThread_Omp *thread) {
+  CeedInt       size;
+  CeedScalar   *l_vec_array;
+  const CeedInt num_active_in = impl->num_active_in;
+  CeedVector   *active_in     = thread->qf_active_in;
+
+  CeedCallBackend(CeedVectorGetArray(thread->qf_l_vec, CEED_MEM_HOST, &l_vec_array));
+
+  // Input basis apply
+  CeedCallBackend(CeedOperatorInputBasis_Omp(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, true, e_data, impl, thread));
+
+  // Assemble QFunction
+  for (CeedInt in = 0; in < num_active_in; in++) {
+    // Set Inputs
+    CeedCallBackend(CeedVectorSetValue(active_in[in], 1.0));
+    if (num_active_in > 1) {
+      CeedCallBackend(CeedVectorSetValue(active_in[(in + num_active_in - 1) % num_active_in], 0.0));
+    }
+    if (!impl->is_identity_qf) {
+      // Set Outputs
+      for (CeedInt out = 0; out < num_output_fields; out++) {
+        CeedVector vec;
+
+        // Get output vector
+        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+        // Check if active output
+        if (vec == CEED_VECTOR_ACTIVE) {
+          CeedCallBackend(CeedVectorSetArray(thread->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, l_vec_array));
+          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &size));
+          l_vec_array += size * Q * block_size;  // Advance the pointer by the size of the output
+        }
+      }
+      // Apply QFunction
+      CeedCallBackend(CeedOperatorQFunction_Omp(f, ctx_data, Q * block_size, num_input_fields, num_output_fields, thread));
+    } else {
+      const CeedScalar *q_vec_array;
+
+      // Copy Identity Outputs
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &size));
+      CeedCallBackend(CeedVectorGetArrayRead(thread->q_vecs_out[0], CEED_MEM_HOST, &q_vec_array));
+      for (CeedInt i = 0; i < size * Q * block_size; i++) l_vec_array[i] = q_vec_array[i];
+      CeedCallBackend(CeedVectorRestoreArrayRead(thread->q_vecs_out[0], &q_vec_array));
+      l_vec_array += size * Q * block_size;
+    }
+  }
+
+  // Release output Qvecs
+  if (!impl->is_identity_qf) {
+    for (CeedInt out = 0; out < num_output_fields; out++) {
+      CeedVector vec;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedVectorTakeArray(thread->q_vecs_out[out], CEED_MEM_HOST, NULL));
+      }
+    }
+  }
+
+  // Assemble into assembled vector
+  CeedCallBackend(CeedVectorRestoreArray(thread->qf_l_vec, &l_vec_array));
+  CeedCallBackend(
+      CeedElemRestrictionApplyBlock(impl->qf_block_rstr, e / block_size, CEED_TRANSPOSE, thread->qf_l_vec, thread->qf_assembled, CEED_REQUEST_IMMEDIATE));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Reset Thread Output Qvecs after QFunction Assembly
+//------------------------------------------------------------------------------
+static int CeedOperatorAssembleQFunctionThreadEnd_Omp(CeedOperatorField *op_output_fields, CeedInt num_output_fields,
+                                                      CeedOperatorThread_Omp *thread) {
+  // Un-set output Qvecs to prevent accidental overwrite of Assembled
+  for (CeedInt out = 0; out < num_output_fields; out++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedCallBackend(CeedVectorSetArray(thread->q_vecs_out[out], CEED_MEM_HOST, CEED_COPY_VALUES, NULL));
+    }
+  }
+  CeedCallBackend(CeedVectorTakeArray(thread->qf_assembled, CEED_MEM_HOST, NULL));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for linear QFunction assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionCore_Omp(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
+                                                              CeedRequest *request) {
+  int                 ierr = CEED_ERROR_SUCCESS;
+  Ceed                ceed;
+  Ceed_Omp           *ceed_impl;
+  CeedSize            q_size;
+  CeedInt             Q, num_input_fields, num_output_fields, num_elem, size;
+  void               *ctx_data = NULL;
+  CeedScalar         *assembled_array, *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunctionUser   f = NULL;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Omp   *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  const CeedInt block_size = ceed_impl->block_size;
+  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Omp(op));
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Omp(num_input_fields, qf_input_fields, op_input_fields, e_data, impl, request));
+
+  // Count number of active input fields
+  if (!impl->num_active_in) {
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedInt                 num_active_in = 0;
+      CeedOperatorThread_Omp *thread        = &impl->threads[t];
+
+      for (CeedInt i = 0; i < num_input_fields; i++) {
+        CeedScalar *q_vec_array;
+        CeedVector  vec;
+
+        // Get input vector
+        CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+        // Check if active input
+        if (vec == CEED_VECTOR_ACTIVE) {
+          CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+          CeedCallBackend(CeedVectorSetValue(thread->q_vecs_in[i], 0.0));
+          CeedCallBackend(CeedVectorGetArray(thread->q_vecs_in[i], CEED_MEM_HOST, &q_vec_array));
+          CeedCallBackend(CeedRealloc(num_active_in + size, &thread->qf_active_in));
+          for (CeedInt field = 0; field < size; field++) {
+            q_size = (CeedSize)Q * block_size;
+            CeedCallBackend(CeedVectorCreate(ceed, q_size, &thread->qf_active_in[num_active_in + field]));
+            CeedCallBackend(CeedVectorSetArray(thread->qf_active_in[num_active_in + field], CEED_MEM_HOST, CEED_USE_POINTER,
+                                               &q_vec_array[field * Q * block_size]));
+          }
+          num_active_in += size;
+          CeedCallBackend(CeedVectorRestoreArray(thread->q_vecs_in[i], &q_vec_array));
+        }
+      }
+      impl->num_active_in = num_active_in;
+    }
+  }
+
+  // Count number of active output fields
+  if (!impl->num_active_out) {
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedVector vec;
+
+      // Get output vector
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+      // Check if active output
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+        impl->num_active_out += size;
+      }
+    }
+  }
+  const CeedInt num_active_in = impl->num_active_in, num_active_out = impl->num_active_out;
+
+  // Check sizes
+  CeedCheck(num_active_in > 0 && num_active_out > 0, ceed, CEED_ERROR_BACKEND, "Cannot assemble QFunction without active inputs and outputs");
+
+  // Setup l_vec and assembled views
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+
+    if (!thread->qf_l_vec) {
+      const CeedSize l_size = (CeedSize)block_size * Q * num_active_in * num_active_out;
+
+      CeedCallBackend(CeedVectorCreate(ceed, l_size, &thread->qf_l_vec));
+      CeedCallBackend(CeedVectorSetValue(thread->qf_l_vec, 0.0));
+    }
+    if (!thread->qf_assembled) {
+      const CeedSize l_size = (CeedSize)num_elem * Q * num_active_in * num_active_out;
+
+      CeedCallBackend(CeedVectorCreate(ceed, l_size, &thread->qf_assembled));
+    }
+  }
+
+  // Output blocked restriction
+  if (!impl->qf_block_rstr) {
+    CeedInt strides[3] = {1, Q, num_active_in * num_active_out * Q};
+
+    CeedCallBackend(CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, Q, block_size, num_active_in * num_active_out,
+                                                            num_active_in * num_active_out * num_elem * Q, strides, &impl->qf_block_rstr));
+  }
+
+  // Build objects if needed
+  if (build_objects) {
+    const CeedSize l_size     = (CeedSize)num_elem * Q * num_active_in * num_active_out;
+    CeedInt        strides[3] = {1, Q, num_active_in * num_active_out * Q};
+
+    // Create output restriction
+    CeedCallBackend(CeedElemRestrictionCreateStrided(ceed, num_elem, Q, num_active_in * num_active_out, num_active_in * num_active_out * num_elem * Q,
+                                                     strides, rstr));
+    // Create assembled vector
+    CeedCallBackend(CeedVectorCreate(ceed, l_size, assembled));
+  }
+
+  // QFunction user function and context
+  if (!impl->is_identity_qf) {
+    CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+    CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+  }
+
+  // Loop through element blocks, each block writes its own strided entries of the assembled vector
+  CeedCallBackend(CeedVectorSetValue(*assembled, 0.0));
+  CeedCallBackend(CeedVectorGetArray(*assembled, CEED_MEM_HOST, &assembled_array));
+#pragma omp parallel num_threads(impl->num_threads)
+  {
+    const CeedInt           t      = omp_get_thread_num();
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+    int                     ierr_t = CeedVectorSetArray(thread->qf_assembled, CEED_MEM_HOST, CEED_USE_POINTER, assembled_array);
+
+#pragma omp for schedule(static)
+    for (CeedInt b = 0; b < num_blocks; b++) {
+      if (!ierr_t) {
+        ierr_t = CeedOperatorAssembleQFunctionBlock_Omp(b * block_size, Q, qf_input_fields, op_input_fields, num_input_fields, qf_output_fields,
+                                                        op_output_fields, num_output_fields, block_size, f, ctx_data, e_data, impl, thread);
+      }
+    }
+    if (!ierr_t) ierr_t = CeedOperatorAssembleQFunctionThreadEnd_Omp(op_output_fields, num_output_fields, thread);
+    if (ierr_t) {
+#pragma omp critical
+      ierr = ierr_t;
+    }
+  }
+
+  // Restore arrays
+  CeedCallBackend(CeedVectorRestoreArray(*assembled, &assembled_array));
+  if (!impl->is_identity_qf) CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+  CeedCallBackend(CeedOperatorRestoreInputs_Omp(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
+  CeedCallBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Omp(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Omp(op, true, assembled, rstr, request);
+}
+
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionUpdate_Omp(CeedOperator op, CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Omp(op, false, &assembled, &rstr, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Omp(CeedOperator op) {
+  CeedOperator_Omp *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->block_rstr[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->block_rstr));
+  CeedCallBackend(CeedFree(&impl->e_vecs_full));
+  CeedCallBackend(CeedFree(&impl->input_states));
+  CeedCallBackend(CeedFree(&impl->output_targets));
+  CeedCallBackend(CeedFree(&impl->target_sizes));
+  CeedCallBackend(CeedFree(&impl->is_target_strided));
+  CeedCallBackend(CeedFree(&impl->target_arrays));
+  CeedCallBackend(CeedFree(&impl->accum_arrays));
+
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&thread->e_vecs_in[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->q_vecs_in[i]));
+    }
+    CeedCallBackend(CeedFree(&thread->e_vecs_in));
+    CeedCallBackend(CeedFree(&thread->q_vecs_in));
+
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&thread->e_vecs_out[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->q_vecs_out[i]));
+    }
+    CeedCallBackend(CeedFree(&thread->e_vecs_out));
+    CeedCallBackend(CeedFree(&thread->q_vecs_out));
+
+    CeedCallBackend(CeedVectorDestroy(&thread->l_vec_in));
+    for (CeedInt k = 0; k < impl->num_targets; k++) {
+      CeedCallBackend(CeedVectorDestroy(&thread->l_vecs_out[k]));
+    }
+    CeedCallBackend(CeedFree(&thread->l_vecs_out));
+
+    // QFunction assembly data
+    for (CeedInt i = 0; i < impl->num_active_in; i++) {
+      CeedCallBackend(CeedVectorDestroy(&thread->qf_active_in[i]));
+    }
+    CeedCallBackend(CeedFree(&thread->qf_active_in));
+    CeedCallBackend(CeedVectorDestroy(&thread->qf_l_vec));
+    CeedCallBackend(CeedVectorDestroy(&thread->qf_assembled));
+  }
+  CeedCallBackend(CeedFree(&impl->threads));
+  CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
+
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Omp(CeedOperator op) {
+  Ceed              ceed;
+  Ceed_Omp         *ceed_impl;
+  CeedOperator_Omp *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  const CeedInt block_size = ceed_impl->block_size;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+
+  CeedCheck(block_size == 1 || block_size == 8, ceed, CEED_ERROR_BACKEND, "OpenMP backend cannot use blocksize: %" CeedInt_FMT, block_size);
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Omp));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
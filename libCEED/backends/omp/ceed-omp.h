@@ -0,0 +1,53 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#ifndef CEED_OMP_H
+#define CEED_OMP_H
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  CeedInt block_size;
+} Ceed_Omp;
+
+typedef struct {
+  CeedVector *e_vecs_in;    /* Element block input E-vectors  */
+  CeedVector *e_vecs_out;   /* Element block output E-vectors */
+  CeedVector *q_vecs_in;    /* Element block input Q-vectors  */
+  CeedVector *q_vecs_out;   /* Element block output Q-vectors */
+  CeedVector  l_vec_in;     /* View of the active input L-vector */
+  CeedVector *l_vecs_out;   /* Output L-vectors, either views of the shared arrays or private accumulators */
+  CeedVector *qf_active_in; /* Active input Q-vector components for QFunction assembly */
+  CeedVector  qf_l_vec;     /* Element block assembled QFunction */
+  CeedVector  qf_assembled; /* View of the assembled QFunction */
+} CeedOperatorThread_Omp;
+
+typedef struct {
+  bool                    is_identity_qf, is_identity_rstr_op;
+  CeedElemRestriction    *block_rstr;   /* Blocked versions of restrictions */
+  CeedVector             *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
+  uint64_t               *input_states; /* State counter of inputs */
+  CeedInt                 num_inputs, num_outputs;
+  CeedSize                l_size_in;         /* Length of the active input L-vector, or -1 if there is no active input */
+  CeedInt                 num_targets;       /* Number of distinct output L-vectors */
+  CeedInt                *output_targets;    /* Output L-vector of each output field */
+  CeedSize               *target_sizes;      /* Length of each output L-vector */
+  bool                   *is_target_strided; /* Blocks write disjoint entries of the output L-vector */
+  CeedScalar            **target_arrays;     /* Host arrays of the output L-vectors during apply */
+  const CeedScalar      **accum_arrays;      /* Host arrays of the private accumulators during apply */
+  CeedInt                 num_active_in, num_active_out;
+  CeedElemRestriction     qf_block_rstr;
+  CeedInt                 num_threads;
+  CeedOperatorThread_Omp *threads;
+} CeedOperator_Omp;
+
+CEED_INTERN int CeedOperatorCreate_Omp(CeedOperator op);
+
+#endif  // CEED_OMP_H
@@ -282,36 +282,50 @@ static inline int CeedSingleOperatorAssembleAddDiagonal_Core(CeedOperator op, Ce
       for (CeedInt i = 0; i < (num_nodes < num_qpts ? num_nodes : num_qpts); i++) identity[i * num_nodes + i] = 1.0;
     }
 
-    // Compute the diagonal of B^T D B
-    // Each element
-    for (CeedSize e = 0; e < num_elem; e++) {
-      // Each basis eval mode pair
-      CeedInt      d_out              = 0, q_comp_out;
+    // Basis matrices for each active evaluation mode
+    const CeedScalar **B_in, **B_t_out;
+
+    CeedCall(CeedCalloc(num_eval_modes_in[b_in], &B_in));
+    CeedCall(CeedCalloc(num_eval_modes_out[b_out], &B_t_out));
+    {
+      CeedInt      d_out = 0, q_comp_out;
       CeedEvalMode eval_mode_out_prev = CEED_EVAL_NONE;
 
       for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
-        CeedInt           d_in              = 0, q_comp_in;
-        const CeedScalar *B_t               = NULL;
-        CeedEvalMode      eval_mode_in_prev = CEED_EVAL_NONE;
-
-        CeedCall(CeedOperatorGetBasisPointer(active_bases_out[b_out], eval_modes_out[b_out][e_out], identity, &B_t));
+        CeedCall(CeedOperatorGetBasisPointer(active_bases_out[b_out], eval_modes_out[b_out][e_out], identity, &B_t_out[e_out]));
         CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_out[b_out], eval_modes_out[b_out][e_out], &q_comp_out));
         if (q_comp_out > 1) {
           if (e_out == 0 || eval_modes_out[b_out][e_out] != eval_mode_out_prev) d_out = 0;
-          else B_t = &B_t[(++d_out) * num_qpts * num_nodes];
+          else B_t_out[e_out] = &B_t_out[e_out][(++d_out) * num_qpts * num_nodes];
         }
         eval_mode_out_prev = eval_modes_out[b_out][e_out];
+      }
+    }
+    {
+      CeedInt      d_in = 0, q_comp_in;
+      CeedEvalMode eval_mode_in_prev = CEED_EVAL_NONE;
+
+      for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
+        CeedCall(CeedOperatorGetBasisPointer(active_bases_in[b_in], eval_modes_in[b_in][e_in], identity, &B_in[e_in]));
+        CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_in[b_in], eval_modes_in[b_in][e_in], &q_comp_in));
+        if (q_comp_in > 1) {
+          if (e_in == 0 || eval_modes_in[b_in][e_in] != eval_mode_in_prev) d_in = 0;
+          else B_in[e_in] = &B_in[e_in][(++d_in) * num_qpts * num_nodes];
+        }
+        eval_mode_in_prev = eval_modes_in[b_in][e_in];
+      }
+    }
 
-        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
-          const CeedScalar *B = NULL;
+    // Compute the diagonal of B^T D B
+    // Each element, elements are independent and are distributed across threads when built with OpenMP
+    CeedPragmaOMP(parallel for schedule(static))
+    for (CeedSize e = 0; e < num_elem; e++) {
+      // Each basis eval mode pair
+      for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
+        const CeedScalar *B_t = B_t_out[e_out];
 
-          CeedCall(CeedOperatorGetBasisPointer(active_bases_in[b_in], eval_modes_in[b_in][e_in], identity, &B));
-          CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_in[b_in], eval_modes_in[b_in][e_in], &q_comp_in));
-          if (q_comp_in > 1) {
-            if (e_in == 0 || eval_modes_in[b_in][e_in] != eval_mode_in_prev) d_in = 0;
-            else B = &B[(++d_in) * num_qpts * num_nodes];
-          }
-          eval_mode_in_prev = eval_modes_in[b_in][e_in];
+        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
+          const CeedScalar *B = B_in[e_in];
 
           // Each component
           for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
@@ -352,6 +366,8 @@ static inline int CeedSingleOperatorAssembleAddDiagonal_Core(CeedOperator op, Ce
     // Cleanup
     CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstr));
     CeedCall(CeedVectorDestroy(&elem_diag));
+    CeedCall(CeedFree(&B_in));
+    CeedCall(CeedFree(&B_t_out));
     CeedCall(CeedFree(&identity));
   }
   CeedCall(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
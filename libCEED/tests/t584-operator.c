@@ -0,0 +1,137 @@
+/// @file
+/// Test action of mass matrix operator with many element blocks against the reference backend
+/// \test Test action of mass matrix operator with many element blocks against the reference backend
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+// Apply the mass operator on num_elem elements with the given Ceed, twice, the second time with CeedOperatorApplyAdd
+static void ApplyMass(Ceed ceed, CeedInt num_elem, CeedInt p, CeedInt q, const CeedScalar *u_array, CeedScalar *v_array) {
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt            *ind_x = malloc(num_elem * 2 * sizeof(CeedInt)), *ind_u = malloc(num_elem * p * sizeof(CeedInt));
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar *x_array;
+
+    CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1) + 0.1 * sin(i);
+    CeedVectorRestoreArray(x, &x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, (CeedScalar *)u_array);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_COPY_VALUES, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *v_read;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_read);
+    for (CeedInt i = 0; i < num_nodes_u; i++) v_array[i] = v_read[i];
+    CeedVectorRestoreArrayRead(v, &v_read);
+  }
+
+  free(ind_x);
+  free(ind_u);
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed, ceed_ref;
+  // Enough elements for several element blocks, with a partial last block, so that threaded backends split the work
+  CeedInt num_elem = 203, p = 4, q = 6;
+  CeedInt num_nodes_u = num_elem * (p - 1) + 1;
+
+  CeedInit(argv[1], &ceed);
+  CeedInit("/cpu/self/ref/serial", &ceed_ref);
+
+  CeedScalar *u_array = malloc(num_nodes_u * sizeof(CeedScalar));
+  CeedScalar *v_array = malloc(num_nodes_u * sizeof(CeedScalar));
+  CeedScalar *v_ref_array = malloc(num_nodes_u * sizeof(CeedScalar));
+
+  for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = 1.0 + cos(0.3 * i);
+  ApplyMass(ceed, num_elem, p, q, u_array, v_array);
+  ApplyMass(ceed_ref, num_elem, p, q, u_array, v_ref_array);
+
+  // Check output
+  for (CeedInt i = 0; i < num_nodes_u; i++) {
+    if (fabs(v_array[i] - v_ref_array[i]) > 100. * CEED_EPSILON * fabs(v_ref_array[i])) {
+      // LCOV_EXCL_START
+      printf("v[%" CeedInt_FMT "] %f != reference v[%" CeedInt_FMT "] %f\n", i, v_array[i], i, v_ref_array[i]);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  free(u_array);
+  free(v_array);
+  free(v_ref_array);
+  CeedDestroy(&ceed);
+  CeedDestroy(&ceed_ref);
+  return 0;
+}
@@ -15,12 +15,18 @@
 #include "../general/device.hpp"
 #include "../mesh/nurbs.hpp"
 #include <cmath>
+#include <algorithm>
+#include <memory>
 
 #include "timer.hpp"
 
 namespace mfem
 {
 
+// Number of elements in a batch of element transformations of the legacy
+// assembly loops, see ElementTransformationBatch.
+static const int eltrans_batch_size = 256;
+
 void BilinearForm::AllocMat()
 {
    if (static_cond) { return; }
@@ -404,8 +410,8 @@ void BilinearForm::Assemble(int skip_zeros)
       AllocMat();
    }
 
-#ifdef MFEM_USE_LEGACY_OPENMP
    int free_element_matrices = 0;
+#ifdef MFEM_USE_LEGACY_OPENMP
    if (!element_matrices)
    {
       ComputeElementMatrices();
@@ -433,18 +439,57 @@ void BilinearForm::Assemble(int skip_zeros)
       }
 
       double sparse_matrix_assembly_time = 0.0;
+      double eltrans_batch_time = 0.0;
       std::vector< double > matrix_calculation_times(domain_integs.Size(), 0.0);
 
       timer sparse_matrix_assembly_timer;
+      timer eltrans_batch_timer;
       std::vector< timer > element_matrix_timers(domain_integs.Size());
 
+      // When supported by all domain integrators, the element matrices are
+      // computed in batches of elements, each batch being inserted in the
+      // sparse matrix before the next one is computed. Otherwise, the element
+      // transformations are evaluated in batches of elements.
+      const bool batched_emats =
+         !element_matrices && UsesBatchedElementMatrices();
+      DenseTensor batch_emats;
+      std::unique_ptr<ElementTransformationBatch> eltrans_batch(
+         (element_matrices || batched_emats) ? NULL :
+         NewElementTransformationBatch());
+      BatchedIsoparametricTransformation batch_eltrans;
+      int batch_begin = 0, batch_end = 0;
+
       // Element-wise integration
       for (int i = 0; i < fes -> GetNE(); i++)
       {
+         if ((eltrans_batch || batched_emats) && i == batch_end)
+         {
+            batch_begin = i;
+            batch_end = std::min(i + eltrans_batch_size, fes->GetNE());
+            if (batched_emats)
+            {
+               ComputeElementMatrices(batch_begin, batch_end, batch_emats,
+                                      matrix_calculation_times.data());
+            }
+            else
+            {
+               eltrans_batch_timer.start();
+               eltrans_batch->Compute(batch_begin, batch_end);
+               eltrans_batch_timer.stop();
+               eltrans_batch_time += eltrans_batch_timer.elapsed();
+            }
+         }
          doftrans = fes->GetElementVDofs(i, vdofs);
-         if (element_matrices)
+         if (element_matrices || batched_emats)
          {
-            elmat_p = &(*element_matrices)(i);
+            elmat_p = batched_emats ? &batch_emats(i - batch_begin) :
+                      &(*element_matrices)(i);
+            if (doftrans)
+            {
+               elmat = *elmat_p;
+               doftrans->TransformDual(elmat);
+               elmat_p = &elmat;
+            }
          }
          else
          {
@@ -458,7 +503,15 @@ void BilinearForm::Assemble(int skip_zeros)
                    && !domain_integs[k]->Patchwise())
                {
                   const FiniteElement &fe = *fes->GetFE(i);
-                  eltrans = fes->GetElementTransformation(i);
+                  if (eltrans_batch)
+                  {
+                     eltrans_batch->GetElementTransformation(i, &batch_eltrans);
+                     eltrans = &batch_eltrans;
+                  }
+                  else
+                  {
+                     eltrans = fes->GetElementTransformation(i);
+                  }
                   domain_integs[k]->AssembleElementMatrix(fe, *eltrans, elemmat);
                   if (elmat.Size() == 0)
                   {
@@ -503,8 +556,16 @@ void BilinearForm::Assemble(int skip_zeros)
          }
       }
 
-      for (int k = 0; k < domain_integs.Size(); k++) {
-         std::cout << "k = " << k << " element matrix calculation time: " << matrix_calculation_times[k] * 1000.0 << "ms" << std::endl;
+      if (!element_matrices)
+      {
+         for (int k = 0; k < domain_integs.Size(); k++) {
+            std::cout << "k = " << k << " element matrix calculation time: " << matrix_calculation_times[k] * 1000.0 << "ms" << std::endl;
+         }
+         if (eltrans_batch)
+         {
+            // Shared by all integrators, not included in the times above
+            std::cout << "element transformation batch time: " << eltrans_batch_time * 1000.0 << "ms" << std::endl;
+         }
       }
       std::cout << "sparse matrix assembly time: " << sparse_matrix_assembly_time * 1000.0 << "ms" << std::endl;
 
@@ -695,12 +756,10 @@ void BilinearForm::Assemble(int skip_zeros)
       }
    }
 
-#ifdef MFEM_USE_LEGACY_OPENMP
    if (free_element_matrices)
    {
       FreeElementMatrices();
    }
-#endif
 }
 
 void BilinearForm::ConformingAssemble()
@@ -715,24 +774,33 @@ void BilinearForm::ConformingAssemble()
    const SparseMatrix *P = fes->GetConformingProlongation();
    if (!P) { return; } // conforming mesh
 
+   if (!mat_e)
+   {
+      // When the form is reassembled on the same space, e.g. in every time
+      // step, the pattern of the product is reused and only values computed.
+      if (!conf_rap || !conf_rap->HasStructure(*P, *mat, *P))
+      {
+         conf_rap.reset(new SparseRAP(*P, *mat, *P));
+      }
+      SparseMatrix *RAP = conf_rap->Mult(*mat);
+      delete mat;
+      mat = RAP;
+
+      height = mat->Height();
+      width = mat->Width();
+      return;
+   }
+
    SparseMatrix *R = Transpose(*P);
    SparseMatrix *RA = mfem::Mult(*R, *mat);
    delete mat;
-   if (mat_e)
-   {
-      SparseMatrix *RAe = mfem::Mult(*R, *mat_e);
-      delete mat_e;
-      mat_e = RAe;
-   }
+   SparseMatrix *RAe = mfem::Mult(*R, *mat_e);
+   delete mat_e;
    delete R;
    mat = mfem::Mult(*RA, *P);
    delete RA;
-   if (mat_e)
-   {
-      SparseMatrix *RAeP = mfem::Mult(*mat_e, *P);
-      delete mat_e;
-      mat_e = RAeP;
-   }
+   mat_e = mfem::Mult(*RAe, *P);
+   delete RAe;
 
    height = mat->Height();
    width = mat->Width();
@@ -743,9 +811,35 @@ void BilinearForm::AssembleDiagonal(Vector &diag) const
    MFEM_ASSERT(diag.Size() == fes->GetTrueVSize(),
                "Vector for holding diagonal has wrong size!");
    const SparseMatrix *cP = fes->GetConformingProlongation();
+   if (!ext && !mat)
+   {
+      // Reduce the diagonals of the element matrices, without assembling
+      MFEM_VERIFY(boundary_integs.Size() == 0 &&
+                  interior_face_integs.Size() == 0 &&
+                  boundary_face_integs.Size() == 0,
+                  "the BilinearForm is not assembled!");
+      const ElementDofOrdering ordering = UsesTensorBasis(*fes) ?
+                                          ElementDofOrdering::LEXICOGRAPHIC :
+                                          ElementDofOrdering::NATIVE;
+      const Operator *R = fes->GetElementRestriction(ordering);
+      Vector elem_diag(R->Height());
+      elem_diag = 0.0;
+      for (int k = 0; k < domain_integs.Size(); k++)
+      {
+         MFEM_VERIFY(domain_integs_marker[k] == NULL,
+                     "domain integrator markers are not supported");
+         domain_integs[k]->AssembleElementDiagonals(*fes, elem_diag);
+      }
+      Vector local_diag(cP ? cP->Height() : 0);
+      Vector &ldiag = cP ? local_diag : diag;
+      const ElementRestriction *er = dynamic_cast<const ElementRestriction*>(R);
+      if (er) { er->MultTransposeUnsigned(elem_diag, ldiag); }
+      else { R->MultTranspose(elem_diag, ldiag); }
+      if (cP) { cP->AbsMultTranspose(local_diag, diag); }
+      return;
+   }
    if (!ext)
    {
-      MFEM_ASSERT(mat, "the BilinearForm is not assembled!");
       MFEM_ASSERT(cP == nullptr || mat->Height() == cP->Width(),
                   "BilinearForm::ConformingAssemble() is not called!");
       mat->GetDiag(diag);
@@ -950,33 +1044,112 @@ void BilinearForm::ComputeElementMatrices()
    element_matrices = new DenseTensor(num_dofs_per_el, num_dofs_per_el,
                                       num_elements);
 
+   if (UsesBatchedElementMatrices())
+   {
+      ComputeElementMatrices(0, num_elements, *element_matrices);
+      return;
+   }
+
    DenseMatrix tmp;
-   IsoparametricTransformation eltrans;
+   BatchedIsoparametricTransformation eltrans;
+   std::unique_ptr<ElementTransformationBatch> eltrans_batch(
+      NewElementTransformationBatch());
+
+   for (int b = 0; b < num_elements; b += eltrans_batch_size)
+   {
+      const int b_end = std::min(b + eltrans_batch_size, num_elements);
+      if (eltrans_batch) { eltrans_batch->Compute(b, b_end); }
 
 #ifdef MFEM_USE_LEGACY_OPENMP
-   #pragma omp parallel for private(tmp,eltrans)
+      #pragma omp parallel for private(tmp,eltrans)
 #endif
-   for (int i = 0; i < num_elements; i++)
-   {
-      DenseMatrix elmat(element_matrices->GetData(i),
-                        num_dofs_per_el, num_dofs_per_el);
-      const FiniteElement &fe = *fes->GetFE(i);
+      for (int i = b; i < b_end; i++)
+      {
+         DenseMatrix elmat(element_matrices->GetData(i),
+                           num_dofs_per_el, num_dofs_per_el);
+         const FiniteElement &fe = *fes->GetFE(i);
 #ifdef MFEM_DEBUG
-      if (num_dofs_per_el != fe.GetDof()*fes->GetVDim())
-         mfem_error("BilinearForm::ComputeElementMatrices:"
-                    " all elements must have same number of dofs");
+         if (num_dofs_per_el != fe.GetDof()*fes->GetVDim())
+            mfem_error("BilinearForm::ComputeElementMatrices:"
+                       " all elements must have same number of dofs");
 #endif
-      fes->GetElementTransformation(i, &eltrans);
+         if (eltrans_batch)
+         {
+            eltrans_batch->GetElementTransformation(i, &eltrans);
+         }
+         else
+         {
+            fes->GetElementTransformation(i, &eltrans);
+         }
 
-      domain_integs[0]->AssembleElementMatrix(fe, eltrans, elmat);
-      for (int k = 1; k < domain_integs.Size(); k++)
+         domain_integs[0]->AssembleElementMatrix(fe, eltrans, elmat);
+         for (int k = 1; k < domain_integs.Size(); k++)
+         {
+            // note: some integrators may not be thread-safe
+            domain_integs[k]->AssembleElementMatrix(fe, eltrans, tmp);
+            elmat += tmp;
+         }
+         elmat.ClearExternalData();
+      }
+   }
+}
+
+void BilinearForm::ComputeElementMatrices(int e_begin, int e_end,
+                                          DenseTensor &emats, double *times)
+{
+   MFEM_ASSERT(UsesBatchedElementMatrices(), "batching is not supported");
+   const int n = fes->GetFE(0)->GetDof() * fes->GetVDim();
+   if (emats.SizeI() != n || emats.SizeK() != e_end - e_begin)
+   {
+      emats.SetSize(n, n, e_end - e_begin);
+   }
+   timer integ_timer;
+   for (int k = 0; k < domain_integs.Size(); k++)
+   {
+      if (times) { integ_timer.start(); }
+      domain_integs[k]->AssembleElementMatrices(*fes, emats, k > 0, e_begin);
+      if (times)
+      {
+         MFEM_DEVICE_SYNC;
+         integ_timer.stop();
+         times[k] += integ_timer.elapsed();
+      }
+   }
+   // The sparse matrix is assembled on the host.
+   emats.HostRead();
+}
+
+ElementTransformationBatch *BilinearForm::NewElementTransformationBatch()
+{
+   if (fes->GetNE() == 0 || fes->GetNURBSext()) { return NULL; }
+   Mesh *mesh = fes->GetMesh();
+   const FiniteElement &fe = *fes->GetFE(0);
+   ElementTransformation &T = *fes->GetElementTransformation(0);
+   for (int k = 0; k < domain_integs.Size(); k++)
+   {
+      if (domain_integs[k]->Patchwise()) { continue; }
+      const IntegrationRule *ir = domain_integs[k]->GetElementIntRule(fe, T);
+      if (ir)
+      {
+         return new ElementTransformationBatch(*mesh, *ir,
+                                               mesh->GetElementGeometry(0));
+      }
+   }
+   return NULL;
+}
+
+bool BilinearForm::UsesBatchedElementMatrices() const
+{
+   if (domain_integs.Size() == 0 || fes->GetNE() == 0) { return false; }
+   for (int k = 0; k < domain_integs.Size(); k++)
+   {
+      if (domain_integs_marker[k] != NULL || domain_integs[k]->Patchwise() ||
+          !domain_integs[k]->SupportsBatchedElementMatrices(*fes))
       {
-         // note: some integrators may not be thread-safe
-         domain_integs[k]->AssembleElementMatrix(fe, eltrans, tmp);
-         elmat += tmp;
+         return false;
       }
-      elmat.ClearExternalData();
    }
+   return true;
 }
 
 void BilinearForm::EliminateEssentialBC(const Array<int> &bdr_attr_is_ess,
@@ -1152,6 +1325,7 @@ void BilinearForm::Update(FiniteElementSpace *nfes)
    {
       full_update = true;
       fes = nfes;
+      conf_rap.reset();
    }
    else
    {
@@ -1173,6 +1347,7 @@ void BilinearForm::Update(FiniteElementSpace *nfes)
       mat = NULL;
       delete hybridization;
       hybridization = NULL;
+      if (sequence < fes->GetSequence()) { conf_rap.reset(); }
       sequence = fes->GetSequence();
    }
    else
@@ -18,6 +18,7 @@
 #include "gridfunc.hpp"
 #include "linearform.hpp"
 #include "bilininteg.hpp"
+#include "eltrans_batch.hpp"
 #include "bilinearform_ext.hpp"
 #include "staticcond.hpp"
 #include "hybridization.hpp"
@@ -83,6 +84,17 @@ protected:
    /** Indicates if the sparse matrix is sorted after assembly when using
        Full Assembly (FA). */
    bool sort_sparse_matrix = false;
+   /** Storage options of the element matrices when using Element Assembly
+       (EA), see SetElementMatrixStorage(). */
+   bool ea_symmetric_storage = false, ea_single_storage = false;
+   /** Indicates if the partially assembled data is only recomputed on the new
+       elements after a mesh (de)refinement, see EnableIncrementalPAUpdate(). */
+   bool pa_incremental_update = false;
+
+   /** @brief Symbolic phase of the product P^T M P formed by
+       ConformingAssemble(), reused while the pattern of #mat and the conforming
+       prolongation do not change. */
+   std::unique_ptr<SparseRAP> conf_rap;
 
    /** @brief Indicates the Mesh::sequence corresponding to the current state of
        the BilinearForm. */
@@ -132,6 +144,11 @@ protected:
 
    void ConformingAssemble();
 
+   /** @brief Return a new ElementTransformationBatch at the IntegrationRule
+       the domain integrators use on the first element, or NULL if it is not
+       known. */
+   ElementTransformationBatch *NewElementTransformationBatch();
+
    // may be used in the construction of derived classes
    BilinearForm() : Matrix (0)
    {
@@ -199,9 +216,56 @@ public:
       sort_sparse_matrix = enable_it;
    }
 
+   /** @brief Select a compressed storage format for the element matrices when
+       using AssemblyLevel::ELEMENT.
+
+       If @a symmetric is true, the element matrices are checked for symmetry
+       after assembly and, when they are symmetric, only their upper triangular
+       part is kept. If @a single_precision is true, the stored entries are
+       rounded to single precision, which limits the accuracy of the operator
+       action accordingly. Both options reduce the memory footprint of the
+       element matrices and the memory traffic of Mult() and MultTranspose().
+
+       If used, this method must be called before assembly. */
+   void SetElementMatrixStorage(bool symmetric, bool single_precision = false)
+   {
+      ea_symmetric_storage = symmetric;
+      ea_single_storage = single_precision;
+   }
+
+   /// Return true if symmetric element matrix storage was requested.
+   bool UseSymmetricElementMatrixStorage() const { return ea_symmetric_storage; }
+
+   /// Return true if single precision element matrix storage was requested.
+   bool UseSingleElementMatrixStorage() const { return ea_single_storage; }
+
+   /** @brief Only recompute the partially assembled data of the new elements
+       when the form is reassembled after a refinement or derefinement of the
+       mesh.
+
+       With AssemblyLevel::PARTIAL, when Update() and Assemble() follow a
+       refinement or derefinement of a nonconforming mesh, the domain
+       integrators that support it (see
+       BilinearFormIntegrator::AssemblePAUpdate()) copy the data of the
+       elements that were not changed and evaluate it on the new elements
+       only. This is only valid if the coefficients did not change since the
+       previous assembly. The element restriction and the other assembly
+       levels are still rebuilt for the whole mesh. */
+   void EnableIncrementalPAUpdate(bool enable_it = true)
+   {
+      pa_incremental_update = enable_it;
+   }
+
+   /// Return true if incremental updates of the partial assembly are enabled.
+   bool UseIncrementalPAUpdate() const { return pa_incremental_update; }
+
    /// Returns the assembly level
    AssemblyLevel GetAssemblyLevel() const { return assembly; }
 
+   /** @brief Return the extension implementing the assembly level, or NULL
+       for AssemblyLevel::LEGACY. */
+   const BilinearFormExtension *GetExtension() const { return ext; }
+
    Hybridization *GetHybridization() const { return hybridization; }
 
    /** @brief Enable the use of static condensation. For details see the
@@ -440,7 +504,13 @@ public:
        before applying conforming assembly, P^T is the transpose of the
        conforming prolongation, and |.| denotes the entry-wise absolute value.
        In general, this is just an approximation of the exact diagonal for this
-       case. */
+       case.
+
+       With AssemblyLevel::LEGACY, if the form is not assembled, the diagonal
+       is reduced from the diagonals of the element matrices, see
+       BilinearFormIntegrator::AssembleElementDiagonals(), with the same
+       treatment of hanging nodes. Only domain integrators are supported in
+       this case. */
    virtual void AssembleDiagonal(Vector &diag) const;
 
    /// Get the finite element space prolongation operator.
@@ -548,8 +618,29 @@ public:
    virtual void RecoverFEMSolution(const Vector &X, const Vector &b, Vector &x);
 
    /// Compute and store internally all element matrices.
+   /** When UsesBatchedElementMatrices() is true, the element matrices are
+       computed for all elements at once with the integrators'
+       AssembleElementMatrices() methods. */
    void ComputeElementMatrices();
 
+   /** @brief Compute the element matrices of the elements [@a e_begin,
+       @a e_end) in @a emats, which is resized if needed. Requires
+       UsesBatchedElementMatrices() to be true. */
+   /** If @a times is not NULL, the time (in seconds) spent in the k-th domain
+       integrator is added to @a times[k]. */
+   void ComputeElementMatrices(int e_begin, int e_end, DenseTensor &emats,
+                               double *times = NULL);
+
+   /** @brief Return true if the element matrices of all domain integrators can
+       be computed in batches, see
+       BilinearFormIntegrator::AssembleElementMatrices().
+
+       In this case, Assemble() computes the element matrices in batches of
+       elements, inserting each batch in the sparse matrix before computing
+       the next one. Domain integrators restricted to a subset of the elements
+       are not supported. */
+   bool UsesBatchedElementMatrices() const;
+
    /// Free the memory used by the element matrices.
    void FreeElementMatrices()
    { delete element_matrices; element_matrices = NULL; }
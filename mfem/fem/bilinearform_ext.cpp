@@ -39,17 +39,40 @@ const Operator *BilinearFormExtension::GetRestriction() const
    return a->GetRestriction();
 }
 
+// Return a single libCEED operator applying all the domain integrators
+// @a integrators, so that e.g. mass + diffusion is one libCEED call, or NULL if
+// the integrators cannot be combined.
+static ceed::Operator *NewCeedDomainOperator(
+   const FiniteElementSpace &fes,
+   const Array<BilinearFormIntegrator*> &integrators)
+{
+   if (!DeviceCanUseCeed() || fes.GetNE() == 0) { return nullptr; }
+   Array<ceed::Operator*> ops;
+   for (BilinearFormIntegrator *integ : integrators)
+   {
+      if (!integ->SupportsCeed() || integ->Patchwise()) { return nullptr; }
+      ops.Append(&integ->GetCeedOp());
+   }
+   return ceed::NewCompositeOperator(ops);
+}
+
 // Data and methods for partially-assembled bilinear forms
 MFBilinearFormExtension::MFBilinearFormExtension(BilinearForm *form)
    : BilinearFormExtension(form),
      trial_fes(a->FESpace()),
-     test_fes(a->FESpace())
+     test_fes(a->FESpace()),
+     ceed_op(nullptr)
 {
    elem_restrict = NULL;
    int_face_restrict_lex = NULL;
    bdr_face_restrict_lex = NULL;
 }
 
+MFBilinearFormExtension::~MFBilinearFormExtension()
+{
+   delete ceed_op;
+}
+
 void MFBilinearFormExtension::Assemble()
 {
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
@@ -58,6 +81,8 @@ void MFBilinearFormExtension::Assemble()
    {
       integrators[i]->AssembleMF(*a->FESpace());
    }
+   delete ceed_op;
+   ceed_op = NewCeedDomainOperator(*a->FESpace(), integrators);
 
    MFEM_VERIFY(a->GetBBFI()->Size() == 0, "AddBoundaryIntegrator is not "
                "currently supported in MFBilinearFormExtension");
@@ -90,6 +115,11 @@ void MFBilinearFormExtension::AssembleDiagonal(Vector &y) const
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
       y = 0.0;
+      if (ceed_op)
+      {
+         ceed_op->GetDiagonal(y);
+         return;
+      }
       for (int i = 0; i < iSz; ++i)
       {
          integrators[i]->AssembleDiagonalMF(y);
@@ -104,6 +134,9 @@ void MFBilinearFormExtension::Update()
    trial_fes = fes;
    test_fes = fes;
 
+   delete ceed_op;
+   ceed_op = nullptr;
+
    elem_restrict = nullptr;
    int_face_restrict_lex = nullptr;
    bdr_face_restrict_lex = nullptr;
@@ -133,7 +166,12 @@ void MFBilinearFormExtension::Mult(const Vector &x, Vector &y) const
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
 
    const int iSz = integrators.Size();
-   if (DeviceCanUseCeed() || !elem_restrict)
+   if (ceed_op)
+   {
+      y.UseDevice(true); // typically this is a large vector, so store on device
+      ceed_op->Mult(x, y);
+   }
+   else if (DeviceCanUseCeed() || !elem_restrict)
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
       y = 0.0;
@@ -247,11 +285,34 @@ void MFBilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
 PABilinearFormExtension::PABilinearFormExtension(BilinearForm *form)
    : BilinearFormExtension(form),
      trial_fes(a->FESpace()),
-     test_fes(a->FESpace())
+     test_fes(a->FESpace()),
+     ceed_op(nullptr),
+     assembled_sequence(-1)
 {
    elem_restrict = NULL;
    int_face_restrict_lex = NULL;
    bdr_face_restrict_lex = NULL;
+   int_face_normal_deriv_restrict = NULL;
+   bdr_face_normal_deriv_restrict = NULL;
+}
+
+PABilinearFormExtension::~PABilinearFormExtension()
+{
+   delete ceed_op;
+   delete int_face_normal_deriv_restrict;
+   delete bdr_face_normal_deriv_restrict;
+}
+
+// Return true if one of the face @a integrators requires the normal
+// derivatives on the faces.
+static bool RequireFaceNormalDerivatives(
+   const Array<BilinearFormIntegrator*> &integrators)
+{
+   for (const BilinearFormIntegrator *integ : integrators)
+   {
+      if (integ->RequiresFaceNormalDerivatives()) { return true; }
+   }
+   return false;
 }
 
 void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
@@ -287,6 +348,17 @@ void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
       int_face_Y.SetSize(int_face_restrict_lex->Height(), Device::GetMemoryType());
       int_face_Y.UseDevice(true); // ensure 'int_face_Y = 0.0' is done on device
    }
+   if (int_face_normal_deriv_restrict == NULL &&
+       RequireFaceNormalDerivatives(*a->GetFBFI()))
+   {
+      int_face_normal_deriv_restrict =
+         new L2NormalDerivativeFaceRestriction(*trial_fes, FaceType::Interior);
+      int_face_dXdn.SetSize(int_face_normal_deriv_restrict->Height(),
+                            Device::GetMemoryType());
+      int_face_dYdn.SetSize(int_face_normal_deriv_restrict->Height(),
+                            Device::GetMemoryType());
+      int_face_dYdn.UseDevice(true);
+   }
 
    const bool has_bdr_integs = (a->GetBFBFI()->Size() > 0 ||
                                 a->GetBBFI()->Size() > 0);
@@ -300,6 +372,19 @@ void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
       bdr_face_Y.SetSize(bdr_face_restrict_lex->Height(), Device::GetMemoryType());
       bdr_face_Y.UseDevice(true); // ensure 'faceBoundY = 0.0' is done on device
 
+      if (bdr_face_normal_deriv_restrict == NULL &&
+          RequireFaceNormalDerivatives(*a->GetBFBFI()))
+      {
+         bdr_face_normal_deriv_restrict =
+            new L2NormalDerivativeFaceRestriction(*trial_fes,
+                                                  FaceType::Boundary);
+         bdr_face_dXdn.SetSize(bdr_face_normal_deriv_restrict->Height(),
+                               Device::GetMemoryType());
+         bdr_face_dYdn.SetSize(bdr_face_normal_deriv_restrict->Height(),
+                               Device::GetMemoryType());
+         bdr_face_dYdn.UseDevice(true);
+      }
+
       const Mesh &mesh = *trial_fes->GetMesh();
       // See LinearFormExtension::Update for explanation of f_to_be logic.
       std::unordered_map<int,int> f_to_be;
@@ -342,10 +427,60 @@ void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
    }
 }
 
+bool PABilinearFormExtension::GetIncrementalUpdateMap(Array<int> &old_elem)
+const
+{
+   Mesh *mesh = a->FESpace()->GetMesh();
+   const Mesh::Operation op = mesh->GetLastOperation();
+   if (!a->UseIncrementalPAUpdate() || !mesh->ncmesh ||
+       assembled_sequence < 0 ||
+       mesh->GetSequence() != assembled_sequence + 1 ||
+       (op != Mesh::REFINE && op != Mesh::DEREFINE))
+   {
+      return false;
+   }
+
+   const int ne = mesh->GetNE();
+   old_elem.SetSize(ne);
+   if (op == Mesh::REFINE)
+   {
+      // Leaves that were not refined have the identity embedding (matrix 0)
+      // in their former element, see NCMesh::GetRefinementTransforms().
+      const CoarseFineTransformations &cf = mesh->GetRefinementTransforms();
+      for (int e = 0; e < ne; e++)
+      {
+         const Embedding &emb = cf.embeddings[e];
+         old_elem[e] = (emb.matrix == 0) ? emb.parent : -1;
+      }
+   }
+   else
+   {
+      // The embeddings are indexed by the former elements: those that were
+      // not derefined have the identity embedding in their new element, see
+      // NCMesh::GetDerefinementTransforms().
+      const CoarseFineTransformations &cf =
+         mesh->ncmesh->GetDerefinementTransforms();
+      old_elem = -1;
+      for (int f = 0; f < cf.embeddings.Size(); f++)
+      {
+         const Embedding &emb = cf.embeddings[f];
+         if (emb.matrix == 0 && !emb.ghost && emb.parent >= 0 &&
+             emb.parent < ne)
+         {
+            old_elem[emb.parent] = f;
+         }
+      }
+   }
+   return true;
+}
+
 void PABilinearFormExtension::Assemble()
 {
    SetupRestrictionOperators(L2FaceValues::DoubleValued);
 
+   Array<int> old_elem;
+   const bool incremental = GetIncrementalUpdateMap(old_elem);
+
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
    for (BilinearFormIntegrator *integ : integrators)
    {
@@ -355,11 +490,18 @@ void PABilinearFormExtension::Assemble()
                      "Patchwise integration requires a NURBS FE space");
          integ->AssembleNURBSPA(*a->FESpace());
       }
+      else if (incremental)
+      {
+         integ->AssemblePAUpdate(*a->FESpace(), old_elem);
+      }
       else
       {
          integ->AssemblePA(*a->FESpace());
       }
    }
+   assembled_sequence = a->FESpace()->GetMesh()->GetSequence();
+   delete ceed_op;
+   ceed_op = NewCeedDomainOperator(*a->FESpace(), integrators);
 
    Array<BilinearFormIntegrator*> &bdr_integrators = *a->GetBBFI();
    for (BilinearFormIntegrator *integ : bdr_integrators)
@@ -392,7 +534,14 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
          localY = 0.0;
          for (int i = 0; i < iSz; ++i)
          {
-            integrators[i]->AssembleDiagonalPA(localY);
+            if (integrators[i]->SupportsAssembleDiagonalPA())
+            {
+               integrators[i]->AssembleDiagonalPA(localY);
+            }
+            else
+            {
+               integrators[i]->AssembleElementDiagonals(*a->FESpace(), localY);
+            }
          }
          const ElementRestriction* H1elem_restrict =
             dynamic_cast<const ElementRestriction*>(elem_restrict);
@@ -410,6 +559,12 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
          y = 0.0;
       }
    }
+   else if (ceed_op)
+   {
+      y.UseDevice(true); // typically this is a large vector, so store on device
+      y = 0.0;
+      ceed_op->GetDiagonal(y);
+   }
    else
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
@@ -440,9 +595,16 @@ void PABilinearFormExtension::Update()
    trial_fes = fes;
    test_fes = fes;
 
+   delete ceed_op;
+   ceed_op = nullptr;
+
    elem_restrict = nullptr;
    int_face_restrict_lex = nullptr;
    bdr_face_restrict_lex = nullptr;
+   delete int_face_normal_deriv_restrict;
+   int_face_normal_deriv_restrict = nullptr;
+   delete bdr_face_normal_deriv_restrict;
+   bdr_face_normal_deriv_restrict = nullptr;
 }
 
 void PABilinearFormExtension::FormSystemMatrix(const Array<int> &ess_tdof_list,
@@ -492,7 +654,12 @@ void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
    std::vector< timer > integrator_timers(iSz);
    timer scatter_timer;
 
-   if (DeviceCanUseCeed() || !elem_restrict || allPatchwise)
+   if (ceed_op)
+   {
+      y.UseDevice(true); // typically this is a large vector, so store on device
+      ceed_op->Mult(x, y);
+   }
+   else if (DeviceCanUseCeed() || !elem_restrict || allPatchwise)
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
       y = 0.0;
@@ -540,48 +707,7 @@ void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
    }
    std::cout << "PA scatter time: " << scatter_timer.elapsed() * 1000.0 << "ms" << std::endl;
 
-   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
-   const int iFISz = intFaceIntegrators.Size();
-   if (int_face_restrict_lex && iFISz>0)
-   {
-      int_face_restrict_lex->Mult(x, int_face_X);
-      if (int_face_X.Size()>0)
-      {
-         int_face_Y = 0.0;
-         for (int i = 0; i < iFISz; ++i)
-         {
-            intFaceIntegrators[i]->AddMultPA(int_face_X, int_face_Y);
-         }
-         int_face_restrict_lex->AddMultTransposeInPlace(int_face_Y, y);
-      }
-   }
-
-   Array<BilinearFormIntegrator*> &bdr_integs = *a->GetBBFI();
-   Array<BilinearFormIntegrator*> &bdr_face_integs = *a->GetBFBFI();
-   const int n_bdr_integs = bdr_integs.Size();
-   const int n_bdr_face_integs = bdr_face_integs.Size();
-   const bool has_bdr_integs = (n_bdr_face_integs > 0 || n_bdr_integs > 0);
-   if (bdr_face_restrict_lex && has_bdr_integs)
-   {
-      Array<Array<int>*> &bdr_markers = *a->GetBBFI_Marker();
-      Array<Array<int>*> &bdr_face_markers = *a->GetBFBFI_Marker();
-      bdr_face_restrict_lex->Mult(x, bdr_face_X);
-      if (bdr_face_X.Size()>0)
-      {
-         bdr_face_Y = 0.0;
-         for (int i = 0; i < n_bdr_integs; ++i)
-         {
-            AddMultWithMarkers(*bdr_integs[i], bdr_face_X, bdr_markers[i], bdr_attributes,
-                               false, bdr_face_Y);
-         }
-         for (int i = 0; i < n_bdr_face_integs; ++i)
-         {
-            AddMultWithMarkers(*bdr_face_integs[i], bdr_face_X, bdr_face_markers[i],
-                               bdr_attributes, false, bdr_face_Y);
-         }
-         bdr_face_restrict_lex->AddMultTransposeInPlace(bdr_face_Y, y);
-      }
-   }
+   AddMultFaces(x, y, false);
 }
 
 void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
@@ -610,49 +736,7 @@ void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
       }
    }
 
-   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
-   const int iFISz = intFaceIntegrators.Size();
-   if (int_face_restrict_lex && iFISz>0)
-   {
-      int_face_restrict_lex->Mult(x, int_face_X);
-      if (int_face_X.Size()>0)
-      {
-         int_face_Y = 0.0;
-         for (int i = 0; i < iFISz; ++i)
-         {
-            intFaceIntegrators[i]->AddMultTransposePA(int_face_X, int_face_Y);
-         }
-         int_face_restrict_lex->AddMultTransposeInPlace(int_face_Y, y);
-      }
-   }
-
-   Array<BilinearFormIntegrator*> &bdr_integs = *a->GetBBFI();
-   Array<BilinearFormIntegrator*> &bdr_face_integs = *a->GetBFBFI();
-   const int n_bdr_integs = bdr_integs.Size();
-   const int n_bdr_face_integs = bdr_face_integs.Size();
-   const bool has_bdr_integs = (n_bdr_face_integs > 0 || n_bdr_integs > 0);
-   if (bdr_face_restrict_lex && has_bdr_integs)
-   {
-      Array<Array<int>*> &bdr_markers = *a->GetBBFI_Marker();
-      Array<Array<int>*> &bdr_face_markers = *a->GetBFBFI_Marker();
-
-      bdr_face_restrict_lex->Mult(x, bdr_face_X);
-      if (bdr_face_X.Size() > 0)
-      {
-         bdr_face_Y = 0.0;
-         for (int i = 0; i < n_bdr_integs; ++i)
-         {
-            AddMultWithMarkers(*bdr_integs[i], bdr_face_X, bdr_markers[i], bdr_attributes,
-                               true, bdr_face_Y);
-         }
-         for (int i = 0; i < n_bdr_face_integs; ++i)
-         {
-            AddMultWithMarkers(*bdr_face_integs[i], bdr_face_X, bdr_face_markers[i],
-                               bdr_attributes, true, bdr_face_Y);
-         }
-         bdr_face_restrict_lex->AddMultTransposeInPlace(bdr_face_Y, y);
-      }
-   }
+   AddMultFaces(x, y, true);
 }
 
 // Compute kernels for PABilinearFormExtension::AddMultWithMarkers.
@@ -705,10 +789,253 @@ void PABilinearFormExtension::AddMultWithMarkers(
    }
 }
 
+void PABilinearFormExtension::AddMultFacesWithMarkers(
+   const BilinearFormIntegrator &integ,
+   const Vector &x,
+   const Vector &dxdn,
+   const Array<int> *markers,
+   const Array<int> &attributes,
+   const bool transpose,
+   Vector &y,
+   Vector &dydn) const
+{
+   if (!integ.RequiresFaceNormalDerivatives())
+   {
+      AddMultWithMarkers(integ, x, markers, attributes, transpose, y);
+   }
+   else if (markers)
+   {
+      tmp_evec.SetSize(y.Size());
+      tmp_evec = 0.0;
+      tmp_face_dn.SetSize(dydn.Size());
+      tmp_face_dn = 0.0;
+      if (transpose)
+      {
+         integ.AddMultTransposePAFaces(x, dxdn, tmp_evec, tmp_face_dn);
+      }
+      else { integ.AddMultPAFaces(x, dxdn, tmp_evec, tmp_face_dn); }
+      const int nf = attributes.Size();
+      AddWithMarkers_(nf, x.Size() / nf, tmp_evec, *markers, attributes, y);
+      AddWithMarkers_(nf, dxdn.Size() / nf, tmp_face_dn, *markers, attributes,
+                      dydn);
+   }
+   else
+   {
+      if (transpose) { integ.AddMultTransposePAFaces(x, dxdn, y, dydn); }
+      else { integ.AddMultPAFaces(x, dxdn, y, dydn); }
+   }
+}
+
+void PABilinearFormExtension::AddMultFaces(const Vector &x, Vector &y,
+                                           const bool transpose) const
+{
+   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
+   const int iFISz = intFaceIntegrators.Size();
+   if (int_face_restrict_lex && iFISz>0)
+   {
+      int_face_restrict_lex->Mult(x, int_face_X);
+      if (int_face_normal_deriv_restrict)
+      {
+         int_face_normal_deriv_restrict->Mult(x, int_face_dXdn);
+         int_face_dYdn = 0.0;
+      }
+      if (int_face_X.Size()>0)
+      {
+         int_face_Y = 0.0;
+         for (int i = 0; i < iFISz; ++i)
+         {
+            AddMultFacesWithMarkers(*intFaceIntegrators[i], int_face_X,
+                                    int_face_dXdn, NULL, bdr_attributes,
+                                    transpose, int_face_Y, int_face_dYdn);
+         }
+         int_face_restrict_lex->AddMultTransposeInPlace(int_face_Y, y);
+         if (int_face_normal_deriv_restrict)
+         {
+            int_face_normal_deriv_restrict->AddMultTranspose(int_face_dYdn, y);
+         }
+      }
+   }
+
+   Array<BilinearFormIntegrator*> &bdr_integs = *a->GetBBFI();
+   Array<BilinearFormIntegrator*> &bdr_face_integs = *a->GetBFBFI();
+   const int n_bdr_integs = bdr_integs.Size();
+   const int n_bdr_face_integs = bdr_face_integs.Size();
+   const bool has_bdr_integs = (n_bdr_face_integs > 0 || n_bdr_integs > 0);
+   if (bdr_face_restrict_lex && has_bdr_integs)
+   {
+      Array<Array<int>*> &bdr_markers = *a->GetBBFI_Marker();
+      Array<Array<int>*> &bdr_face_markers = *a->GetBFBFI_Marker();
+      bdr_face_restrict_lex->Mult(x, bdr_face_X);
+      if (bdr_face_normal_deriv_restrict)
+      {
+         bdr_face_normal_deriv_restrict->Mult(x, bdr_face_dXdn);
+         bdr_face_dYdn = 0.0;
+      }
+      if (bdr_face_X.Size()>0)
+      {
+         bdr_face_Y = 0.0;
+         for (int i = 0; i < n_bdr_integs; ++i)
+         {
+            AddMultWithMarkers(*bdr_integs[i], bdr_face_X, bdr_markers[i], bdr_attributes,
+                               transpose, bdr_face_Y);
+         }
+         for (int i = 0; i < n_bdr_face_integs; ++i)
+         {
+            AddMultFacesWithMarkers(*bdr_face_integs[i], bdr_face_X,
+                                    bdr_face_dXdn, bdr_face_markers[i],
+                                    bdr_attributes, transpose, bdr_face_Y,
+                                    bdr_face_dYdn);
+         }
+         bdr_face_restrict_lex->AddMultTransposeInPlace(bdr_face_Y, y);
+         if (bdr_face_normal_deriv_restrict)
+         {
+            bdr_face_normal_deriv_restrict->AddMultTranspose(bdr_face_dYdn, y);
+         }
+      }
+   }
+}
+
+void PABilinearFormExtension::MultElementOperator(const Vector &x, Vector &y,
+                                                  bool transpose) const
+{
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   y = 0.0;
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      AddMultWithMarkers(*integrators[i], x, elem_markers[i], elem_attributes,
+                         transpose, y);
+   }
+}
+
+Operator *PABilinearFormExtension::SetupRAP(const Operator *Pi,
+                                            const Operator *Po)
+{
+#ifdef MFEM_USE_MPI
+   auto P = dynamic_cast<const ConformingProlongationOperator*>(Pi);
+   auto R = dynamic_cast<const ElementRestriction*>(elem_restrict);
+   bool overlap = P && Po == Pi && R && !ceed_op && !DeviceCanUseCeed() &&
+                  trial_fes == test_fes && a->GetDBFI()->Size() > 0 &&
+                  a->GetFBFI()->Size() == 0 && a->GetBBFI()->Size() == 0 &&
+                  a->GetBFBFI()->Size() == 0;
+   for (int i = 0; overlap && i < a->GetDBFI()->Size(); i++)
+   {
+      overlap = !(*a->GetDBFI())[i]->Patchwise();
+   }
+   if (overlap) { return new ParPAOverlapOperator(*this, *P, *R); }
+#endif
+   return Operator::SetupRAP(Pi, Po);
+}
+
+bool PABilinearFormExtension::SupportsPAElements() const
+{
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   if (ceed_op || DeviceCanUseCeed()) { return false; }
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      if (elem_markers[i] || !integrators[i]->SupportsPAElements())
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+#ifdef MFEM_USE_MPI
+ParPAOverlapOperator::ParPAOverlapOperator(
+   const PABilinearFormExtension &pa_, const ConformingProlongationOperator &P_,
+   const ElementRestriction &R_)
+   : Operator(P_.Width()), pa(pa_), P(P_), R(R_),
+     split(pa_.SupportsPAElements()),
+     Lx(P_.Height()), Ly(P_.Height())
+{
+   const FiniteElementSpace &fes = *pa.trial_fes;
+   const int ndofs = fes.GetNDofs();
+   const int vdim = fes.GetVDim();
+   const bool byvdim = fes.GetOrdering() == Ordering::byVDIM;
+
+   // Mark the (scalar) dofs owned by other ranks.
+   Array<bool> ext(ndofs);
+   ext = false;
+   for (int ldof : P.GetExternalLDofs())
+   {
+      ext[byvdim ? ldof / vdim : ldof % ndofs] = true;
+   }
+   for (int i = 0; i < ndofs; i++)
+   {
+      (ext[i] ? ext_dofs : own_dofs).Append(i);
+   }
+
+   // Boundary elements have at least one dof owned by other ranks.
+   const int ne = fes.GetNE();
+   const Array<int> &gather_map = R.GatherMap();
+   const int *map = gather_map.HostRead();
+   const int nd = ne > 0 ? gather_map.Size() / ne : 0;
+   for (int e = 0; e < ne; e++)
+   {
+      bool bdr = false;
+      for (int k = 0; k < nd && !bdr; k++)
+      {
+         const int gid = map[k + nd*e];
+         bdr = ext[gid >= 0 ? gid : -1-gid];
+      }
+      (bdr ? bdr_elems : int_elems).Append(e);
+   }
+   Lx.UseDevice(true);
+   Ly.UseDevice(true);
+}
+
+void ParPAOverlapOperator::AddMultElements(const Array<int> &elems,
+                                           bool transpose) const
+{
+   Array<BilinearFormIntegrator*> &integrators = *pa.a->GetDBFI();
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      if (transpose)
+      {
+         integrators[i]->AddMultTransposePAElements(elems, pa.localX,
+                                                    pa.localY);
+      }
+      else
+      {
+         integrators[i]->AddMultPAElements(elems, pa.localX, pa.localY);
+      }
+   }
+}
+
+void ParPAOverlapOperator::Apply(const Vector &x, Vector &y,
+                                 bool transpose) const
+{
+   Vector &localX = pa.localX, &localY = pa.localY;
+
+   P.MultBegin(x, Lx);
+   R.MultElements(int_elems, Lx, localX);
+   if (split)
+   {
+      localY = 0.0;
+      AddMultElements(int_elems, transpose);
+   }
+   P.MultEnd(Lx);
+   R.MultElements(bdr_elems, Lx, localX);
+
+   if (split) { AddMultElements(bdr_elems, transpose); }
+   else { pa.MultElementOperator(localX, localY, transpose); }
+
+   R.MultTransposeDofs(ext_dofs, localY, Ly);
+   P.MultTransposeBegin(Ly);
+   R.MultTransposeDofs(own_dofs, localY, Ly);
+   P.MultTransposeEnd(Ly, y);
+}
+#endif
+
 // Data and methods for element-assembled bilinear forms
 EABilinearFormExtension::EABilinearFormExtension(BilinearForm *form)
    : PABilinearFormExtension(form),
-     factorize_face_terms(false)
+     factorize_face_terms(false),
+     allow_compression(true),
+     ea_packed(false),
+     ea_single(false)
 {
    if (form->FESpace()->IsDGSpace() && form->FESpace()->Conforming())
    {
@@ -787,6 +1114,255 @@ void EABilinearFormExtension::Assemble()
       auto restFbdr = dynamic_cast<const L2FaceRestriction*>(bdr_face_restrict_lex);
       restFbdr->AddFaceMatricesToElementMatrices(ea_data_bdr, ea_data);
    }
+
+   CompressElementMatrices();
+}
+
+// Returns true if all element matrices in ea_data are symmetric, up to
+// round-off relative to the largest entry. The columns are checked in
+// parallel and the maxima are computed with device reductions.
+static bool ElementMatricesAreSymmetric(const int ne, const int ndofs,
+                                        const Vector &ea_data)
+{
+   const int NDOFS = ndofs;
+   // Negated maxima per column, reduced with Vector::Min()
+   Vector neg_abs(ne*NDOFS), neg_diff(ne*NDOFS);
+   neg_abs.UseDevice(true);
+   neg_diff.UseDevice(true);
+   const auto A = Reshape(ea_data.Read(), NDOFS, NDOFS, ne);
+   auto M_abs = Reshape(neg_abs.Write(), NDOFS, ne);
+   auto M_diff = Reshape(neg_diff.Write(), NDOFS, ne);
+   mfem::forall(ne*NDOFS, [=] MFEM_HOST_DEVICE (int glob_j)
+   {
+      const int e = glob_j/NDOFS;
+      const int j = glob_j%NDOFS;
+      double max_abs = fabs(A(j, j, e)), max_diff = 0.0;
+      for (int i = 0; i < j; i++)
+      {
+         max_abs = fmax(max_abs, fabs(A(i, j, e)));
+         max_diff = fmax(max_diff, fabs(A(i, j, e) - A(j, i, e)));
+      }
+      M_abs(j, e) = -max_abs;
+      M_diff(j, e) = -max_diff;
+   });
+   return -neg_diff.Min() <= -1e-12*neg_abs.Min();
+}
+
+void EABilinearFormExtension::CompressElementMatrices()
+{
+   ea_packed = ea_single = false;
+   ea_data_sp.DeleteAll();
+   if (!allow_compression) { return; }
+
+   const int NE = ne;
+   const int ND = elemDofs;
+   ea_packed = a->UseSymmetricElementMatrixStorage() &&
+               ElementMatricesAreSymmetric(NE, ND, ea_data);
+   ea_single = a->UseSingleElementMatrixStorage();
+   if (!ea_packed && !ea_single) { return; }
+
+   const bool packed = ea_packed, single = ea_single;
+   const int NP = packed ? (ND*(ND+1))/2 : ND*ND;
+   const auto A = Reshape(ea_data.Read(), ND, ND, NE);
+   Vector packed_data;
+   double *P = nullptr;
+   float *P_sp = nullptr;
+   if (single)
+   {
+      ea_data_sp.SetSize(NP*NE, Device::GetMemoryType());
+      P_sp = ea_data_sp.Write();
+   }
+   else
+   {
+      packed_data.SetSize(NP*NE, Device::GetMemoryType());
+      P = packed_data.Write();
+   }
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      int k = e*NP;
+      for (int j = 0; j < ND; j++)
+      {
+         for (int i = 0; i < (packed ? j+1 : ND); i++, k++)
+         {
+            if (single) { P_sp[k] = (float) A(i, j, e); }
+            else { P[k] = A(i, j, e); }
+         }
+      }
+   });
+   if (single) { ea_data.Destroy(); }
+   else { ea_data.Swap(packed_data); }
+}
+
+std::size_t EABilinearFormExtension::ElementMatrixMemorySize() const
+{
+   return ea_single ? ea_data_sp.Size()*sizeof(float) :
+          ea_data.Size()*sizeof(double);
+}
+
+template <typename T>
+static void EAUnpack(const int ne, const int ndofs, const T *data,
+                     const bool packed, DenseTensor &blocks)
+{
+   const int ND = ndofs;
+   const int NP = packed ? (ND*(ND+1))/2 : ND*ND;
+   const auto A = Reshape(data, NP, ne);
+   auto B = Reshape(blocks.Write(), ND, ND, ne);
+   mfem::forall(ne, [=] MFEM_HOST_DEVICE (int e)
+   {
+      int k = 0;
+      for (int j = 0; j < ND; j++)
+      {
+         for (int i = 0; i < (packed ? j+1 : ND); i++, k++)
+         {
+            // A(i,j) couples the local dof i to the local dof j, i.e. it is
+            // the entry in row j and column i
+            B(j, i, e) = A(k, e);
+            if (packed) { B(i, j, e) = A(k, e); }
+         }
+      }
+   });
+}
+
+void EABilinearFormExtension::GetElementMatrices(DenseTensor &blocks) const
+{
+   blocks.SetSize(elemDofs, elemDofs, ne, Device::GetMemoryType());
+   if (ea_single)
+   {
+      EAUnpack(ne, elemDofs, ea_data_sp.Read(), ea_packed, blocks);
+   }
+   else
+   {
+      EAUnpack(ne, elemDofs, ea_data.Read(), ea_packed, blocks);
+   }
+}
+
+// Extract the diagonals of the element matrices, stored in full or packed.
+template <typename T>
+static void EAGetDiagonals(const int ne, const int ndofs, const T *data,
+                           const bool packed, Vector &diag)
+{
+   const int ND = ndofs;
+   const int NP = packed ? (ND*(ND+1))/2 : ND*ND;
+   const auto A = Reshape(data, NP, ne);
+   auto D = Reshape(diag.Write(), ND, ne);
+   mfem::forall(ne*ND, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int e = idx/ND;
+      const int j = idx%ND;
+      D(j, e) = A(packed ? (j*(j+1))/2 + j : j + ND*j, e);
+   });
+}
+
+void EABilinearFormExtension::AssembleDiagonal(Vector &y) const
+{
+   const bool face_terms = !factorize_face_terms &&
+                           (a->GetFBFI()->Size() > 0 || a->GetBFBFI()->Size() > 0);
+   if (!elem_restrict || DeviceCanUseCeed() || face_terms)
+   {
+      PABilinearFormExtension::AssembleDiagonal(y);
+      return;
+   }
+   if (ea_single)
+   {
+      EAGetDiagonals(ne, elemDofs, ea_data_sp.Read(), ea_packed, localY);
+   }
+   else
+   {
+      EAGetDiagonals(ne, elemDofs, ea_data.Read(), ea_packed, localY);
+   }
+   const ElementRestriction* H1elem_restrict =
+      dynamic_cast<const ElementRestriction*>(elem_restrict);
+   if (H1elem_restrict)
+   {
+      H1elem_restrict->MultTransposeUnsigned(localY, y);
+   }
+   else
+   {
+      elem_restrict->MultTranspose(localY, y);
+   }
+}
+
+// Apply the element matrices stored in full, A(i,j,e) being the coupling of
+// local dof i to local dof j.
+template <typename T>
+static void EAMultFull(const int ne, const int ndofs, const T *data,
+                       const Vector &x, Vector &y, const bool transpose)
+{
+   const int NDOFS = ndofs;
+   auto X = Reshape(x.Read(), NDOFS, ne);
+   auto Y = Reshape(y.ReadWrite(), NDOFS, ne);
+   auto A = Reshape(data, NDOFS, NDOFS, ne);
+   mfem::forall(ne*NDOFS, [=] MFEM_HOST_DEVICE (int glob_j)
+   {
+      const int e = glob_j/NDOFS;
+      const int j = glob_j%NDOFS;
+      double res = 0.0;
+      for (int i = 0; i < NDOFS; i++)
+      {
+         res += (transpose ? A(j, i, e) : A(i, j, e))*X(i, e);
+      }
+      Y(j, e) += res;
+   });
+}
+
+// Apply the symmetric element matrices stored as packed upper triangles, with
+// the same one thread per row layout as EAMultFull: the entry (i,j) is stored
+// at index min(i,j) + max(i,j)*(max(i,j)+1)/2.
+template <typename T>
+static void EAMultPacked(const int ne, const int ndofs, const T *data,
+                         const Vector &x, Vector &y)
+{
+   const int NDOFS = ndofs;
+   const int NP = (NDOFS*(NDOFS+1))/2;
+   auto X = Reshape(x.Read(), NDOFS, ne);
+   auto Y = Reshape(y.ReadWrite(), NDOFS, ne);
+   auto A = Reshape(data, NP, ne);
+   mfem::forall(ne*NDOFS, [=] MFEM_HOST_DEVICE (int glob_j)
+   {
+      const int e = glob_j/NDOFS;
+      const int j = glob_j%NDOFS;
+      // Entries (i,j), i <= j, are contiguous in the column j
+      const int col_j = (j*(j+1))/2;
+      double res = 0.0;
+      for (int i = 0; i <= j; i++)
+      {
+         res += A(col_j + i, e)*X(i, e);
+      }
+      // Entries (j,i), i > j, are in the columns i
+      for (int i = j+1; i < NDOFS; i++)
+      {
+         res += A((i*(i+1))/2 + j, e)*X(i, e);
+      }
+      Y(j, e) += res;
+   });
+}
+
+void EABilinearFormExtension::MultElementMatrices(const Vector &x, Vector &y,
+                                                  bool transpose) const
+{
+   if (ea_packed && ea_single)
+   {
+      EAMultPacked(ne, elemDofs, ea_data_sp.Read(), x, y);
+   }
+   else if (ea_packed)
+   {
+      EAMultPacked(ne, elemDofs, ea_data.Read(), x, y);
+   }
+   else if (ea_single)
+   {
+      EAMultFull(ne, elemDofs, ea_data_sp.Read(), x, y, transpose);
+   }
+   else
+   {
+      EAMultFull(ne, elemDofs, ea_data.Read(), x, y, transpose);
+   }
+}
+
+void EABilinearFormExtension::MultElementOperator(const Vector &x, Vector &y,
+                                                  bool transpose) const
+{
+   y = 0.0;
+   MultElementMatrices(x, y, transpose);
 }
 
 void EABilinearFormExtension::Mult(const Vector &x, Vector &y) const
@@ -805,21 +1381,8 @@ void EABilinearFormExtension::Mult(const Vector &x, Vector &y) const
    }
    // Apply the Element Matrices
    {
-      const int NDOFS = elemDofs;
-      auto X = Reshape(useRestrict?localX.Read():x.Read(), NDOFS, ne);
-      auto Y = Reshape(useRestrict?localY.ReadWrite():y.ReadWrite(), NDOFS, ne);
-      auto A = Reshape(ea_data.Read(), NDOFS, NDOFS, ne);
-      mfem::forall(ne*NDOFS, [=] MFEM_HOST_DEVICE (int glob_j)
-      {
-         const int e = glob_j/NDOFS;
-         const int j = glob_j%NDOFS;
-         double res = 0.0;
-         for (int i = 0; i < NDOFS; i++)
-         {
-            res += A(i, j, e)*X(i, e);
-         }
-         Y(j, e) += res;
-      });
+      MultElementMatrices(useRestrict ? localX : x, useRestrict ? localY : y,
+                          false);
       // Apply the Element Restriction transposed
       if (useRestrict)
       {
@@ -933,21 +1496,8 @@ void EABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
    }
    // Apply the Element Matrices transposed
    {
-      const int NDOFS = elemDofs;
-      auto X = Reshape(useRestrict?localX.Read():x.Read(), NDOFS, ne);
-      auto Y = Reshape(useRestrict?localY.ReadWrite():y.ReadWrite(), NDOFS, ne);
-      auto A = Reshape(ea_data.Read(), NDOFS, NDOFS, ne);
-      mfem::forall(ne*NDOFS, [=] MFEM_HOST_DEVICE (int glob_j)
-      {
-         const int e = glob_j/NDOFS;
-         const int j = glob_j%NDOFS;
-         double res = 0.0;
-         for (int i = 0; i < NDOFS; i++)
-         {
-            res += A(j, i, e)*X(i, e);
-         }
-         Y(j, e) += res;
-      });
+      MultElementMatrices(useRestrict ? localX : x, useRestrict ? localY : y,
+                          true);
       // Apply the Element Restriction transposed
       if (useRestrict)
       {
@@ -1050,6 +1600,8 @@ FABilinearFormExtension::FABilinearFormExtension(BilinearForm *form)
    : EABilinearFormExtension(form),
      mat(a->mat)
 {
+   // The full element matrices are needed to assemble the sparse matrix
+   allow_compression = false;
 #ifdef MFEM_USE_MPI
    ParFiniteElementSpace *pfes = nullptr;
    if ( a->GetFBFI()->Size()>0 &&
@@ -22,6 +22,7 @@ namespace mfem
 class BilinearForm;
 class MixedBilinearForm;
 class DiscreteLinearOperator;
+namespace ceed { class Operator; }
 
 /// Class extending the BilinearForm class to support different AssemblyLevels.
 /**  FA - Full Assembly
@@ -74,12 +75,22 @@ protected:
    mutable Vector localX, localY;
    mutable Vector int_face_X, int_face_Y;
    mutable Vector bdr_face_X, bdr_face_Y;
+   /// Normal derivatives on the faces, see RequiresFaceNormalDerivatives().
+   mutable Vector int_face_dXdn, int_face_dYdn;
+   mutable Vector bdr_face_dXdn, bdr_face_dYdn, tmp_face_dn;
    const Operator *elem_restrict; // Not owned
    const FaceRestriction *int_face_restrict_lex; // Not owned
    const FaceRestriction *bdr_face_restrict_lex; // Not owned
+   FaceRestriction *int_face_normal_deriv_restrict; // Owned
+   FaceRestriction *bdr_face_normal_deriv_restrict; // Owned
+   /// libCEED operator applying all the domain integrators at once (owned).
+   ceed::Operator *ceed_op;
+   /// Mesh sequence of the last Assemble(), -1 if not assembled.
+   long assembled_sequence;
 
 public:
    PABilinearFormExtension(BilinearForm*);
+   ~PABilinearFormExtension();
 
    void Assemble();
    void AssembleDiagonal(Vector &diag) const;
@@ -95,6 +106,29 @@ public:
 protected:
    void SetupRestrictionOperators(const L2FaceValues m);
 
+   /** @brief If the domain integrators can be updated incrementally, see
+       BilinearForm::EnableIncrementalPAUpdate(), fill @a old_elem with the
+       index of each element in the previously assembled mesh, or -1 for the
+       new elements, and return true. */
+   bool GetIncrementalUpdateMap(Array<int> &old_elem) const;
+
+   /** @brief Set the E-vector @a y to the action (or the transpose action) of
+       the domain integrators on the E-vector @a x. */
+   virtual void MultElementOperator(const Vector &x, Vector &y,
+                                    bool transpose) const;
+
+   /** @brief In parallel, return a ParPAOverlapOperator when the form
+       consists of domain integrators only, see Operator::SetupRAP(). */
+   virtual Operator *SetupRAP(const Operator *Pi, const Operator *Po);
+
+   /** @brief Return true if the domain integrators can be applied to subsets
+       of the elements, see BilinearFormIntegrator::SupportsPAElements(). */
+   virtual bool SupportsPAElements() const;
+
+#ifdef MFEM_USE_MPI
+   friend class ParPAOverlapOperator;
+#endif
+
    /// @brief Accumulate the action (or transpose) of the integrator on @a x
    /// into @a y, taking into account the (possibly null) @a markers array.
    ///
@@ -113,8 +147,78 @@ protected:
                            const Array<int> &attributes,
                            const bool transpose,
                            Vector &y) const;
+
+   /// @brief Same as AddMultWithMarkers() for face integrators, with the
+   /// normal derivatives @a dxdn and @a dydn used by the integrators that
+   /// require them, see
+   /// BilinearFormIntegrator::RequiresFaceNormalDerivatives().
+   void AddMultFacesWithMarkers(const BilinearFormIntegrator &integ,
+                                const Vector &x, const Vector &dxdn,
+                                const Array<int> *markers,
+                                const Array<int> &attributes,
+                                const bool transpose,
+                                Vector &y, Vector &dydn) const;
+
+   /// Apply the interior and boundary face integrators, adding to @a y.
+   void AddMultFaces(const Vector &x, Vector &y, const bool transpose) const;
 };
 
+#ifdef MFEM_USE_MPI
+class ConformingProlongationOperator;
+
+/** @brief The parallel operator P^T A P of a PABilinearFormExtension A, with
+    the communication of the prolongation P overlapped with the element
+    kernels. */
+/** At construction, the elements are split into interior elements, which have
+    no dofs owned by other ranks, and boundary elements. Mult() starts the
+    exchange of P, gathers the interior elements and, when the domain
+    integrators support it (see BilinearFormIntegrator::SupportsPAElements()),
+    applies the integrators to them while the messages are in flight. It then
+    completes the exchange, gathers and applies the boundary elements. The
+    integrators act on the element lists directly, reading their partially
+    assembled data in place. Otherwise, all the elements are applied after the
+    exchange.
+
+    After the element kernels, the dofs owned by other ranks, which only
+    receive contributions from boundary elements, are scattered first, so that
+    the reduction of P^T proceeds while the remaining dofs are scattered. */
+class ParPAOverlapOperator : public Operator
+{
+protected:
+   const PABilinearFormExtension &pa;
+   const ConformingProlongationOperator &P;
+   const ElementRestriction &R;
+   Array<int> int_elems, bdr_elems; // interior and boundary elements
+   Array<int> ext_dofs, own_dofs; // dofs owned by other ranks and by this one
+   bool split; // apply the interior elements during the exchange
+   mutable Vector Lx, Ly;
+
+   /// Add the action (or the transpose action) of the domain integrators on
+   /// the elements @a elems of the E-vectors.
+   void AddMultElements(const Array<int> &elems, bool transpose) const;
+
+   void Apply(const Vector &x, Vector &y, bool transpose) const;
+
+public:
+   ParPAOverlapOperator(const PABilinearFormExtension &pa,
+                        const ConformingProlongationOperator &P,
+                        const ElementRestriction &R);
+
+   /// Return the number of interior elements.
+   int GetNumInteriorElements() const { return int_elems.Size(); }
+
+   /** @brief Return true if the integrators are applied to the interior
+       elements while the exchange of P is in flight. */
+   bool OverlapsElementKernels() const { return split; }
+
+   virtual void Mult(const Vector &x, Vector &y) const
+   { Apply(x, y, false); }
+
+   virtual void MultTranspose(const Vector &x, Vector &y) const
+   { Apply(x, y, true); }
+};
+#endif
+
 /// Data and methods for element-assembled bilinear forms
 class EABilinearFormExtension : public PABilinearFormExtension
 {
@@ -128,12 +232,55 @@ protected:
    Vector ea_data_int, ea_data_ext, ea_data_bdr;
    bool factorize_face_terms;
 
+   /** Compressed storage of the element matrices, see
+       BilinearForm::SetElementMatrixStorage(). When #ea_packed is true, only
+       the upper triangle of each (symmetric) element matrix is stored,
+       column by column. When #ea_single is true, the entries are stored in
+       #ea_data_sp instead of #ea_data. */
+   bool allow_compression;
+   bool ea_packed, ea_single;
+   Array<float> ea_data_sp;
+
+   /// Convert the assembled #ea_data to the requested compressed storage.
+   void CompressElementMatrices();
+
+   /// Apply the (transposed) element matrices to the E-vector @a x.
+   void MultElementMatrices(const Vector &x, Vector &y, bool transpose) const;
+
+   virtual void MultElementOperator(const Vector &x, Vector &y,
+                                    bool transpose) const;
+
+   /// The element matrices are applied instead of the integrators.
+   virtual bool SupportsPAElements() const { return false; }
+
 public:
    EABilinearFormExtension(BilinearForm *form);
 
    void Assemble();
+   /** @brief Reduce the diagonals of the element matrices. The PA kernels are
+       used instead when there are face terms not included in the element
+       matrices. */
+   void AssembleDiagonal(Vector &diag) const;
    void Mult(const Vector &x, Vector &y) const;
    void MultTranspose(const Vector &x, Vector &y) const;
+
+   /// Return true if the element matrices are stored in packed symmetric form.
+   bool HasPackedElementMatrices() const { return ea_packed; }
+
+   /// Return true if the element matrices are stored in single precision.
+   bool HasSingleElementMatrices() const { return ea_single; }
+
+   /// Return the number of bytes used to store the element matrices.
+   std::size_t ElementMatrixMemorySize() const;
+
+   /** @brief Copy the element matrices to @a blocks (dimension ndofs x ndofs x
+       ne), in double precision and with entry (i,j,e) in row i and column j,
+       whatever the compressed storage. The local dofs are ordered as in
+       GetElementRestriction(). */
+   void GetElementMatrices(DenseTensor &blocks) const;
+
+   /// Return the element restriction used with the element matrices.
+   const Operator *GetElementRestriction() const { return elem_restrict; }
 };
 
 /// Data and methods for fully-assembled bilinear forms
@@ -176,9 +323,12 @@ protected:
    const Operator *elem_restrict; // Not owned
    const FaceRestriction *int_face_restrict_lex; // Not owned
    const FaceRestriction *bdr_face_restrict_lex; // Not owned
+   /// libCEED operator applying all the domain integrators at once (owned).
+   ceed::Operator *ceed_op;
 
 public:
    MFBilinearFormExtension(BilinearForm *form);
+   ~MFBilinearFormExtension();
 
    void Assemble();
    void AssembleDiagonal(Vector &diag) const;
@@ -12,6 +12,7 @@
 // Implementation of Bilinear Form Integrators
 
 #include "fem.hpp"
+#include "../general/forall.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -26,6 +27,44 @@ void BilinearFormIntegrator::AssemblePA(const FiniteElementSpace&)
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AssemblePAUpdate(const FiniteElementSpace &fes,
+                                              const Array<int> &)
+{
+   AssemblePA(fes);
+}
+
+void BilinearFormIntegrator::RemapPAData(const Array<int> &old_elem,
+                                         const Array<int> &changed,
+                                         const Vector &changed_data,
+                                         const int stride, Vector &pa_data)
+{
+   Vector old_data;
+   old_data.Swap(pa_data);
+   pa_data.SetSize(stride*old_elem.Size(),
+                   old_data.GetMemory().GetMemoryType());
+
+   const int S = stride;
+   const int NE = old_elem.Size();
+   const int NC = changed.Size();
+   const auto E = old_elem.Read();
+   const auto C = changed.Read();
+   const auto X = old_data.Read();
+   const auto Y = Reshape(changed_data.Read(), S, NC);
+   auto D = Reshape(pa_data.Write(), S, NE);
+   mfem::forall(S*NE, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int s = i % S;
+      const int e = i / S;
+      if (E[e] >= 0) { D(s,e) = X[s + S*E[e]]; }
+   });
+   mfem::forall(S*NC, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int s = i % S;
+      const int k = i / S;
+      D(s,C[k]) = Y(s,k);
+   });
+}
+
 void BilinearFormIntegrator::AssembleNURBSPA(const FiniteElementSpace&)
 {
    mfem_error ("BilinearFormIntegrator::AssembleNURBSPA(fes)\n"
@@ -71,6 +110,52 @@ void BilinearFormIntegrator::AssembleEA(const FiniteElementSpace &fes,
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AssembleElementMatrices(
+   const FiniteElementSpace &fes, DenseTensor &emats, const bool add,
+   const int e_begin)
+{
+   MFEM_ABORT("BilinearFormIntegrator::AssembleElementMatrices(...)\n"
+              "   is not implemented for this class.");
+}
+
+void BilinearFormIntegrator::AssembleElementDiagonals(
+   const FiniteElementSpace &fes, Vector &diag, const bool add)
+{
+   const int ne = fes.GetNE();
+   if (ne == 0) { return; }
+   const int vdim = fes.GetVDim();
+   const FiniteElement &fe0 = *fes.GetFE(0);
+   const int nd = fe0.GetDof();
+   MFEM_VERIFY(diag.Size() == nd*vdim*ne, "invalid diagonal size");
+
+   // Same dof ordering as the element restriction used with partial assembly
+   const TensorBasisElement *tbe = UsesTensorBasis(fes) ?
+                                   dynamic_cast<const TensorBasisElement*>(&fe0) : nullptr;
+   const int *dof_map = (tbe && tbe->GetDofMap().Size() > 0) ?
+                        tbe->GetDofMap().GetData() : nullptr;
+
+   auto d = Reshape(add ? diag.HostReadWrite() : diag.HostWrite(), nd, vdim, ne);
+   DenseMatrix elmat;
+   Array<int> vdofs;
+   for (int e = 0; e < ne; e++)
+   {
+      DofTransformation *doftrans = fes.GetElementVDofs(e, vdofs);
+      AssembleElementMatrix(*fes.GetFE(e), *fes.GetElementTransformation(e),
+                            elmat);
+      if (doftrans) { doftrans->TransformDual(elmat); }
+      MFEM_VERIFY(elmat.Height() == nd*vdim, "incompatible element matrix");
+      for (int c = 0; c < vdim; c++)
+      {
+         for (int i = 0; i < nd; i++)
+         {
+            const int s = dof_map ? dof_map[i] : i;
+            const int j = (s >= 0 ? s : -1 - s) + c*nd;
+            d(i, c, e) = add ? d(i, c, e) + elmat(j, j) : elmat(j, j);
+         }
+      }
+   }
+}
+
 void BilinearFormIntegrator::AssembleEAInteriorFaces(const FiniteElementSpace
                                                      &fes,
                                                      Vector &ea_data_int,
@@ -102,6 +187,21 @@ void BilinearFormIntegrator::AddMultPA(const Vector &, Vector &) const
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AddMultPAElements(const Array<int> &,
+                                               const Vector &, Vector &) const
+{
+   MFEM_ABORT("BilinearFormIntegrator::AddMultPAElements(...)\n"
+              "   is not implemented for this class.");
+}
+
+void BilinearFormIntegrator::AddMultTransposePAElements(const Array<int> &,
+                                                        const Vector &,
+                                                        Vector &) const
+{
+   MFEM_ABORT("BilinearFormIntegrator::AddMultTransposePAElements(...)\n"
+              "   is not implemented for this class.");
+}
+
 void BilinearFormIntegrator::AddMultNURBSPA(const Vector &, Vector &) const
 {
    MFEM_ABORT("BilinearFormIntegrator::AddMultNURBSPA(...)\n"
@@ -114,6 +214,21 @@ void BilinearFormIntegrator::AddMultTransposePA(const Vector &, Vector &) const
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AddMultPAFaces(const Vector &, const Vector &,
+                                            Vector &, Vector &) const
+{
+   MFEM_ABORT("BilinearFormIntegrator::AddMultPAFaces(...)\n"
+              "   is not implemented for this class.");
+}
+
+void BilinearFormIntegrator::AddMultTransposePAFaces(const Vector &,
+                                                     const Vector &,
+                                                     Vector &, Vector &) const
+{
+   MFEM_ABORT("BilinearFormIntegrator::AddMultTransposePAFaces(...)\n"
+              "   is not implemented for this class.");
+}
+
 void BilinearFormIntegrator::AssembleMF(const FiniteElementSpace &fes)
 {
    MFEM_ABORT("BilinearFormIntegrator::AssembleMF(...)\n"
@@ -349,6 +464,25 @@ void SumIntegrator::AssembleDiagonalPA(Vector &diag)
    }
 }
 
+bool SumIntegrator::SupportsAssembleDiagonalPA() const
+{
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      if (!integrators[i]->SupportsAssembleDiagonalPA()) { return false; }
+   }
+   return true;
+}
+
+void SumIntegrator::AssembleElementDiagonals(const FiniteElementSpace &fes,
+                                             Vector &diag, const bool add)
+{
+   if (!add) { diag = 0.0; }
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      integrators[i]->AssembleElementDiagonals(fes, diag);
+   }
+}
+
 void SumIntegrator::AssemblePAInteriorFaces(const FiniteElementSpace &fes)
 {
    for (int i = 0; i < integrators.Size(); i++)
@@ -3046,6 +3180,13 @@ void VectorDiffusionIntegrator::AssembleElementVector(
 }
 
 
+const IntegrationRule &ElasticityIntegrator::GetRule(
+   const FiniteElement &el, ElementTransformation &Trans)
+{
+   const int order = 2 * Trans.OrderGrad(&el); // correct order?
+   return IntRules.Get(el.GetGeomType(), order);
+}
+
 void ElasticityIntegrator::AssembleElementMatrix(
    const FiniteElement &el, ElementTransformation &Trans, DenseMatrix &elmat)
 {
@@ -3067,12 +3208,7 @@ void ElasticityIntegrator::AssembleElementMatrix(
 
    elmat.SetSize(dof * dim);
 
-   const IntegrationRule *ir = IntRule;
-   if (ir == NULL)
-   {
-      int order = 2 * Trans.OrderGrad(&el); // correct order?
-      ir = &IntRules.Get(el.GetGeomType(), order);
-   }
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, Trans);
 
    static bool first_time = true;
    if (first_time) {
@@ -27,6 +27,16 @@ protected:
    BilinearFormIntegrator(const IntegrationRule *ir = NULL)
       : NonlinearFormIntegrator(ir) { }
 
+   /** @brief Helper for AssemblePAUpdate(): form the new element-wise partially
+       assembled data in @a pa_data.
+
+       The blocks of size @a stride of the elements with @a old_elem[e] >= 0
+       are copied from their previous position in @a pa_data, and the blocks
+       of the elements listed in @a changed are taken from @a changed_data. */
+   static void RemapPAData(const Array<int> &old_elem, const Array<int> &changed,
+                           const Vector &changed_data, const int stride,
+                           Vector &pa_data);
+
 public:
    // TODO: add support for other assembly levels (in addition to PA) and their
    // actions.
@@ -50,6 +60,16 @@ public:
    virtual void AssemblePA(const FiniteElementSpace &trial_fes,
                            const FiniteElementSpace &test_fes);
 
+   /// Method updating the partial assembly after a (de)refinement of the mesh.
+   /** The array @a old_elem gives, for each element of the updated mesh, its
+       index in the mesh used by the previous call to AssemblePA(), or -1 if
+       the element was created by the (de)refinement. Integrators overriding this
+       method only recompute the data of the new elements and copy the rest,
+       which assumes that their coefficients did not change in between. The
+       default implementation calls AssemblePA(). */
+   virtual void AssemblePAUpdate(const FiniteElementSpace &fes,
+                                 const Array<int> &old_elem);
+
    /// Method defining partial assembly on NURBS patches.
    /** The result of the partial assembly is stored internally so that it can be
        used later in the method AddMultNURBSPA(). */
@@ -64,6 +84,10 @@ public:
    /// Assemble diagonal and add it to Vector @a diag.
    virtual void AssembleDiagonalPA(Vector &diag);
 
+   /** @brief Return true if AssembleDiagonalPA() is implemented. Otherwise,
+       the partial assembly extension uses AssembleElementDiagonals(). */
+   virtual bool SupportsAssembleDiagonalPA() const { return false; }
+
    /// Assemble diagonal of ADA^T (A is this integrator) and add it to @a diag.
    virtual void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag);
 
@@ -88,6 +112,46 @@ public:
        called. */
    virtual void AddMultTransposePA(const Vector &x, Vector &y) const;
 
+   /** @brief Return true if AddMultPAElements() and
+       AddMultTransposePAElements() are implemented. */
+   virtual bool SupportsPAElements() const { return false; }
+
+   /// Method for partially assembled action on a subset of the elements.
+   /** Same as AddMultPA() restricted to the elements listed in @a elems: @a x
+       and @a y are full E-vectors and only the blocks of these elements of
+       @a y are updated, using the partially assembled data in place.
+
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual void AddMultPAElements(const Array<int> &elems, const Vector &x,
+                                  Vector &y) const;
+
+   /// Method for partially assembled transposed action on a subset of the
+   /// elements, see AddMultPAElements().
+   virtual void AddMultTransposePAElements(const Array<int> &elems,
+                                           const Vector &x, Vector &y) const;
+
+   /** @brief Return true if the partially assembled face action requires the
+       normal derivatives on the faces, i.e. uses AddMultPAFaces() instead of
+       AddMultPA(). */
+   virtual bool RequiresFaceNormalDerivatives() const { return false; }
+
+   /// Method for partially assembled face action using normal derivatives.
+   /** Perform the action of the face integrator on the face values @a x and
+       the reference normal derivatives @a dxdn and add the result to the face
+       values @a y and normal derivatives @a dydn. The face vectors have the
+       layout of a double-valued L2FaceRestriction, and the normal derivatives
+       are defined by L2NormalDerivativeFaceRestriction.
+
+       This method can be called only after the method AssemblePAInteriorFaces()
+       or AssemblePABoundaryFaces() has been called. */
+   virtual void AddMultPAFaces(const Vector &x, const Vector &dxdn,
+                               Vector &y, Vector &dydn) const;
+
+   /// Transpose of AddMultPAFaces().
+   virtual void AddMultTransposePAFaces(const Vector &x, const Vector &dxdn,
+                                        Vector &y, Vector &dydn) const;
+
    /// Method defining element assembly.
    /** The result of the element assembly is added to the @a emat Vector if
        @a add is true. Otherwise, if @a add is false, we set @a emat. */
@@ -98,6 +162,42 @@ public:
    //                         const FiniteElementSpace &test_fes,
    //                         Vector &emat);
 
+   /** @brief Return true if AssembleElementMatrices() supports the elements of
+       @a fes. */
+   virtual bool SupportsBatchedElementMatrices(
+      const FiniteElementSpace &fes) const { return false; }
+
+   /// Method defining batched assembly of the element matrices.
+   /** Compute the element matrices of the elements [@a e_begin, @a e_begin +
+       ne) of @a fes at once, in the same (native) dof ordering as
+       AssembleElementMatrix(), where ne is the number of matrices in
+       @a emats. The reference basis is evaluated once for all elements and the
+       element matrices are formed with batched dense products. The result is
+       added to @a emats, with size (vdim*dofs, vdim*dofs, ne), if @a add is
+       true. Otherwise, if @a add is false, we set @a emats.
+
+       The Jacobians and the coefficients are evaluated in the elements of the
+       range only, so the memory used does not depend on the mesh size. */
+   virtual void AssembleElementMatrices(const FiniteElementSpace &fes,
+                                        DenseTensor &emats,
+                                        const bool add = true,
+                                        const int e_begin = 0);
+
+   /// Method defining element-local assembly of the diagonal.
+   /** Compute the diagonals of the element matrices as an E-vector with the
+       dof ordering of the partial and element assembly levels (lexicographic
+       for tensor-product elements, native otherwise), so that it can be
+       reduced with ElementRestriction::MultTransposeUnsigned(). The result is
+       added to @a diag if @a add is true. Otherwise, if @a add is false, we
+       set @a diag.
+
+       The default implementation uses AssembleElementMatrix() one element at
+       a time, so that every integrator can supply a diagonal without a global
+       matrix. */
+   virtual void AssembleElementDiagonals(const FiniteElementSpace &fes,
+                                         Vector &diag,
+                                         const bool add = true);
+
    /// Method defining matrix-free assembly.
    /** The result of fully matrix-free assembly is stored internally so that it
        can be used later in the methods AddMultMF() and AddMultTransposeMF(). */
@@ -136,6 +236,15 @@ public:
                                       ElementTransformation &Trans,
                                       DenseMatrix &elmat);
 
+   /** @brief Return the IntegrationRule used by AssembleElementMatrix() for
+       the element @a el with transformation @a Trans, or NULL if it is not
+       known before the call. */
+   /** BilinearForm::Assemble() uses this rule to evaluate the element
+       transformations in batches, see ElementTransformationBatch. */
+   virtual const IntegrationRule *GetElementIntRule(
+      const FiniteElement &el, ElementTransformation &Trans) const
+   { return IntRule; }
+
    /** Compute the local matrix representation of a bilinear form
        a(u,v) defined on different trial (given by u) and test
        (given by v) spaces. The rows in the local matrix correspond
@@ -313,6 +422,12 @@ public:
       bfi->AssemblePA(test_fes, trial_fes); // Reverse test and trial
    }
 
+   virtual void AssemblePAUpdate(const FiniteElementSpace &fes,
+                                 const Array<int> &old_elem)
+   {
+      bfi->AssemblePAUpdate(fes, old_elem);
+   }
+
    virtual void AssemblePAInteriorFaces(const FiniteElementSpace &fes)
    {
       bfi->AssemblePAInteriorFaces(fes);
@@ -333,6 +448,17 @@ public:
       bfi->AddMultTransposePA(x, y);
    }
 
+   /// The transpose has the same diagonal.
+   virtual void AssembleDiagonalPA(Vector &diag)
+   {
+      bfi->AssembleDiagonalPA(diag);
+   }
+
+   virtual bool SupportsAssembleDiagonalPA() const
+   {
+      return bfi->SupportsAssembleDiagonalPA();
+   }
+
    virtual void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
                            const bool add);
 
@@ -427,6 +553,12 @@ public:
    virtual void AssemblePA(const FiniteElementSpace& fes);
 
    virtual void AssembleDiagonalPA(Vector &diag);
+   /// Return true if all the integrators implement AssembleDiagonalPA().
+   virtual bool SupportsAssembleDiagonalPA() const;
+
+   virtual void AssembleElementDiagonals(const FiniteElementSpace &fes,
+                                         Vector &diag,
+                                         const bool add = true);
 
    virtual void AssemblePAInteriorFaces(const FiniteElementSpace &fes);
 
@@ -2090,6 +2222,86 @@ public:
                                          ElementTransformation &Trans);
 };
 
+/** @brief Basis data on a 3D NURBS patch, for patch-wise partial assembly.
+
+    The 1D B-spline basis functions B and their derivatives G are evaluated at
+    the points of the tensor product rule defined on the patch by a
+    NURBSMeshRules. The 1D test matrices Bt and Gt are the transposes of B and
+    G, scaled by the 1D quadrature weights, so that the quadrature data of the
+    patch-wise integrators does not include the weights. With reduced
+    quadrature (see UseReducedRules), only the weights change. As in
+    DiffusionIntegrator, all NURBS weights are assumed to be 1. */
+class PatchBasisInfo
+{
+public:
+   typedef std::vector<std::vector<int>> IntArrayVar2D;
+
+   int dim;
+   Array<int> Q1D, D1D;
+   std::vector<Array2D<double>> B, G, Bt, Gt;
+   /// Element-local coordinates of the 1D points, in each dimension.
+   std::vector<Vector> X1D;
+   /** For each DOF, the range [minD, maxD] of points in its support; for each
+       point, the range [minQ, maxQ] of DOFs supported at the point; for each
+       DOF, the range [minDD, maxDD] of DOFs whose support overlaps. */
+   IntArrayVar2D minD, maxD, minQ, maxQ, minDD, maxDD;
+   Array<const IntegrationRule*> ir1d;
+
+   PatchBasisInfo(Mesh *mesh, int patch, NURBSMeshRules *patchRules);
+
+   /// Number of points in the patch rule.
+   int GetNQ() const { return Q1D[0]*Q1D[1]*Q1D[2]; }
+
+   /// Number of scalar DOFs in the patch.
+   int GetND() const { return D1D[0]*D1D[1]*D1D[2]; }
+
+   /** @brief Set @a ip to the element-local coordinates of the point
+       (qx,qy,qz) of the patch rule, and return the index of the element
+       containing it. */
+   int GetPoint(NURBSMeshRules *patchRules, int patch, int qx, int qy, int qz,
+                IntegrationPoint &ip) const;
+
+   /** @brief Replace the quadrature weights in Bt (and also in Gt, when
+       @a grad is true) by the reduced 1D rules computed with GetReducedRule.
+       Requires LAPACK. */
+   void UseReducedRules(bool grad);
+
+   /// Evaluate the values of the lexicographic patch DOFs @a x at all points.
+   void Interp(const double *x, double *u) const;
+
+   /** Evaluate the reference gradient of @a x at all points; component @a c
+       is stored in du + c*GetNQ(). */
+   void Grad(const double *x, double *du) const;
+
+   /// Add the test action of the point values @a u to @a y.
+   void AddInterpTranspose(const double *u, double *y) const;
+
+   /// Add the test action of the reference gradient values @a du to @a y.
+   void AddGradTranspose(const double *du, double *y) const;
+};
+
+/** @brief Compute a reduced 1D integration rule for each of the @a nd basis
+    functions of a NURBS patch in one dimension, using NNLSSolver.
+
+    For each DOF, the rule integrates the products of its basis function (or its
+    derivative, if @a zeroOrder is false) with all overlapping basis functions
+    (or derivatives) as the full rule @a ir does. The nonzero weights and the
+    point indices, relative to minD[dof], are appended to @a reducedWeights and
+    @a reducedIDs. */
+void GetReducedRule(const int nq, const int nd,
+                    Array2D<double> const& B,
+                    Array2D<double> const& G,
+                    std::vector<int> minQ,
+                    std::vector<int> maxQ,
+                    std::vector<int> minD,
+                    std::vector<int> maxD,
+                    std::vector<int> minDD,
+                    std::vector<int> maxDD,
+                    const IntegrationRule *ir,
+                    const bool zeroOrder,
+                    std::vector<Vector> & reducedWeights,
+                    std::vector<std::vector<int>> & reducedIDs);
+
 /** Class for integrating the bilinear form a(u,v) := (Q grad u, grad v) where Q
     can be a scalar or a matrix coefficient. */
 class DiffusionIntegrator: public BilinearFormIntegrator
@@ -2232,10 +2444,24 @@ public:
 
    virtual void AssemblePA(const FiniteElementSpace &fes);
 
+   /// Recomputes the data of the new elements only, when there is no vector or
+   /// matrix coefficient and libCEED is not used.
+   virtual void AssemblePAUpdate(const FiniteElementSpace &fes,
+                                 const Array<int> &old_elem);
+
    virtual void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
                            const bool add);
 
+   virtual bool SupportsBatchedElementMatrices(
+      const FiniteElementSpace &fes) const;
+
+   virtual void AssembleElementMatrices(const FiniteElementSpace &fes,
+                                        DenseTensor &emats,
+                                        const bool add,
+                                        const int e_begin);
+
    virtual void AssembleDiagonalPA(Vector &diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
 
    virtual void AssembleDiagonalMF(Vector &diag);
 
@@ -2245,6 +2471,15 @@ public:
 
    virtual void AddMultTransposePA(const Vector&, Vector&) const;
 
+   virtual bool SupportsPAElements() const
+   { return !DeviceCanUseCeed(); }
+
+   virtual void AddMultPAElements(const Array<int> &elems, const Vector &x,
+                                  Vector &y) const;
+
+   virtual void AddMultTransposePAElements(const Array<int> &elems,
+                                           const Vector &x, Vector &y) const;
+
    virtual void AddMultNURBSPA(const Vector&, Vector&) const;
 
    void AddMultPatchPA(const int patch, const Vector &x, Vector &y) const;
@@ -2252,6 +2487,10 @@ public:
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe);
 
+   virtual const IntegrationRule *GetElementIntRule(
+      const FiniteElement &el, ElementTransformation &Trans) const
+   { return IntRule ? IntRule : &GetRule(el, el); }
+
    bool SupportsCeed() const { return DeviceCanUseCeed(); }
 
    Coefficient *GetCoefficient() const { return Q; }
@@ -2274,6 +2513,10 @@ protected:
    const FaceGeometricFactors *face_geom; ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
 
+   // Data for NURBS patch PA
+   std::vector<PatchBasisInfo> pbinfo;
+   std::vector<Vector> ppa_data;
+
 public:
    MassIntegrator(const IntegrationRule *ir = NULL)
       : BilinearFormIntegrator(ir), Q(NULL), maps(NULL), geom(NULL) { }
@@ -2298,12 +2541,25 @@ public:
 
    virtual void AssemblePA(const FiniteElementSpace &fes);
 
+   /// Recomputes the data of the new elements only, when libCEED is not used.
+   virtual void AssemblePAUpdate(const FiniteElementSpace &fes,
+                                 const Array<int> &old_elem);
+
    virtual void AssemblePABoundary(const FiniteElementSpace &fes);
 
    virtual void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
                            const bool add);
 
+   virtual bool SupportsBatchedElementMatrices(
+      const FiniteElementSpace &fes) const;
+
+   virtual void AssembleElementMatrices(const FiniteElementSpace &fes,
+                                        DenseTensor &emats,
+                                        const bool add,
+                                        const int e_begin);
+
    virtual void AssembleDiagonalPA(Vector &diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
 
    virtual void AssembleDiagonalMF(Vector &diag);
 
@@ -2313,10 +2569,31 @@ public:
 
    virtual void AddMultTransposePA(const Vector&, Vector&) const;
 
+   virtual bool SupportsPAElements() const
+   { return !DeviceCanUseCeed(); }
+
+   virtual void AddMultPAElements(const Array<int> &elems, const Vector &x,
+                                  Vector &y) const;
+
+   virtual void AddMultTransposePAElements(const Array<int> &elems,
+                                           const Vector &x, Vector &y) const;
+
+   virtual void AssembleNURBSPA(const FiniteElementSpace &fes);
+
+   void AssemblePatchPA(const int patch, const FiniteElementSpace &fes);
+
+   virtual void AddMultNURBSPA(const Vector&, Vector&) const;
+
+   void AddMultPatchPA(const int patch, const Vector &x, Vector &y) const;
+
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe,
                                          ElementTransformation &Trans);
 
+   virtual const IntegrationRule *GetElementIntRule(
+      const FiniteElement &el, ElementTransformation &Trans) const
+   { return IntRule ? IntRule : &GetRule(el, el, Trans); }
+
    bool SupportsCeed() const { return DeviceCanUseCeed(); }
 
    const Coefficient *GetCoefficient() const { return Q; }
@@ -2372,6 +2649,7 @@ public:
                            const bool add);
 
    virtual void AssembleDiagonalPA(Vector &diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
 
    virtual void AssembleDiagonalMF(Vector &diag);
 
@@ -2443,6 +2721,12 @@ protected:
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
 
+   // Data for NURBS patch PA
+   const FiniteElementSpace *fespace;
+   std::vector<PatchBasisInfo> pbinfo;
+   std::vector<Vector> ppa_data;
+   int coeff_dim;
+
 public:
    /// Construct an integrator with coefficient 1.0
    VectorMassIntegrator()
@@ -2465,6 +2749,10 @@ public:
    int GetVDim() const { return vdim; }
    void SetVDim(int vdim_) { vdim = vdim_; }
 
+   const Coefficient *GetCoefficient() const { return Q; }
+   const VectorCoefficient *GetVectorCoefficient() const { return VQ; }
+   const MatrixCoefficient *GetMatrixCoefficient() const { return MQ; }
+
    virtual void AssembleElementMatrix(const FiniteElement &el,
                                       ElementTransformation &Trans,
                                       DenseMatrix &elmat);
@@ -2475,10 +2763,21 @@ public:
    using BilinearFormIntegrator::AssemblePA;
    virtual void AssemblePA(const FiniteElementSpace &fes);
    virtual void AssembleMF(const FiniteElementSpace &fes);
+   virtual bool SupportsBatchedElementMatrices(
+      const FiniteElementSpace &fes) const;
+   virtual void AssembleElementMatrices(const FiniteElementSpace &fes,
+                                        DenseTensor &emats,
+                                        const bool add,
+                                        const int e_begin);
    virtual void AssembleDiagonalPA(Vector &diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
    virtual void AssembleDiagonalMF(Vector &diag);
    virtual void AddMultPA(const Vector &x, Vector &y) const;
    virtual void AddMultMF(const Vector &x, Vector &y) const;
+   virtual void AssembleNURBSPA(const FiniteElementSpace &fes);
+   void AssemblePatchPA(const int patch, const FiniteElementSpace &fes);
+   virtual void AddMultNURBSPA(const Vector &x, Vector &y) const;
+   void AddMultPatchPA(const int patch, const Vector &x, Vector &y) const;
    bool SupportsCeed() const { return DeviceCanUseCeed(); }
 };
 
@@ -2665,8 +2964,20 @@ public:
 
    using BilinearFormIntegrator::AssemblePA;
    virtual void AssemblePA(const FiniteElementSpace &fes);
+   virtual bool SupportsBatchedElementMatrices(
+      const FiniteElementSpace &fes) const;
+   virtual void AssembleElementMatrices(const FiniteElementSpace &fes,
+                                        DenseTensor &emats,
+                                        const bool add,
+                                        const int e_begin);
    virtual void AddMultPA(const Vector &x, Vector &y) const;
    virtual void AssembleDiagonalPA(Vector& diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
+
+   virtual void AssembleMF(const FiniteElementSpace &fes);
+   virtual void AddMultMF(const Vector &x, Vector &y) const;
+   virtual void AssembleDiagonalMF(Vector &diag);
+   bool SupportsCeed() const { return DeviceCanUseCeed(); }
 
    const Coefficient *GetCoefficient() const { return Q; }
 };
@@ -2782,9 +3093,21 @@ public:
    virtual void AssemblePA(const FiniteElementSpace &fes);
    virtual void AssemblePA(const FiniteElementSpace &trial_fes,
                            const FiniteElementSpace &test_fes);
+   virtual bool SupportsBatchedElementMatrices(
+      const FiniteElementSpace &fes) const;
+   virtual void AssembleElementMatrices(const FiniteElementSpace &fes,
+                                        DenseTensor &emats,
+                                        const bool add,
+                                        const int e_begin);
    virtual void AddMultPA(const Vector &x, Vector &y) const;
    virtual void AddMultTransposePA(const Vector &x, Vector &y) const;
    virtual void AssembleDiagonalPA(Vector& diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
+
+   virtual void AssembleMF(const FiniteElementSpace &fes);
+   virtual void AddMultMF(const Vector &x, Vector &y) const;
+   virtual void AssembleDiagonalMF(Vector &diag);
+   bool SupportsCeed() const { return DeviceCanUseCeed(); }
 
    const Coefficient *GetCoefficient() const { return Q; }
 };
@@ -2847,6 +3170,7 @@ protected:
    virtual void AssemblePA(const FiniteElementSpace &fes);
    virtual void AddMultPA(const Vector &x, Vector &y) const;
    virtual void AssembleDiagonalPA(Vector& diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
 
 private:
 #ifndef MFEM_THREAD_SAFE
@@ -2961,6 +3285,10 @@ public:
    VectorDiffusionIntegrator(MatrixCoefficient& mq)
       : MQ(&mq), vdim(mq.GetVDim()) { }
 
+   const Coefficient *GetCoefficient() const { return Q; }
+   const VectorCoefficient *GetVectorCoefficient() const { return VQ; }
+   const MatrixCoefficient *GetMatrixCoefficient() const { return MQ; }
+
    virtual void AssembleElementMatrix(const FiniteElement &el,
                                       ElementTransformation &Trans,
                                       DenseMatrix &elmat);
@@ -2971,6 +3299,7 @@ public:
    virtual void AssemblePA(const FiniteElementSpace &fes);
    virtual void AssembleMF(const FiniteElementSpace &fes);
    virtual void AssembleDiagonalPA(Vector &diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
    virtual void AssembleDiagonalMF(Vector &diag);
    virtual void AddMultPA(const Vector &x, Vector &y) const;
    virtual void AddMultMF(const Vector &x, Vector &y) const;
@@ -2988,6 +3317,17 @@ protected:
    double q_lambda, q_mu;
    Coefficient *lambda, *mu;
 
+   // Data for NURBS patch PA
+   const FiniteElementSpace *fespace;
+   std::vector<PatchBasisInfo> pbinfo;
+   std::vector<Vector> ppa_data;
+
+   // Data for PA without libCEED: reference gradients of the basis (NQ, dim,
+   // ND) and quadrature data (NQ, 2 + dim*dim, NE) on the space pa_fes
+   const FiniteElementSpace *pa_fes;
+   int dim, ne, nq, nd;
+   Vector pa_G, pa_data;
+
 private:
 #ifndef MFEM_THREAD_SAFE
    Vector shape;
@@ -2996,13 +3336,20 @@ private:
 #endif
 
 public:
-   ElasticityIntegrator(Coefficient &l, Coefficient &m)
+   ElasticityIntegrator(Coefficient &l, Coefficient &m) : pa_fes(NULL)
    { lambda = &l; mu = &m; }
    /** With this constructor lambda = q_l * m and mu = q_m * m;
        if dim * q_l + 2 * q_m = 0 then trace(sigma) = 0. */
-   ElasticityIntegrator(Coefficient &m, double q_l, double q_m)
+   ElasticityIntegrator(Coefficient &m, double q_l, double q_m) : pa_fes(NULL)
    { lambda = NULL; mu = &m; q_lambda = q_l; q_mu = q_m; }
 
+   /// Return the coefficient lambda, or NULL if lambda = q_lambda * mu.
+   const Coefficient *GetLambdaCoefficient() const { return lambda; }
+   const Coefficient *GetMuCoefficient() const { return mu; }
+   /// Return the factors q_lambda and q_mu (used only if lambda is NULL).
+   double GetLambdaFactor() const { return q_lambda; }
+   double GetMuFactor() const { return q_mu; }
+
    virtual void AssembleElementMatrix(const FiniteElement &,
                                       ElementTransformation &,
                                       DenseMatrix &);
@@ -3035,6 +3382,41 @@ public:
    virtual double ComputeFluxEnergy(const FiniteElement &fluxelem,
                                     ElementTransformation &Trans,
                                     Vector &flux, Vector *d_energy = NULL);
+
+   virtual bool SupportsBatchedElementMatrices(
+      const FiniteElementSpace &fes) const;
+
+   virtual void AssembleElementMatrices(const FiniteElementSpace &fes,
+                                        DenseTensor &emats,
+                                        const bool add,
+                                        const int e_begin);
+
+   /** Element-local diagonals computed from the quadrature data of the
+       partial assembly, without forming the element matrices. */
+   virtual void AssembleElementDiagonals(const FiniteElementSpace &fes,
+                                         Vector &diag,
+                                         const bool add = true);
+
+   /** Partial assembly without libCEED uses the full (not sum-factorized)
+       reference gradients of the basis and requires a single element type
+       with dim = sdim = vdim. Matrix-free application is only implemented with
+       libCEED, and on NURBS patches (see NonlinearFormIntegrator::Mode). */
+   using BilinearFormIntegrator::AssemblePA;
+   virtual void AssemblePA(const FiniteElementSpace &fes);
+   virtual void AssembleMF(const FiniteElementSpace &fes);
+   virtual void AssembleDiagonalPA(Vector &diag);
+   virtual bool SupportsAssembleDiagonalPA() const { return true; }
+   virtual void AssembleDiagonalMF(Vector &diag);
+   virtual void AddMultPA(const Vector &x, Vector &y) const;
+   virtual void AddMultMF(const Vector &x, Vector &y) const;
+   virtual void AssembleNURBSPA(const FiniteElementSpace &fes);
+   void AssemblePatchPA(const int patch, const FiniteElementSpace &fes);
+   virtual void AddMultNURBSPA(const Vector &x, Vector &y) const;
+   void AddMultPatchPA(const int patch, const Vector &x, Vector &y) const;
+   bool SupportsCeed() const { return DeviceCanUseCeed(); }
+
+   static const IntegrationRule &GetRule(const FiniteElement &el,
+                                         ElementTransformation &Trans);
 };
 
 /** Integrator for the DG form:
@@ -3157,7 +3539,12 @@ public:
     DiffusionIntegrator):
     * sigma = -1, kappa >= kappa0: symm. interior penalty (IP or SIPG) method,
     * sigma = +1, kappa > 0: non-symmetric interior penalty (NIPG) method,
-    * sigma = +1, kappa = 0: the method of Baumann and Oden. */
+    * sigma = +1, kappa = 0: the method of Baumann and Oden.
+
+    Partial assembly is supported for conforming meshes of quadrilaterals and
+    hexahedra, with L2 spaces using a Gauss-Lobatto or Bernstein basis. The face
+    action uses the face values of L2FaceRestriction and the normal derivatives
+    of L2NormalDerivativeFaceRestriction. */
 class DGDiffusionIntegrator : public BilinearFormIntegrator
 {
 protected:
@@ -3171,16 +3558,41 @@ protected:
 
 public:
    DGDiffusionIntegrator(const double s, const double k)
-      : Q(NULL), MQ(NULL), sigma(s), kappa(k) { }
+      : Q(NULL), MQ(NULL), sigma(s), kappa(k), maps(NULL) { }
    DGDiffusionIntegrator(Coefficient &q, const double s, const double k)
-      : Q(&q), MQ(NULL), sigma(s), kappa(k) { }
+      : Q(&q), MQ(NULL), sigma(s), kappa(k), maps(NULL) { }
    DGDiffusionIntegrator(MatrixCoefficient &q, const double s, const double k)
-      : Q(NULL), MQ(&q), sigma(s), kappa(k) { }
+      : Q(NULL), MQ(&q), sigma(s), kappa(k), maps(NULL) { }
    using BilinearFormIntegrator::AssembleFaceMatrix;
    virtual void AssembleFaceMatrix(const FiniteElement &el1,
                                    const FiniteElement &el2,
                                    FaceElementTransformations &Trans,
                                    DenseMatrix &elmat);
+
+   virtual void AssemblePAInteriorFaces(const FiniteElementSpace &fes);
+
+   virtual void AssemblePABoundaryFaces(const FiniteElementSpace &fes);
+
+   virtual bool RequiresFaceNormalDerivatives() const { return true; }
+
+   virtual void AddMultPAFaces(const Vector &x, const Vector &dxdn,
+                               Vector &y, Vector &dydn) const;
+
+   virtual void AddMultTransposePAFaces(const Vector &x, const Vector &dxdn,
+                                        Vector &y, Vector &dydn) const;
+
+   /// The default face rule, of order 2p, as in AssembleFaceMatrix().
+   static const IntegrationRule &GetRule(Geometry::Type geom, int order);
+
+protected:
+   // PA extension
+   Vector pa_data;
+   const DofToQuad *maps; ///< Not owned
+   int dim, nf, nq, dofs1D, quad1D;
+
+   void SetupPA(const FiniteElementSpace &fes, FaceType type);
+   void ApplyPA(const Vector &x, const Vector &dxdn, Vector &y, Vector &dydn,
+                const double alpha, const double beta) const;
 };
 
 /** Integrator for the "BR2" diffusion stabilization term
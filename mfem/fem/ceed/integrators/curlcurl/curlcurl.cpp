@@ -0,0 +1,105 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "curlcurl.hpp"
+
+#include "../../../../config/config.hpp"
+#ifdef MFEM_USE_CEED
+#include "curlcurl_qf.h"
+#endif
+
+namespace mfem
+{
+
+namespace ceed
+{
+
+#ifdef MFEM_USE_CEED
+struct CurlCurlOperatorInfo : public OperatorInfo
+{
+   CurlCurlContext ctx;
+   CurlCurlOperatorInfo(int dim)
+   {
+      header = "/integrators/curlcurl/curlcurl_qf.h";
+      build_func_const = ":f_build_curlcurl_const";
+      build_qf_const = &f_build_curlcurl_const;
+      build_func_quad = ":f_build_curlcurl_quad";
+      build_qf_quad = &f_build_curlcurl_quad;
+      apply_func = ":f_apply_curlcurl";
+      apply_qf = &f_apply_curlcurl;
+      apply_func_mf_const = ":f_apply_curlcurl_mf_const";
+      apply_qf_mf_const = &f_apply_curlcurl_mf_const;
+      apply_func_mf_quad = ":f_apply_curlcurl_mf_quad";
+      apply_qf_mf_quad = &f_apply_curlcurl_mf_quad;
+      trial_op = EvalMode::Curl;
+      test_op = EvalMode::Curl;
+      qdatasize = (dim == 3) ? 6 : 1;
+   }
+};
+#endif
+
+PACurlCurlIntegrator::PACurlCurlIntegrator(
+   const mfem::FiniteElementSpace &fes,
+   const mfem::IntegrationRule &irm,
+   mfem::Coefficient *Q)
+   : PAIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   CurlCurlOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(info, fes, irm, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MixedPACurlCurlIntegrator::MixedPACurlCurlIntegrator(
+   const CurlCurlIntegrator &integ,
+   const mfem::FiniteElementSpace &fes,
+   mfem::Coefficient *Q)
+{
+#ifdef MFEM_USE_CEED
+   CurlCurlOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(integ, info, fes, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MFCurlCurlIntegrator::MFCurlCurlIntegrator(
+   const mfem::FiniteElementSpace &fes,
+   const mfem::IntegrationRule &irm,
+   mfem::Coefficient *Q)
+   : MFIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   CurlCurlOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(info, fes, irm, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MixedMFCurlCurlIntegrator::MixedMFCurlCurlIntegrator(
+   const CurlCurlIntegrator &integ,
+   const mfem::FiniteElementSpace &fes,
+   mfem::Coefficient *Q)
+{
+#ifdef MFEM_USE_CEED
+   CurlCurlOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(integ, info, fes, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+} // namespace ceed
+
+} // namespace mfem
@@ -0,0 +1,63 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_LIBCEED_CURLCURL_HPP
+#define MFEM_LIBCEED_CURLCURL_HPP
+
+#include "../../interface/integrator.hpp"
+#include "../../interface/mixed_integrator.hpp"
+#include "../../../fespace.hpp"
+
+namespace mfem
+{
+
+namespace ceed
+{
+
+/// Represent a CurlCurlIntegrator with AssemblyLevel::Partial using libCEED.
+class PACurlCurlIntegrator : public PAIntegrator
+{
+public:
+   PACurlCurlIntegrator(const mfem::FiniteElementSpace &fes,
+                        const mfem::IntegrationRule &ir,
+                        mfem::Coefficient *Q);
+};
+
+class MixedPACurlCurlIntegrator : public MixedIntegrator<PAIntegrator>
+{
+public:
+   MixedPACurlCurlIntegrator(const CurlCurlIntegrator &integ,
+                             const mfem::FiniteElementSpace &fes,
+                             mfem::Coefficient *Q);
+};
+
+/// Represent a CurlCurlIntegrator with AssemblyLevel::None using libCEED.
+class MFCurlCurlIntegrator : public MFIntegrator
+{
+public:
+   MFCurlCurlIntegrator(const mfem::FiniteElementSpace &fes,
+                        const mfem::IntegrationRule &ir,
+                        mfem::Coefficient *Q);
+};
+
+class MixedMFCurlCurlIntegrator : public MixedIntegrator<MFIntegrator>
+{
+public:
+   MixedMFCurlCurlIntegrator(const CurlCurlIntegrator &integ,
+                             const mfem::FiniteElementSpace &fes,
+                             mfem::Coefficient *Q);
+};
+
+}
+
+}
+
+#endif // MFEM_LIBCEED_CURLCURL_HPP
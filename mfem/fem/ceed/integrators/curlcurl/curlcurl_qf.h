@@ -0,0 +1,232 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+/// A structure used to pass additional data to f_build_curlcurl and
+/// f_apply_curlcurl
+struct CurlCurlContext { CeedInt dim, space_dim, vdim; CeedScalar coeff; };
+
+/// Compute the quadrature data qd, with stride Qd between its components, of a
+/// curl-curl operator at a quadrature point with Jacobian J, with stride QJ
+/// between its entries, and scaling w = qw.coeff: w/det(J) in 2D, where the
+/// curl is a scalar, and the symmetric w/det(J).J^T.J in 3D.
+CEED_QFUNCTION_HELPER void CurlCurlQData(const CeedInt dim, const CeedScalar w,
+                                         const CeedScalar *J, const CeedInt QJ,
+                                         CeedScalar *qd, const CeedInt Qd)
+{
+   if (dim == 2)
+   {
+      // J: 0 2
+      //    1 3
+      qd[0] = w / (J[QJ * 0] * J[QJ * 3] - J[QJ * 1] * J[QJ * 2]);
+      return;
+   }
+   // J: 0 3 6   qd: 0 1 2
+   //    1 4 7       1 3 4
+   //    2 5 8       2 4 5
+   const CeedScalar J11 = J[QJ * 0];
+   const CeedScalar J21 = J[QJ * 1];
+   const CeedScalar J31 = J[QJ * 2];
+   const CeedScalar J12 = J[QJ * 3];
+   const CeedScalar J22 = J[QJ * 4];
+   const CeedScalar J32 = J[QJ * 5];
+   const CeedScalar J13 = J[QJ * 6];
+   const CeedScalar J23 = J[QJ * 7];
+   const CeedScalar J33 = J[QJ * 8];
+   const CeedScalar det = J11 * (J22 * J33 - J23 * J32) -
+                          J21 * (J12 * J33 - J13 * J32) +
+                          J31 * (J12 * J23 - J13 * J22);
+   const CeedScalar s = w / det;
+   qd[Qd * 0] = s * (J11 * J11 + J21 * J21 + J31 * J31);
+   qd[Qd * 1] = s * (J11 * J12 + J21 * J22 + J31 * J32);
+   qd[Qd * 2] = s * (J11 * J13 + J21 * J23 + J31 * J33);
+   qd[Qd * 3] = s * (J12 * J12 + J22 * J22 + J32 * J32);
+   qd[Qd * 4] = s * (J12 * J13 + J22 * J23 + J32 * J33);
+   qd[Qd * 5] = s * (J13 * J13 + J23 * J23 + J33 * J33);
+}
+
+/// Apply the quadrature data qd, with stride Qd between its components, of a
+/// curl-curl operator to the reference curl cu at a quadrature point. The
+/// components of cu and cv have stride Q.
+CEED_QFUNCTION_HELPER void CurlCurlApply(const CeedInt dim,
+                                         const CeedScalar *qd, const CeedInt Qd,
+                                         const CeedScalar *cu, CeedScalar *cv,
+                                         const CeedInt Q)
+{
+   if (dim == 2)
+   {
+      cv[0] = qd[0] * cu[0];
+      return;
+   }
+   const CeedScalar cu0 = cu[Q * 0];
+   const CeedScalar cu1 = cu[Q * 1];
+   const CeedScalar cu2 = cu[Q * 2];
+   cv[Q * 0] = qd[Qd * 0] * cu0 + qd[Qd * 1] * cu1 + qd[Qd * 2] * cu2;
+   cv[Q * 1] = qd[Qd * 1] * cu0 + qd[Qd * 3] * cu1 + qd[Qd * 4] * cu2;
+   cv[Q * 2] = qd[Qd * 2] * cu0 + qd[Qd * 4] * cu1 + qd[Qd * 5] * cu2;
+}
+
+/// libCEED Q-function for building quadrature data for a curl-curl operator
+/// with a constant coefficient
+CEED_QFUNCTION(f_build_curlcurl_const)(void *ctx, CeedInt Q,
+                                       const CeedScalar *const *in,
+                                       CeedScalar *const *out)
+{
+   CurlCurlContext *bc = (CurlCurlContext*)ctx;
+   // in[0] is Jacobians with shape [dim, nc=dim, Q]
+   // in[1] is quadrature weights, size (Q)
+   const CeedScalar coeff = bc->coeff;
+   const CeedScalar *J = in[0], *qw = in[1];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CurlCurlQData(2, coeff * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CurlCurlQData(3, coeff * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for building quadrature data for a curl-curl operator
+/// with a coefficient evaluated at quadrature points.
+CEED_QFUNCTION(f_build_curlcurl_quad)(void *ctx, CeedInt Q,
+                                      const CeedScalar *const *in,
+                                      CeedScalar *const *out)
+{
+   CurlCurlContext *bc = (CurlCurlContext*)ctx;
+   // in[0] is coefficients, size (Q)
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   const CeedScalar *c = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CurlCurlQData(2, c[i] * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CurlCurlQData(3, c[i] * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a curl-curl operator
+CEED_QFUNCTION(f_apply_curlcurl)(void *ctx, CeedInt Q,
+                                 const CeedScalar *const *in,
+                                 CeedScalar *const *out)
+{
+   CurlCurlContext *bc = (CurlCurlContext*)ctx;
+   // in[0], out[0] are the reference curls with shape [curl_dim, Q]
+   // in[1] is the quadrature data with shape [1 (2D) or 6 (3D), Q]
+   const CeedScalar *cu = in[0], *qd = in[1];
+   CeedScalar *cv = out[0];
+   switch (bc->dim)
+   {
+      case 2:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CurlCurlApply(2, qd + i, Q, cu + i, cv + i, Q);
+         }
+         break;
+      case 3:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CurlCurlApply(3, qd + i, Q, cu + i, cv + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a curl-curl operator with a constant
+/// coefficient
+CEED_QFUNCTION(f_apply_curlcurl_mf_const)(void *ctx, CeedInt Q,
+                                          const CeedScalar *const *in,
+                                          CeedScalar *const *out)
+{
+   CurlCurlContext *bc = (CurlCurlContext*)ctx;
+   // in[0], out[0] are the reference curls with shape [curl_dim, Q]
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   const CeedScalar coeff = bc->coeff;
+   const CeedScalar *cu = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *cv = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[1];
+            CurlCurlQData(2, coeff * qw[i], J + i, Q, qd, 1);
+            CurlCurlApply(2, qd, 1, cu + i, cv + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[6];
+            CurlCurlQData(3, coeff * qw[i], J + i, Q, qd, 1);
+            CurlCurlApply(3, qd, 1, cu + i, cv + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a curl-curl operator with a coefficient
+/// evaluated at quadrature points
+CEED_QFUNCTION(f_apply_curlcurl_mf_quad)(void *ctx, CeedInt Q,
+                                         const CeedScalar *const *in,
+                                         CeedScalar *const *out)
+{
+   CurlCurlContext *bc = (CurlCurlContext*)ctx;
+   // in[0] is coefficients, size (Q)
+   // in[1], out[0] are the reference curls with shape [curl_dim, Q]
+   // in[2] is Jacobians with shape [dim, nc=dim, Q]
+   // in[3] is quadrature weights, size (Q)
+   const CeedScalar *c = in[0], *cu = in[1], *J = in[2], *qw = in[3];
+   CeedScalar *cv = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[1];
+            CurlCurlQData(2, c[i] * qw[i], J + i, Q, qd, 1);
+            CurlCurlApply(2, qd, 1, cu + i, cv + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[6];
+            CurlCurlQData(3, c[i] * qw[i], J + i, Q, qd, 1);
+            CurlCurlApply(3, qd, 1, cu + i, cv + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "elasticity.hpp"
+#include "../../../bilininteg.hpp"
+
+#include "../../../../config/config.hpp"
+#ifdef MFEM_USE_CEED
+#include "elasticity_qf.h"
+#endif
+
+namespace mfem
+{
+
+namespace ceed
+{
+
+#ifdef MFEM_USE_CEED
+struct ElasticityOperatorInfo : public OperatorInfo
+{
+   ElasticityContext ctx;
+   ElasticityOperatorInfo(int dim)
+   {
+      header = "/integrators/elasticity/elasticity_qf.h";
+      build_func_const = ":f_build_elast_const";
+      build_qf_const = &f_build_elast_const;
+      build_func_quad = ":f_build_elast_quad";
+      build_qf_quad = &f_build_elast_quad;
+      apply_func = ":f_apply_elast";
+      apply_qf = &f_apply_elast;
+      apply_func_mf_const = ":f_apply_elast_mf_const";
+      apply_qf_mf_const = &f_apply_elast_mf_const;
+      apply_func_mf_quad = ":f_apply_elast_mf_quad";
+      apply_qf_mf_quad = &f_apply_elast_mf_quad;
+      trial_op = EvalMode::Grad;
+      test_op = EvalMode::Grad;
+      qdatasize = 2 + dim*dim;
+   }
+};
+#endif
+
+PAElasticityIntegrator::PAElasticityIntegrator(
+   const mfem::FiniteElementSpace &fes,
+   const mfem::IntegrationRule &irm,
+   mfem::VectorCoefficient *Q)
+   : PAIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   ElasticityOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(info, fes, irm, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MixedPAElasticityIntegrator::MixedPAElasticityIntegrator(
+   const ElasticityIntegrator &integ,
+   const mfem::FiniteElementSpace &fes,
+   mfem::VectorCoefficient *Q)
+{
+#ifdef MFEM_USE_CEED
+   ElasticityOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(integ, info, fes, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MFElasticityIntegrator::MFElasticityIntegrator(
+   const mfem::FiniteElementSpace &fes,
+   const mfem::IntegrationRule &irm,
+   mfem::VectorCoefficient *Q)
+   : MFIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   ElasticityOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(info, fes, irm, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MixedMFElasticityIntegrator::MixedMFElasticityIntegrator(
+   const ElasticityIntegrator &integ,
+   const mfem::FiniteElementSpace &fes,
+   mfem::VectorCoefficient *Q)
+{
+#ifdef MFEM_USE_CEED
+   ElasticityOperatorInfo info(fes.GetMesh()->Dimension());
+   Assemble(integ, info, fes, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+mfem::VectorCoefficient *NewLameCoefficient(const ElasticityIntegrator &integ)
+{
+   mfem::Coefficient *lambda =
+      const_cast<mfem::Coefficient*>(integ.GetLambdaCoefficient());
+   mfem::Coefficient *mu =
+      const_cast<mfem::Coefficient*>(integ.GetMuCoefficient());
+   ConstantCoefficient *c_lambda = dynamic_cast<ConstantCoefficient*>(lambda);
+   ConstantCoefficient *c_mu = dynamic_cast<ConstantCoefficient*>(mu);
+   if (c_mu && (c_lambda || !lambda))
+   {
+      mfem::Vector lame(2);
+      if (lambda)
+      {
+         lame(0) = c_lambda->constant;
+         lame(1) = c_mu->constant;
+      }
+      else
+      {
+         lame(0) = integ.GetLambdaFactor() * c_mu->constant;
+         lame(1) = integ.GetMuFactor() * c_mu->constant;
+      }
+      return new VectorConstantCoefficient(lame);
+   }
+   VectorArrayCoefficient *lame = new VectorArrayCoefficient(2);
+   if (lambda)
+   {
+      lame->Set(0, lambda, false);
+      lame->Set(1, mu, false);
+   }
+   else
+   {
+      lame->Set(0, new ProductCoefficient(integ.GetLambdaFactor(), *mu));
+      lame->Set(1, new ProductCoefficient(integ.GetMuFactor(), *mu));
+   }
+   return lame;
+}
+
+} // namespace ceed
+
+} // namespace mfem
@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_LIBCEED_ELAST_HPP
+#define MFEM_LIBCEED_ELAST_HPP
+
+#include "../../interface/integrator.hpp"
+#include "../../interface/mixed_integrator.hpp"
+#include "../../../fespace.hpp"
+
+namespace mfem
+{
+
+namespace ceed
+{
+
+/// Represent an ElasticityIntegrator with AssemblyLevel::Partial using libCEED.
+/// The coefficient @a Q has the two components (lambda, mu).
+class PAElasticityIntegrator : public PAIntegrator
+{
+public:
+   PAElasticityIntegrator(const mfem::FiniteElementSpace &fes,
+                          const mfem::IntegrationRule &ir,
+                          mfem::VectorCoefficient *Q);
+};
+
+class MixedPAElasticityIntegrator : public MixedIntegrator<PAIntegrator>
+{
+public:
+   MixedPAElasticityIntegrator(const ElasticityIntegrator &integ,
+                               const mfem::FiniteElementSpace &fes,
+                               mfem::VectorCoefficient *Q);
+};
+
+/// Represent an ElasticityIntegrator with AssemblyLevel::None using libCEED.
+class MFElasticityIntegrator : public MFIntegrator
+{
+public:
+   MFElasticityIntegrator(const mfem::FiniteElementSpace &fes,
+                          const mfem::IntegrationRule &ir,
+                          mfem::VectorCoefficient *Q);
+};
+
+class MixedMFElasticityIntegrator : public MixedIntegrator<MFIntegrator>
+{
+public:
+   MixedMFElasticityIntegrator(const ElasticityIntegrator &integ,
+                               const mfem::FiniteElementSpace &fes,
+                               mfem::VectorCoefficient *Q);
+};
+
+/** @brief Return a new two component coefficient (lambda, mu) describing the
+    Lame parameters of @a integ. The returned coefficient is owned by the
+    caller and references the coefficients of @a integ. */
+mfem::VectorCoefficient *NewLameCoefficient(const ElasticityIntegrator &integ);
+
+}
+
+}
+
+#endif // MFEM_LIBCEED_ELAST_HPP
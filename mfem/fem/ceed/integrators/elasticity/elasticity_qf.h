@@ -0,0 +1,302 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+/// A structure used to pass additional data to f_build_elast and f_apply_elast
+/// The coefficient holds the Lame parameters (lambda, mu).
+struct ElasticityContext { CeedInt dim, space_dim, vdim; CeedScalar coeff[2]; };
+
+/// Compute the inverse of the Jacobian at the quadrature point i, stored with
+/// shape [dim, dim] in Jinv, and return the determinant of the Jacobian.
+CEED_QFUNCTION_HELPER CeedScalar ElastJacobianInverse(const CeedInt dim,
+                                                      const CeedInt i,
+                                                      const CeedInt Q,
+                                                      const CeedScalar *J,
+                                                      CeedScalar *Jinv)
+{
+   if (dim == 2)
+   {
+      // J: 0 2
+      //    1 3
+      const CeedScalar J11 = J[i + Q * 0];
+      const CeedScalar J21 = J[i + Q * 1];
+      const CeedScalar J12 = J[i + Q * 2];
+      const CeedScalar J22 = J[i + Q * 3];
+      const CeedScalar det = J11 * J22 - J21 * J12;
+      Jinv[0] =  J22 / det;
+      Jinv[1] = -J21 / det;
+      Jinv[2] = -J12 / det;
+      Jinv[3] =  J11 / det;
+      return det;
+   }
+   // J: 0 3 6
+   //    1 4 7
+   //    2 5 8
+   const CeedScalar J11 = J[i + Q * 0];
+   const CeedScalar J21 = J[i + Q * 1];
+   const CeedScalar J31 = J[i + Q * 2];
+   const CeedScalar J12 = J[i + Q * 3];
+   const CeedScalar J22 = J[i + Q * 4];
+   const CeedScalar J32 = J[i + Q * 5];
+   const CeedScalar J13 = J[i + Q * 6];
+   const CeedScalar J23 = J[i + Q * 7];
+   const CeedScalar J33 = J[i + Q * 8];
+   const CeedScalar A11 = J22 * J33 - J23 * J32;
+   const CeedScalar A12 = J13 * J32 - J12 * J33;
+   const CeedScalar A13 = J12 * J23 - J13 * J22;
+   const CeedScalar A21 = J23 * J31 - J21 * J33;
+   const CeedScalar A22 = J11 * J33 - J13 * J31;
+   const CeedScalar A23 = J13 * J21 - J11 * J23;
+   const CeedScalar A31 = J21 * J32 - J22 * J31;
+   const CeedScalar A32 = J12 * J31 - J11 * J32;
+   const CeedScalar A33 = J11 * J22 - J12 * J21;
+   const CeedScalar det = J11 * A11 + J21 * A12 + J31 * A13;
+   Jinv[0] = A11 / det;
+   Jinv[1] = A21 / det;
+   Jinv[2] = A31 / det;
+   Jinv[3] = A12 / det;
+   Jinv[4] = A22 / det;
+   Jinv[5] = A32 / det;
+   Jinv[6] = A13 / det;
+   Jinv[7] = A23 / det;
+   Jinv[8] = A33 / det;
+   return det;
+}
+
+/// Apply the linear elasticity operator at the quadrature point i: the
+/// reference gradients ug, with shape [nc=dim, dim, Q], are mapped to the
+/// physical gradient G, the stress lambda div(u) I + mu (G + G^T) is computed
+/// and pulled back to the reference gradients of the test functions vg.
+CEED_QFUNCTION_HELPER void ElastApply(const CeedInt dim, const CeedInt i,
+                                      const CeedInt Q,
+                                      const CeedScalar lambda,
+                                      const CeedScalar mu,
+                                      const CeedScalar *Jinv,
+                                      const CeedScalar *ug, CeedScalar *vg)
+{
+   CeedScalar G[9], S[9];
+   CeedScalar div = 0.0;
+   for (CeedInt c = 0; c < dim; c++)
+   {
+      for (CeedInt k = 0; k < dim; k++)
+      {
+         CeedScalar g = 0.0;
+         for (CeedInt d = 0; d < dim; d++)
+         {
+            g += ug[i + Q * (c + dim * d)] * Jinv[d + dim * k];
+         }
+         G[c + dim * k] = g;
+      }
+      div += G[c + dim * c];
+   }
+   for (CeedInt c = 0; c < dim; c++)
+   {
+      for (CeedInt k = 0; k < dim; k++)
+      {
+         S[c + dim * k] = mu * (G[c + dim * k] + G[k + dim * c]);
+      }
+      S[c + dim * c] += lambda * div;
+   }
+   for (CeedInt c = 0; c < dim; c++)
+   {
+      for (CeedInt d = 0; d < dim; d++)
+      {
+         CeedScalar s = 0.0;
+         for (CeedInt k = 0; k < dim; k++)
+         {
+            s += S[c + dim * k] * Jinv[d + dim * k];
+         }
+         vg[i + Q * (c + dim * d)] = s;
+      }
+   }
+}
+
+/// libCEED Q-function for building quadrature data for an elasticity operator
+/// with constant Lame parameters
+CEED_QFUNCTION(f_build_elast_const)(void *ctx, CeedInt Q,
+                                    const CeedScalar *const *in,
+                                    CeedScalar *const *out)
+{
+   ElasticityContext *bc = (ElasticityContext*)ctx;
+   // in[0] is Jacobians with shape [dim, nc=dim, Q]
+   // in[1] is quadrature weights, size (Q)
+   //
+   // At every quadrature point, compute and store qw.det(J).lambda,
+   // qw.det(J).mu and J^{-1}.
+   const CeedScalar lambda = bc->coeff[0], mu = bc->coeff[1];
+   const CeedScalar *J = in[0], *qw = in[1];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[4];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(2, i, Q, J, Jinv);
+            qd[i + Q * 0] = w * lambda;
+            qd[i + Q * 1] = w * mu;
+            for (CeedInt k = 0; k < 4; k++) { qd[i + Q * (2 + k)] = Jinv[k]; }
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[9];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(3, i, Q, J, Jinv);
+            qd[i + Q * 0] = w * lambda;
+            qd[i + Q * 1] = w * mu;
+            for (CeedInt k = 0; k < 9; k++) { qd[i + Q * (2 + k)] = Jinv[k]; }
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for building quadrature data for an elasticity operator
+/// with Lame parameters evaluated at quadrature points.
+CEED_QFUNCTION(f_build_elast_quad)(void *ctx, CeedInt Q,
+                                   const CeedScalar *const *in,
+                                   CeedScalar *const *out)
+{
+   ElasticityContext *bc = (ElasticityContext*)ctx;
+   // in[0] is the Lame parameters with shape [nc=2, Q]
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   const CeedScalar *c = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[4];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(2, i, Q, J, Jinv);
+            qd[i + Q * 0] = w * c[i + Q * 0];
+            qd[i + Q * 1] = w * c[i + Q * 1];
+            for (CeedInt k = 0; k < 4; k++) { qd[i + Q * (2 + k)] = Jinv[k]; }
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[9];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(3, i, Q, J, Jinv);
+            qd[i + Q * 0] = w * c[i + Q * 0];
+            qd[i + Q * 1] = w * c[i + Q * 1];
+            for (CeedInt k = 0; k < 9; k++) { qd[i + Q * (2 + k)] = Jinv[k]; }
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying an elasticity operator
+CEED_QFUNCTION(f_apply_elast)(void *ctx, CeedInt Q,
+                              const CeedScalar *const *in,
+                              CeedScalar *const *out)
+{
+   ElasticityContext *bc = (ElasticityContext*)ctx;
+   // in[0], out[0] have shape [nc=dim, dim, Q]
+   // in[1] is the quadrature data with shape [2 + dim*dim, Q]
+   const CeedScalar *ug = in[0], *qd = in[1];
+   CeedScalar *vg = out[0];
+   switch (bc->dim)
+   {
+      case 2:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[4];
+            for (CeedInt k = 0; k < 4; k++) { Jinv[k] = qd[i + Q * (2 + k)]; }
+            ElastApply(2, i, Q, qd[i + Q * 0], qd[i + Q * 1], Jinv, ug, vg);
+         }
+         break;
+      case 3:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[9];
+            for (CeedInt k = 0; k < 9; k++) { Jinv[k] = qd[i + Q * (2 + k)]; }
+            ElastApply(3, i, Q, qd[i + Q * 0], qd[i + Q * 1], Jinv, ug, vg);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying an elasticity operator with constant Lame
+/// parameters
+CEED_QFUNCTION(f_apply_elast_mf_const)(void *ctx, CeedInt Q,
+                                       const CeedScalar *const *in,
+                                       CeedScalar *const *out)
+{
+   ElasticityContext *bc = (ElasticityContext*)ctx;
+   // in[0], out[0] have shape [nc=dim, dim, Q]
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   const CeedScalar lambda = bc->coeff[0], mu = bc->coeff[1];
+   const CeedScalar *ug = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *vg = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[4];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(2, i, Q, J, Jinv);
+            ElastApply(2, i, Q, w * lambda, w * mu, Jinv, ug, vg);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[9];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(3, i, Q, J, Jinv);
+            ElastApply(3, i, Q, w * lambda, w * mu, Jinv, ug, vg);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying an elasticity operator with Lame
+/// parameters evaluated at quadrature points
+CEED_QFUNCTION(f_apply_elast_mf_quad)(void *ctx, CeedInt Q,
+                                      const CeedScalar *const *in,
+                                      CeedScalar *const *out)
+{
+   ElasticityContext *bc = (ElasticityContext*)ctx;
+   // in[0] is the Lame parameters with shape [nc=2, Q]
+   // in[1], out[0] have shape [nc=dim, dim, Q]
+   // in[2] is Jacobians with shape [dim, nc=dim, Q]
+   // in[3] is quadrature weights, size (Q)
+   const CeedScalar *c = in[0], *ug = in[1], *J = in[2], *qw = in[3];
+   CeedScalar *vg = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[4];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(2, i, Q, J, Jinv);
+            ElastApply(2, i, Q, w * c[i + Q * 0], w * c[i + Q * 1], Jinv,
+                       ug, vg);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar Jinv[9];
+            const CeedScalar w = qw[i] * ElastJacobianInverse(3, i, Q, J, Jinv);
+            ElastApply(3, i, Q, w * c[i + Q * 0], w * c[i + Q * 1], Jinv,
+                       ug, vg);
+         }
+         break;
+   }
+   return 0;
+}
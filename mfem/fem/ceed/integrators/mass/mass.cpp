@@ -44,6 +44,30 @@ struct MassOperatorInfo : public OperatorInfo
       qdatasize = 1;
    }
 };
+
+struct VectorMassOperatorInfo : public OperatorInfo
+{
+   VectorMassContext ctx;
+   VectorMassOperatorInfo(int vdim)
+   {
+      MFEM_VERIFY(vdim <= 3, "VectorMassIntegrator with a vector coefficient"
+                  " is only supported for vdim <= 3");
+      header = "/integrators/mass/mass_qf.h";
+      build_func_const = ":f_build_vecmass_const";
+      build_qf_const = &f_build_vecmass_const;
+      build_func_quad = ":f_build_vecmass_quad";
+      build_qf_quad = &f_build_vecmass_quad;
+      apply_func = ":f_apply_vecmass";
+      apply_qf = &f_apply_vecmass;
+      apply_func_mf_const = ":f_apply_vecmass_mf_const";
+      apply_qf_mf_const = &f_apply_vecmass_mf_const;
+      apply_func_mf_quad = ":f_apply_vecmass_mf_quad";
+      apply_qf_mf_quad = &f_apply_vecmass_mf_quad;
+      trial_op = EvalMode::Interp;
+      test_op = EvalMode::Interp;
+      qdatasize = vdim;
+   }
+};
 #endif
 
 PAMassIntegrator::PAMassIntegrator(const mfem::FiniteElementSpace &fes,
@@ -59,6 +83,19 @@ PAMassIntegrator::PAMassIntegrator(const mfem::FiniteElementSpace &fes,
 #endif
 }
 
+PAMassIntegrator::PAMassIntegrator(const mfem::FiniteElementSpace &fes,
+                                   const mfem::IntegrationRule &irm,
+                                   mfem::VectorCoefficient *VQ)
+   : PAIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   VectorMassOperatorInfo info(fes.GetVDim());
+   Assemble(info, fes, irm, VQ);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
 MixedPAMassIntegrator::MixedPAMassIntegrator(const MassIntegrator &integ,
                                              const mfem::FiniteElementSpace &fes,
                                              mfem::Coefficient *Q)
@@ -83,6 +120,18 @@ MixedPAMassIntegrator::MixedPAMassIntegrator(const VectorMassIntegrator &integ,
 #endif
 }
 
+MixedPAMassIntegrator::MixedPAMassIntegrator(const VectorMassIntegrator &integ,
+                                             const mfem::FiniteElementSpace &fes,
+                                             mfem::VectorCoefficient *VQ)
+{
+#ifdef MFEM_USE_CEED
+   VectorMassOperatorInfo info(fes.GetVDim());
+   Assemble(integ, info, fes, VQ);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
 MFMassIntegrator::MFMassIntegrator(const mfem::FiniteElementSpace &fes,
                                    const mfem::IntegrationRule &irm,
                                    mfem::Coefficient *Q)
@@ -96,6 +145,19 @@ MFMassIntegrator::MFMassIntegrator(const mfem::FiniteElementSpace &fes,
 #endif
 }
 
+MFMassIntegrator::MFMassIntegrator(const mfem::FiniteElementSpace &fes,
+                                   const mfem::IntegrationRule &irm,
+                                   mfem::VectorCoefficient *VQ)
+   : MFIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   VectorMassOperatorInfo info(fes.GetVDim());
+   Assemble(info, fes, irm, VQ);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
 MixedMFMassIntegrator::MixedMFMassIntegrator(const MassIntegrator &integ,
                                              const mfem::FiniteElementSpace &fes,
                                              mfem::Coefficient *Q)
@@ -120,6 +182,18 @@ MixedMFMassIntegrator::MixedMFMassIntegrator(const VectorMassIntegrator &integ,
 #endif
 }
 
+MixedMFMassIntegrator::MixedMFMassIntegrator(const VectorMassIntegrator &integ,
+                                             const mfem::FiniteElementSpace &fes,
+                                             mfem::VectorCoefficient *VQ)
+{
+#ifdef MFEM_USE_CEED
+   VectorMassOperatorInfo info(fes.GetVDim());
+   Assemble(integ, info, fes, VQ);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
 } // namespace ceed
 
 } // namespace mfem
@@ -29,6 +29,11 @@ public:
    PAMassIntegrator(const mfem::FiniteElementSpace &fes,
                     const mfem::IntegrationRule &ir,
                     mfem::Coefficient *Q);
+
+   /// Vector mass operator with a diagonal coefficient, one entry per vdim.
+   PAMassIntegrator(const mfem::FiniteElementSpace &fes,
+                    const mfem::IntegrationRule &ir,
+                    mfem::VectorCoefficient *VQ);
 };
 
 class MixedPAMassIntegrator : public MixedIntegrator<PAIntegrator>
@@ -41,6 +46,10 @@ public:
    MixedPAMassIntegrator(const VectorMassIntegrator &integ,
                          const mfem::FiniteElementSpace &fes,
                          mfem::Coefficient *Q);
+
+   MixedPAMassIntegrator(const VectorMassIntegrator &integ,
+                         const mfem::FiniteElementSpace &fes,
+                         mfem::VectorCoefficient *VQ);
 };
 
 /// Represent a MassIntegrator with AssemblyLevel::None using libCEED.
@@ -50,6 +59,11 @@ public:
    MFMassIntegrator(const mfem::FiniteElementSpace &fes,
                     const mfem::IntegrationRule &ir,
                     mfem::Coefficient *Q);
+
+   /// Vector mass operator with a diagonal coefficient, one entry per vdim.
+   MFMassIntegrator(const mfem::FiniteElementSpace &fes,
+                    const mfem::IntegrationRule &ir,
+                    mfem::VectorCoefficient *VQ);
 };
 
 class MixedMFMassIntegrator : public MixedIntegrator<MFIntegrator>
@@ -62,6 +76,10 @@ public:
    MixedMFMassIntegrator(const VectorMassIntegrator &integ,
                          const mfem::FiniteElementSpace &fes,
                          mfem::Coefficient *Q);
+
+   MixedMFMassIntegrator(const VectorMassIntegrator &integ,
+                         const mfem::FiniteElementSpace &fes,
+                         mfem::VectorCoefficient *VQ);
 };
 
 }
@@ -268,3 +268,130 @@ CEED_QFUNCTION(f_apply_mass_mf_quad)(void *ctx, CeedInt Q,
    }
    return 0;
 }
+
+/// A structure used to pass additional data to f_build_vecmass and
+/// f_apply_vecmass, the coefficient has one entry per vector component.
+struct VectorMassContext { CeedInt dim, space_dim, vdim; CeedScalar coeff[3]; };
+
+/// Return the determinant of the Jacobian J, with stride QJ between its
+/// entries, at a quadrature point.
+CEED_QFUNCTION_HELPER CeedScalar VecMassDetJ(const CeedInt dim,
+                                             const CeedScalar *J,
+                                             const CeedInt QJ)
+{
+   switch (dim)
+   {
+      case 1: return J[0];
+      case 2: return J[QJ*0]*J[QJ*3] - J[QJ*1]*J[QJ*2];
+      default:
+         return J[QJ*0]*(J[QJ*4]*J[QJ*8] - J[QJ*5]*J[QJ*7]) -
+                J[QJ*1]*(J[QJ*3]*J[QJ*8] - J[QJ*5]*J[QJ*6]) +
+                J[QJ*2]*(J[QJ*3]*J[QJ*7] - J[QJ*4]*J[QJ*6]);
+   }
+}
+
+/// libCEED Q-function for building quadrature data for a vector mass operator
+/// with a constant diagonal vector coefficient
+CEED_QFUNCTION(f_build_vecmass_const)(void *ctx, CeedInt Q,
+                                      const CeedScalar *const *in,
+                                      CeedScalar *const *out)
+{
+   // in[0] is Jacobians with shape [dim, nc=dim, Q]
+   // in[1] is quadrature weights, size (Q)
+   // out[0] has shape [vdim, Q]
+   VectorMassContext *bc = (VectorMassContext *)ctx;
+   const CeedInt dim = bc->dim, vdim = bc->vdim;
+   const CeedScalar *J = in[0], *qw = in[1];
+   CeedScalar *rho = out[0];
+   for (CeedInt i=0; i<Q; i++)
+   {
+      const CeedScalar w = VecMassDetJ(dim, J + i, Q) * qw[i];
+      for (CeedInt c = 0; c < vdim; c++)
+      {
+         rho[i+c*Q] = bc->coeff[c] * w;
+      }
+   }
+   return 0;
+}
+
+/// libCEED Q-function for building quadrature data for a vector mass operator
+/// with a diagonal vector coefficient evaluated at quadrature points.
+CEED_QFUNCTION(f_build_vecmass_quad)(void *ctx, CeedInt Q,
+                                     const CeedScalar *const *in,
+                                     CeedScalar *const *out)
+{
+   // in[0] is coefficients with shape [vdim, Q]
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   VectorMassContext *bc = (VectorMassContext *)ctx;
+   const CeedInt dim = bc->dim, vdim = bc->vdim;
+   const CeedScalar *c = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *rho = out[0];
+   for (CeedInt i=0; i<Q; i++)
+   {
+      const CeedScalar w = VecMassDetJ(dim, J + i, Q) * qw[i];
+      for (CeedInt d = 0; d < vdim; d++)
+      {
+         rho[i+d*Q] = c[i+d*Q] * w;
+      }
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a vector mass operator
+CEED_QFUNCTION(f_apply_vecmass)(void *ctx, CeedInt Q,
+                                const CeedScalar *const *in,
+                                CeedScalar *const *out)
+{
+   VectorMassContext *bc = (VectorMassContext *)ctx;
+   const CeedInt vdim = bc->vdim;
+   const CeedScalar *u = in[0], *w = in[1];
+   CeedScalar *v = out[0];
+   for (CeedInt i=0; i<Q*vdim; i++)
+   {
+      v[i] = w[i] * u[i];
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a vector mass operator with a constant
+/// diagonal vector coefficient
+CEED_QFUNCTION(f_apply_vecmass_mf_const)(void *ctx, CeedInt Q,
+                                         const CeedScalar *const *in,
+                                         CeedScalar *const *out)
+{
+   VectorMassContext *bc = (VectorMassContext *)ctx;
+   const CeedInt dim = bc->dim, vdim = bc->vdim;
+   const CeedScalar *u = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *v = out[0];
+   for (CeedInt i=0; i<Q; i++)
+   {
+      const CeedScalar w = VecMassDetJ(dim, J + i, Q) * qw[i];
+      for (CeedInt c = 0; c < vdim; c++)
+      {
+         v[i+c*Q] = bc->coeff[c] * w * u[i+c*Q];
+      }
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a vector mass operator with a diagonal
+/// vector coefficient evaluated at quadrature points
+CEED_QFUNCTION(f_apply_vecmass_mf_quad)(void *ctx, CeedInt Q,
+                                        const CeedScalar *const *in,
+                                        CeedScalar *const *out)
+{
+   VectorMassContext *bc = (VectorMassContext *)ctx;
+   const CeedInt dim = bc->dim, vdim = bc->vdim;
+   const CeedScalar *c = in[0], *u = in[1], *J = in[2], *qw = in[3];
+   CeedScalar *v = out[0];
+   for (CeedInt i=0; i<Q; i++)
+   {
+      const CeedScalar w = VecMassDetJ(dim, J + i, Q) * qw[i];
+      for (CeedInt d = 0; d < vdim; d++)
+      {
+         v[i+d*Q] = c[i+d*Q] * w * u[i+d*Q];
+      }
+   }
+   return 0;
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "vecfemass.hpp"
+
+#include "../../../../config/config.hpp"
+#ifdef MFEM_USE_CEED
+#include "vecfemass_qf.h"
+#endif
+
+namespace mfem
+{
+
+namespace ceed
+{
+
+#ifdef MFEM_USE_CEED
+struct VectorFEMassOperatorInfo : public OperatorInfo
+{
+   VectorFEMassContext ctx;
+   VectorFEMassOperatorInfo(const mfem::FiniteElementSpace &fes)
+   {
+      const int dim = fes.GetMesh()->Dimension();
+      header = "/integrators/vecfemass/vecfemass_qf.h";
+      build_func_const = ":f_build_vecfemass_const";
+      build_qf_const = &f_build_vecfemass_const;
+      build_func_quad = ":f_build_vecfemass_quad";
+      build_qf_quad = &f_build_vecfemass_quad;
+      apply_func = ":f_apply_vecfemass";
+      apply_qf = &f_apply_vecfemass;
+      apply_func_mf_const = ":f_apply_vecfemass_mf_const";
+      apply_qf_mf_const = &f_apply_vecfemass_mf_const;
+      apply_func_mf_quad = ":f_apply_vecfemass_mf_quad";
+      apply_qf_mf_quad = &f_apply_vecfemass_mf_quad;
+      trial_op = EvalMode::Interp;
+      test_op = EvalMode::Interp;
+      qdatasize = dim*(dim+1)/2;
+      ctx.hdiv = fes.GetFE(0)->GetMapType() == FiniteElement::H_DIV;
+   }
+};
+#endif
+
+PAVectorFEMassIntegrator::PAVectorFEMassIntegrator(
+   const mfem::FiniteElementSpace &fes,
+   const mfem::IntegrationRule &irm,
+   mfem::Coefficient *Q)
+   : PAIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   VectorFEMassOperatorInfo info(fes);
+   Assemble(info, fes, irm, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MixedPAVectorFEMassIntegrator::MixedPAVectorFEMassIntegrator(
+   const VectorFEMassIntegrator &integ,
+   const mfem::FiniteElementSpace &fes,
+   mfem::Coefficient *Q)
+{
+#ifdef MFEM_USE_CEED
+   VectorFEMassOperatorInfo info(fes);
+   Assemble(integ, info, fes, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MFVectorFEMassIntegrator::MFVectorFEMassIntegrator(
+   const mfem::FiniteElementSpace &fes,
+   const mfem::IntegrationRule &irm,
+   mfem::Coefficient *Q)
+   : MFIntegrator()
+{
+#ifdef MFEM_USE_CEED
+   VectorFEMassOperatorInfo info(fes);
+   Assemble(info, fes, irm, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+MixedMFVectorFEMassIntegrator::MixedMFVectorFEMassIntegrator(
+   const VectorFEMassIntegrator &integ,
+   const mfem::FiniteElementSpace &fes,
+   mfem::Coefficient *Q)
+{
+#ifdef MFEM_USE_CEED
+   VectorFEMassOperatorInfo info(fes);
+   Assemble(integ, info, fes, Q);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+} // namespace ceed
+
+} // namespace mfem
@@ -0,0 +1,63 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_LIBCEED_VECFEMASS_HPP
+#define MFEM_LIBCEED_VECFEMASS_HPP
+
+#include "../../interface/integrator.hpp"
+#include "../../interface/mixed_integrator.hpp"
+#include "../../../fespace.hpp"
+
+namespace mfem
+{
+
+namespace ceed
+{
+
+/// Represent a VectorFEMassIntegrator with AssemblyLevel::Partial using libCEED.
+class PAVectorFEMassIntegrator : public PAIntegrator
+{
+public:
+   PAVectorFEMassIntegrator(const mfem::FiniteElementSpace &fes,
+                            const mfem::IntegrationRule &ir,
+                            mfem::Coefficient *Q);
+};
+
+class MixedPAVectorFEMassIntegrator : public MixedIntegrator<PAIntegrator>
+{
+public:
+   MixedPAVectorFEMassIntegrator(const VectorFEMassIntegrator &integ,
+                                 const mfem::FiniteElementSpace &fes,
+                                 mfem::Coefficient *Q);
+};
+
+/// Represent a VectorFEMassIntegrator with AssemblyLevel::None using libCEED.
+class MFVectorFEMassIntegrator : public MFIntegrator
+{
+public:
+   MFVectorFEMassIntegrator(const mfem::FiniteElementSpace &fes,
+                            const mfem::IntegrationRule &ir,
+                            mfem::Coefficient *Q);
+};
+
+class MixedMFVectorFEMassIntegrator : public MixedIntegrator<MFIntegrator>
+{
+public:
+   MixedMFVectorFEMassIntegrator(const VectorFEMassIntegrator &integ,
+                                 const mfem::FiniteElementSpace &fes,
+                                 mfem::Coefficient *Q);
+};
+
+}
+
+}
+
+#endif // MFEM_LIBCEED_VECFEMASS_HPP
@@ -0,0 +1,279 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+/// A structure used to pass additional data to f_build_vecfemass and
+/// f_apply_vecfemass. hdiv is nonzero for H(div) and zero for H(curl) spaces.
+struct VectorFEMassContext
+{
+   CeedInt dim, space_dim, vdim, hdiv;
+   CeedScalar coeff;
+};
+
+/// Compute the symmetric quadrature data qd, with stride Qd between its
+/// components, of a vector FE mass operator at a quadrature point with
+/// Jacobian J, with stride QJ between its entries, and scaling w = qw.coeff:
+/// w/det(J).adj(J).adj(J)^T for H(curl) and w/det(J).J^T.J for H(div).
+CEED_QFUNCTION_HELPER void VecFEMassQData(const CeedInt dim, const CeedInt hdiv,
+                                          const CeedScalar w,
+                                          const CeedScalar *J, const CeedInt QJ,
+                                          CeedScalar *qd, const CeedInt Qd)
+{
+   if (dim == 2)
+   {
+      // J: 0 2   qd: 0 1   adj(J):  J22 -J12
+      //    1 3       1 2           -J21  J11
+      const CeedScalar J11 = J[QJ * 0];
+      const CeedScalar J21 = J[QJ * 1];
+      const CeedScalar J12 = J[QJ * 2];
+      const CeedScalar J22 = J[QJ * 3];
+      const CeedScalar s = w / (J11 * J22 - J21 * J12);
+      if (hdiv)
+      {
+         qd[Qd * 0] = s * (J11 * J11 + J21 * J21);
+         qd[Qd * 1] = s * (J11 * J12 + J21 * J22);
+         qd[Qd * 2] = s * (J12 * J12 + J22 * J22);
+      }
+      else
+      {
+         qd[Qd * 0] =   s * (J12 * J12 + J22 * J22);
+         qd[Qd * 1] = - s * (J11 * J12 + J21 * J22);
+         qd[Qd * 2] =   s * (J11 * J11 + J21 * J21);
+      }
+      return;
+   }
+   // J: 0 3 6   qd: 0 1 2
+   //    1 4 7       1 3 4
+   //    2 5 8       2 4 5
+   const CeedScalar J11 = J[QJ * 0];
+   const CeedScalar J21 = J[QJ * 1];
+   const CeedScalar J31 = J[QJ * 2];
+   const CeedScalar J12 = J[QJ * 3];
+   const CeedScalar J22 = J[QJ * 4];
+   const CeedScalar J32 = J[QJ * 5];
+   const CeedScalar J13 = J[QJ * 6];
+   const CeedScalar J23 = J[QJ * 7];
+   const CeedScalar J33 = J[QJ * 8];
+   const CeedScalar A11 = J22 * J33 - J23 * J32;
+   const CeedScalar A12 = J13 * J32 - J12 * J33;
+   const CeedScalar A13 = J12 * J23 - J13 * J22;
+   const CeedScalar A21 = J23 * J31 - J21 * J33;
+   const CeedScalar A22 = J11 * J33 - J13 * J31;
+   const CeedScalar A23 = J13 * J21 - J11 * J23;
+   const CeedScalar A31 = J21 * J32 - J22 * J31;
+   const CeedScalar A32 = J12 * J31 - J11 * J32;
+   const CeedScalar A33 = J11 * J22 - J12 * J21;
+   const CeedScalar s = w / (J11 * A11 + J21 * A12 + J31 * A13);
+   if (hdiv)
+   {
+      qd[Qd * 0] = s * (J11 * J11 + J21 * J21 + J31 * J31);
+      qd[Qd * 1] = s * (J11 * J12 + J21 * J22 + J31 * J32);
+      qd[Qd * 2] = s * (J11 * J13 + J21 * J23 + J31 * J33);
+      qd[Qd * 3] = s * (J12 * J12 + J22 * J22 + J32 * J32);
+      qd[Qd * 4] = s * (J12 * J13 + J22 * J23 + J32 * J33);
+      qd[Qd * 5] = s * (J13 * J13 + J23 * J23 + J33 * J33);
+   }
+   else
+   {
+      qd[Qd * 0] = s * (A11 * A11 + A12 * A12 + A13 * A13);
+      qd[Qd * 1] = s * (A11 * A21 + A12 * A22 + A13 * A23);
+      qd[Qd * 2] = s * (A11 * A31 + A12 * A32 + A13 * A33);
+      qd[Qd * 3] = s * (A21 * A21 + A22 * A22 + A23 * A23);
+      qd[Qd * 4] = s * (A21 * A31 + A22 * A32 + A23 * A33);
+      qd[Qd * 5] = s * (A31 * A31 + A32 * A32 + A33 * A33);
+   }
+}
+
+/// Apply the symmetric quadrature data qd, with stride Qd between its
+/// components, to the reference values u at a quadrature point. The
+/// components of u and v have stride Q.
+CEED_QFUNCTION_HELPER void VecFEMassApply(const CeedInt dim,
+                                          const CeedScalar *qd,
+                                          const CeedInt Qd,
+                                          const CeedScalar *u, CeedScalar *v,
+                                          const CeedInt Q)
+{
+   if (dim == 2)
+   {
+      const CeedScalar u0 = u[Q * 0];
+      const CeedScalar u1 = u[Q * 1];
+      v[Q * 0] = qd[Qd * 0] * u0 + qd[Qd * 1] * u1;
+      v[Q * 1] = qd[Qd * 1] * u0 + qd[Qd * 2] * u1;
+      return;
+   }
+   const CeedScalar u0 = u[Q * 0];
+   const CeedScalar u1 = u[Q * 1];
+   const CeedScalar u2 = u[Q * 2];
+   v[Q * 0] = qd[Qd * 0] * u0 + qd[Qd * 1] * u1 + qd[Qd * 2] * u2;
+   v[Q * 1] = qd[Qd * 1] * u0 + qd[Qd * 3] * u1 + qd[Qd * 4] * u2;
+   v[Q * 2] = qd[Qd * 2] * u0 + qd[Qd * 4] * u1 + qd[Qd * 5] * u2;
+}
+
+/// libCEED Q-function for building quadrature data for a vector FE mass
+/// operator with a constant coefficient
+CEED_QFUNCTION(f_build_vecfemass_const)(void *ctx, CeedInt Q,
+                                        const CeedScalar *const *in,
+                                        CeedScalar *const *out)
+{
+   VectorFEMassContext *bc = (VectorFEMassContext*)ctx;
+   // in[0] is Jacobians with shape [dim, nc=dim, Q]
+   // in[1] is quadrature weights, size (Q)
+   const CeedScalar coeff = bc->coeff;
+   const CeedInt hdiv = bc->hdiv;
+   const CeedScalar *J = in[0], *qw = in[1];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            VecFEMassQData(2, hdiv, coeff * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            VecFEMassQData(3, hdiv, coeff * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for building quadrature data for a vector FE mass
+/// operator with a coefficient evaluated at quadrature points.
+CEED_QFUNCTION(f_build_vecfemass_quad)(void *ctx, CeedInt Q,
+                                       const CeedScalar *const *in,
+                                       CeedScalar *const *out)
+{
+   VectorFEMassContext *bc = (VectorFEMassContext*)ctx;
+   // in[0] is coefficients, size (Q)
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   const CeedInt hdiv = bc->hdiv;
+   const CeedScalar *c = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            VecFEMassQData(2, hdiv, c[i] * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            VecFEMassQData(3, hdiv, c[i] * qw[i], J + i, Q, qd + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a vector FE mass operator
+CEED_QFUNCTION(f_apply_vecfemass)(void *ctx, CeedInt Q,
+                                  const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+   VectorFEMassContext *bc = (VectorFEMassContext*)ctx;
+   // in[0], out[0] are the reference values with shape [dim, Q]
+   // in[1] is the quadrature data with shape [dim*(dim+1)/2, Q]
+   const CeedScalar *u = in[0], *qd = in[1];
+   CeedScalar *v = out[0];
+   switch (bc->dim)
+   {
+      case 2:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            VecFEMassApply(2, qd + i, Q, u + i, v + i, Q);
+         }
+         break;
+      case 3:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            VecFEMassApply(3, qd + i, Q, u + i, v + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a vector FE mass operator with a constant
+/// coefficient
+CEED_QFUNCTION(f_apply_vecfemass_mf_const)(void *ctx, CeedInt Q,
+                                           const CeedScalar *const *in,
+                                           CeedScalar *const *out)
+{
+   VectorFEMassContext *bc = (VectorFEMassContext*)ctx;
+   // in[0], out[0] are the reference values with shape [dim, Q]
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   const CeedScalar coeff = bc->coeff;
+   const CeedInt hdiv = bc->hdiv;
+   const CeedScalar *u = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *v = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[3];
+            VecFEMassQData(2, hdiv, coeff * qw[i], J + i, Q, qd, 1);
+            VecFEMassApply(2, qd, 1, u + i, v + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[6];
+            VecFEMassQData(3, hdiv, coeff * qw[i], J + i, Q, qd, 1);
+            VecFEMassApply(3, qd, 1, u + i, v + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a vector FE mass operator with a
+/// coefficient evaluated at quadrature points
+CEED_QFUNCTION(f_apply_vecfemass_mf_quad)(void *ctx, CeedInt Q,
+                                          const CeedScalar *const *in,
+                                          CeedScalar *const *out)
+{
+   VectorFEMassContext *bc = (VectorFEMassContext*)ctx;
+   // in[0] is coefficients, size (Q)
+   // in[1], out[0] are the reference values with shape [dim, Q]
+   // in[2] is Jacobians with shape [dim, nc=dim, Q]
+   // in[3] is quadrature weights, size (Q)
+   const CeedInt hdiv = bc->hdiv;
+   const CeedScalar *c = in[0], *u = in[1], *J = in[2], *qw = in[3];
+   CeedScalar *v = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[3];
+            VecFEMassQData(2, hdiv, c[i] * qw[i], J + i, Q, qd, 1);
+            VecFEMassApply(2, qd, 1, u + i, v + i, Q);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            CeedScalar qd[6];
+            VecFEMassQData(3, hdiv, c[i] * qw[i], J + i, Q, qd, 1);
+            VecFEMassApply(3, qd, 1, u + i, v + i, Q);
+         }
+         break;
+   }
+   return 0;
+}
@@ -98,6 +98,64 @@ static void InitTensorBasis(const mfem::FiniteElementSpace &fes,
                            qW.GetData(), basis);
 }
 
+static void InitVectorBasis(const mfem::FiniteElementSpace &fes,
+                            const mfem::FiniteElement &fe,
+                            const mfem::IntegrationRule &ir,
+                            Ceed ceed, CeedBasis *basis)
+{
+   // H(curl) and H(div) bases in the native ordering of the element dofs, see
+   // InitRestriction. The reference values have layout [dim, Q, P], and so do
+   // the reference curls with curl_dim components.
+   const int dim = fe.GetDim();
+   const int ndofs = fe.GetDof();
+   const int nqpts = ir.GetNPoints();
+   const bool hcurl = fe.GetMapType() == mfem::FiniteElement::H_CURL;
+   MFEM_VERIFY(hcurl || fe.GetMapType() == mfem::FiniteElement::H_DIV,
+               "Only H(curl) and H(div) vector finite elements are supported.");
+   const int dcomp = hcurl ? fe.GetCurlDim() : 1;
+   mfem::DenseMatrix vshape(ndofs, dim), dshape(ndofs, dcomp);
+   mfem::Vector dshape_v(dshape.GetData(), ndofs);
+   mfem::Vector interp(dim*nqpts*ndofs), deriv(dcomp*nqpts*ndofs);
+   mfem::DenseMatrix qX(dim,nqpts);
+   mfem::Vector qW(nqpts);
+   for (int i = 0; i < nqpts; i++)
+   {
+      const mfem::IntegrationPoint &ip = ir.IntPoint(i);
+      qX(0,i) = ip.x;
+      if (dim>1) { qX(1,i) = ip.y; }
+      if (dim>2) { qX(2,i) = ip.z; }
+      qW(i) = ip.weight;
+      fe.CalcVShape(ip, vshape);
+      if (hcurl) { fe.CalcCurlShape(ip, dshape); }
+      else { fe.CalcDivShape(ip, dshape_v); }
+      for (int j = 0; j < ndofs; j++)
+      {
+         for (int d = 0; d < dim; d++)
+         {
+            interp((d*nqpts + i)*ndofs + j) = vshape(j, d);
+         }
+         for (int d = 0; d < dcomp; d++)
+         {
+            deriv((d*nqpts + i)*ndofs + j) = dshape(j, d);
+         }
+      }
+   }
+   if (hcurl)
+   {
+      CeedBasisCreateHcurl(ceed, GetCeedTopology(fe.GetGeomType()),
+                           fes.GetVDim(), ndofs, nqpts,
+                           interp.GetData(), deriv.GetData(),
+                           qX.GetData(), qW.GetData(), basis);
+   }
+   else
+   {
+      CeedBasisCreateHdiv(ceed, GetCeedTopology(fe.GetGeomType()),
+                          fes.GetVDim(), ndofs, nqpts,
+                          interp.GetData(), deriv.GetData(),
+                          qX.GetData(), qW.GetData(), basis);
+   }
+}
+
 static void InitBasisImpl(const FiniteElementSpace &fes,
                           const FiniteElement &fe,
                           const IntegrationRule &ir,
@@ -115,7 +173,11 @@ static void InitBasisImpl(const FiniteElementSpace &fes,
    // Init or retrieve key values
    if (basis_itr == mfem::internal::ceed_basis_map.end())
    {
-      if ( tensor )
+      if ( fe.GetRangeType() == mfem::FiniteElement::VECTOR )
+      {
+         InitVectorBasis(fes, fe, ir, ceed, basis);
+      }
+      else if ( tensor )
       {
          InitTensorBasis(fes, fe, ir, ceed, basis);
       }
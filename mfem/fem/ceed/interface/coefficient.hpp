@@ -206,7 +206,7 @@ void InitCoefficient(mfem::VectorCoefficient *VQ, mfem::Mesh &mesh,
    }
    else
    {
-      const int dim = mesh.Dimension();
+      const int dim = VQ->GetVDim();
       QuadCoefficient *ceedCoeff = new QuadCoefficient(dim);
       const int ne = mesh.GetNE();
       const int nq = ir.GetNPoints();
@@ -394,7 +394,7 @@ void InitCoefficientWithIndices(mfem::VectorCoefficient *VQ, mfem::Mesh &mesh,
    }
    else
    {
-      const int dim = mesh.Dimension();
+      const int dim = VQ->GetVDim();
       QuadCoefficient *ceedCoeff = new QuadCoefficient(dim);
       const int nq = ir.GetNPoints();
       ceedCoeff->coeff.SetSize(dim * nq * nelem);
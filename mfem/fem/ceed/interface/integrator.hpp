@@ -28,7 +28,7 @@ namespace ceed
 {
 
 /** The different evaluation modes available for PA and MF CeedIntegrator. */
-enum class EvalMode { None, Interp, Grad, InterpAndGrad };
+enum class EvalMode { None, Interp, Grad, InterpAndGrad, Curl };
 
 #ifdef MFEM_USE_CEED
 /** This structure is a template interface for the Assemble methods of
@@ -236,6 +236,22 @@ public:
                   " points.");
       CeedInt nqpts = trial_nqpts;
 
+      // Number of components of the values and curls at quadrature points,
+      // larger than vdim for vector finite elements.
+      CeedInt trial_icomp, trial_ccomp, test_icomp, test_ccomp;
+      CeedBasisGetNumQuadratureComponents(trial_basis, CEED_EVAL_INTERP,
+                                          &trial_icomp);
+      CeedBasisGetNumQuadratureComponents(trial_basis, CEED_EVAL_CURL,
+                                          &trial_ccomp);
+      CeedBasisGetNumQuadratureComponents(test_basis, CEED_EVAL_INTERP,
+                                          &test_icomp);
+      CeedBasisGetNumQuadratureComponents(test_basis, CEED_EVAL_CURL,
+                                          &test_ccomp);
+      trial_icomp *= trial_vdim;
+      trial_ccomp *= trial_vdim;
+      test_icomp *= test_vdim;
+      test_ccomp *= test_vdim;
+
       const int qdatasize = op.qdatasize;
       InitStridedRestriction(*mesh_fes, nelem, nqpts, qdatasize,
                              CEED_STRIDES_BACKEND,
@@ -317,15 +333,18 @@ public:
             CeedQFunctionAddInput(apply_qfunc, "u", trial_vdim, CEED_EVAL_NONE);
             break;
          case EvalMode::Interp:
-            CeedQFunctionAddInput(apply_qfunc, "u", trial_vdim, CEED_EVAL_INTERP);
+            CeedQFunctionAddInput(apply_qfunc, "u", trial_icomp, CEED_EVAL_INTERP);
             break;
          case EvalMode::Grad:
             CeedQFunctionAddInput(apply_qfunc, "gu", trial_vdim*dim, CEED_EVAL_GRAD);
             break;
          case EvalMode::InterpAndGrad:
-            CeedQFunctionAddInput(apply_qfunc, "u", trial_vdim, CEED_EVAL_INTERP);
+            CeedQFunctionAddInput(apply_qfunc, "u", trial_icomp, CEED_EVAL_INTERP);
             CeedQFunctionAddInput(apply_qfunc, "gu", trial_vdim*dim, CEED_EVAL_GRAD);
             break;
+         case EvalMode::Curl:
+            CeedQFunctionAddInput(apply_qfunc, "cu", trial_ccomp, CEED_EVAL_CURL);
+            break;
       }
       // qdata
       CeedQFunctionAddInput(apply_qfunc, "qdata", qdatasize, CEED_EVAL_NONE);
@@ -336,15 +355,18 @@ public:
             CeedQFunctionAddOutput(apply_qfunc, "v", test_vdim, CEED_EVAL_NONE);
             break;
          case EvalMode::Interp:
-            CeedQFunctionAddOutput(apply_qfunc, "v", test_vdim, CEED_EVAL_INTERP);
+            CeedQFunctionAddOutput(apply_qfunc, "v", test_icomp, CEED_EVAL_INTERP);
             break;
          case EvalMode::Grad:
             CeedQFunctionAddOutput(apply_qfunc, "gv", test_vdim*dim, CEED_EVAL_GRAD);
             break;
          case EvalMode::InterpAndGrad:
-            CeedQFunctionAddOutput(apply_qfunc, "v", test_vdim, CEED_EVAL_INTERP);
+            CeedQFunctionAddOutput(apply_qfunc, "v", test_icomp, CEED_EVAL_INTERP);
             CeedQFunctionAddOutput(apply_qfunc, "gv", test_vdim*dim, CEED_EVAL_GRAD);
             break;
+         case EvalMode::Curl:
+            CeedQFunctionAddOutput(apply_qfunc, "cv", test_ccomp, CEED_EVAL_CURL);
+            break;
       }
       CeedQFunctionSetContext(apply_qfunc, build_ctx);
 
@@ -367,6 +389,9 @@ public:
             CeedOperatorSetField(oper, "u", trial_restr, trial_basis, CEED_VECTOR_ACTIVE);
             CeedOperatorSetField(oper, "gu", trial_restr, trial_basis, CEED_VECTOR_ACTIVE);
             break;
+         case EvalMode::Curl:
+            CeedOperatorSetField(oper, "cu", trial_restr, trial_basis, CEED_VECTOR_ACTIVE);
+            break;
       }
       // qdata
       CeedOperatorSetField(oper, "qdata", restr_i, CEED_BASIS_COLLOCATED,
@@ -388,6 +413,9 @@ public:
             CeedOperatorSetField(oper, "v", test_restr, test_basis, CEED_VECTOR_ACTIVE);
             CeedOperatorSetField(oper, "gv", test_restr, test_basis, CEED_VECTOR_ACTIVE);
             break;
+         case EvalMode::Curl:
+            CeedOperatorSetField(oper, "cv", test_restr, test_basis, CEED_VECTOR_ACTIVE);
+            break;
       }
 
       CeedVectorCreate(ceed, trial_vdim*trial_fes.GetNDofs(), &u);
@@ -592,6 +620,22 @@ public:
                   " points.");
       CeedInt nqpts = trial_nqpts;
 
+      // Number of components of the values and curls at quadrature points,
+      // larger than vdim for vector finite elements.
+      CeedInt trial_icomp, trial_ccomp, test_icomp, test_ccomp;
+      CeedBasisGetNumQuadratureComponents(trial_basis, CEED_EVAL_INTERP,
+                                          &trial_icomp);
+      CeedBasisGetNumQuadratureComponents(trial_basis, CEED_EVAL_CURL,
+                                          &trial_ccomp);
+      CeedBasisGetNumQuadratureComponents(test_basis, CEED_EVAL_INTERP,
+                                          &test_icomp);
+      CeedBasisGetNumQuadratureComponents(test_basis, CEED_EVAL_CURL,
+                                          &test_ccomp);
+      trial_icomp *= trial_vdim;
+      trial_ccomp *= trial_vdim;
+      test_icomp *= test_vdim;
+      test_ccomp *= test_vdim;
+
       InitVector(*mesh.GetNodes(), node_coords);
 
       // Context data to be passed to the Q-function.
@@ -620,7 +664,7 @@ public:
                                   CEED_EVAL_NONE);
             break;
          case EvalMode::Interp:
-            CeedQFunctionAddInput(apply_qfunc, "u", trial_vdim,
+            CeedQFunctionAddInput(apply_qfunc, "u", trial_icomp,
                                   CEED_EVAL_INTERP);
             break;
          case EvalMode::Grad:
@@ -628,11 +672,15 @@ public:
                                   CEED_EVAL_GRAD);
             break;
          case EvalMode::InterpAndGrad:
-            CeedQFunctionAddInput(apply_qfunc, "u", trial_vdim,
+            CeedQFunctionAddInput(apply_qfunc, "u", trial_icomp,
                                   CEED_EVAL_INTERP);
             CeedQFunctionAddInput(apply_qfunc, "gu", trial_vdim*dim,
                                   CEED_EVAL_GRAD);
             break;
+         case EvalMode::Curl:
+            CeedQFunctionAddInput(apply_qfunc, "cu", trial_ccomp,
+                                  CEED_EVAL_CURL);
+            break;
       }
       CeedQFunctionAddInput(apply_qfunc, "dx", dim * dim, CEED_EVAL_GRAD);
       CeedQFunctionAddInput(apply_qfunc, "weights", 1, CEED_EVAL_WEIGHT);
@@ -644,7 +692,7 @@ public:
                                    CEED_EVAL_NONE);
             break;
          case EvalMode::Interp:
-            CeedQFunctionAddOutput(apply_qfunc, "v", test_vdim,
+            CeedQFunctionAddOutput(apply_qfunc, "v", test_icomp,
                                    CEED_EVAL_INTERP);
             break;
          case EvalMode::Grad:
@@ -652,11 +700,15 @@ public:
                                    CEED_EVAL_GRAD);
             break;
          case EvalMode::InterpAndGrad:
-            CeedQFunctionAddOutput(apply_qfunc, "v", test_vdim,
+            CeedQFunctionAddOutput(apply_qfunc, "v", test_icomp,
                                    CEED_EVAL_INTERP);
             CeedQFunctionAddOutput(apply_qfunc, "gv", test_vdim*dim,
                                    CEED_EVAL_GRAD);
             break;
+         case EvalMode::Curl:
+            CeedQFunctionAddOutput(apply_qfunc, "cv", test_ccomp,
+                                   CEED_EVAL_CURL);
+            break;
       }
 
       CeedQFunctionContextCreate(ceed, &build_ctx);
@@ -708,6 +760,10 @@ public:
             CeedOperatorSetField(oper, "gu", trial_restr, trial_basis,
                                  CEED_VECTOR_ACTIVE);
             break;
+         case EvalMode::Curl:
+            CeedOperatorSetField(oper, "cu", trial_restr, trial_basis,
+                                 CEED_VECTOR_ACTIVE);
+            break;
       }
       CeedOperatorSetField(oper, "dx", mesh_restr,
                            mesh_basis, node_coords);
@@ -734,6 +790,10 @@ public:
             CeedOperatorSetField(oper, "gv", test_restr, test_basis,
                                  CEED_VECTOR_ACTIVE);
             break;
+         case EvalMode::Curl:
+            CeedOperatorSetField(oper, "cv", test_restr, test_basis,
+                                 CEED_VECTOR_ACTIVE);
+            break;
       }
 
       CeedVectorCreate(ceed, trial_vdim*trial_fes.GetNDofs(), &u);
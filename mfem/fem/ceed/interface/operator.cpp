@@ -126,6 +126,80 @@ void Operator::GetDiagonal(mfem::Vector &diag) const
 #endif
 }
 
+#ifdef MFEM_USE_CEED
+/// Call @a f on each non-composite CeedOperator of @a op.
+template <typename F>
+static void ForEachSubOperator(CeedOperator op, F &&f)
+{
+   bool is_composite;
+   CeedOperatorIsComposite(op, &is_composite);
+   if (!is_composite) { f(op); return; }
+   CeedInt nsub;
+   CeedOperator *subs;
+   CeedCompositeOperatorGetNumSub(op, &nsub);
+   CeedCompositeOperatorGetSubList(op, &subs);
+   for (CeedInt i = 0; i < nsub; i++) { f(subs[i]); }
+}
+#endif
+
+CompositeOperator::CompositeOperator(const mfem::Array<Operator*> &ops)
+{
+#ifdef MFEM_USE_CEED
+   MFEM_VERIFY(GetNumSubOperators(ops) <= CEED_COMPOSITE_MAX,
+               "Too many operators for a single composite CeedOperator.");
+   int ierr = CeedCompositeOperatorCreate(internal::ceed, &oper);
+   PCeedChk(ierr);
+   for (Operator *op : ops)
+   {
+      ForEachSubOperator(op->GetCeedOperator(), [&](CeedOperator sub)
+      {
+         int err = CeedCompositeOperatorAddSub(oper, sub); PCeedChk(err);
+      });
+   }
+   CeedSize in_len, out_len;
+   ierr = CeedOperatorGetActiveVectorLengths(oper, &in_len, &out_len);
+   PCeedChk(ierr);
+   height = out_len;
+   width = in_len;
+   MFEM_VERIFY(height == out_len, "height overflow");
+   MFEM_VERIFY(width == in_len, "width overflow");
+   CeedVectorCreate(internal::ceed, height, &v);
+   CeedVectorCreate(internal::ceed, width, &u);
+#else
+   MFEM_ABORT("MFEM must be built with MFEM_USE_CEED=YES to use libCEED.");
+#endif
+}
+
+int CompositeOperator::GetNumSubOperators(const mfem::Array<Operator*> &ops)
+{
+   int nsub = 0;
+#ifdef MFEM_USE_CEED
+   for (Operator *op : ops)
+   {
+      ForEachSubOperator(op->GetCeedOperator(), [&](CeedOperator) { nsub++; });
+   }
+#endif
+   return nsub;
+}
+
+Operator *NewCompositeOperator(const mfem::Array<Operator*> &ops)
+{
+#ifdef MFEM_USE_CEED
+   if (ops.Size() < 2) { return nullptr; }
+   for (Operator *op : ops)
+   {
+      if (!op || !op->GetCeedOperator()) { return nullptr; }
+   }
+   if (CompositeOperator::GetNumSubOperators(ops) > CEED_COMPOSITE_MAX)
+   {
+      return nullptr;
+   }
+   return new CompositeOperator(ops);
+#else
+   return nullptr;
+#endif
+}
+
 } // namespace ceed
 
 } // namespace mfem
@@ -56,6 +56,25 @@ public:
 #endif
 };
 
+/** @brief A ceed::Operator representing the sum of several ceed::Operator
+    acting on the same vectors, applied through a single composite
+    CeedOperator. */
+class CompositeOperator : public Operator
+{
+public:
+   /** The operators in @a ops are not owned: the underlying CeedOperator are
+       reference counted by libCEED. Composite operators in @a ops are
+       flattened since libCEED does not support nested composite operators. */
+   CompositeOperator(const mfem::Array<Operator*> &ops);
+
+   /// Return the number of CeedOperator to combine in order to represent @a ops.
+   static int GetNumSubOperators(const mfem::Array<Operator*> &ops);
+};
+
+/** @brief Return a new CompositeOperator representing the sum of @a ops, or
+    NULL if the operators cannot be combined into a single CeedOperator. */
+Operator *NewCompositeOperator(const mfem::Array<Operator*> &ops);
+
 } // namespace ceed
 
 } // namespace mfem
@@ -72,13 +72,56 @@ static void InitLexicoRestr(const mfem::FiniteElementSpace &fes,
                              tp_el_dof.GetData(), restr);
 }
 
+static void InitOrientedRestr(const mfem::FiniteElementSpace &fes,
+                              int nelem,
+                              const int* indices,
+                              Ceed ceed, CeedElemRestriction *restr)
+{
+   // Vector finite elements (H(curl), H(div)) keep the native ordering of the
+   // element basis, the signs of the element dofs are applied through the
+   // orientations of the restriction.
+   const mfem::FiniteElement *fe = fes.GetFE(indices ? indices[0] : 0);
+   const int P = fe->GetDof();
+   MFEM_VERIFY(fes.GetVDim() == 1,
+               "Vector finite element spaces with vdim > 1 are not supported.");
+   mfem::Array<int> tp_el_dof(nelem*P);
+   mfem::Array<bool> tp_el_orients(nelem*P);
+   Array<int> dofs;
+
+   for (int i = 0; i < nelem; i++)
+   {
+      const int elem_index = indices ? indices[i] : i;
+      const DofTransformation *doftrans = fes.GetElementDofs(elem_index, dofs);
+      // The transformations only act on the interior dofs of triangular faces
+      // which do not exist for the lowest order
+      MFEM_VERIFY(doftrans == NULL || fe->GetOrder() == 1,
+                  "Elements requiring a DofTransformation are not supported.");
+      const int el_offset = P * i;
+      for (int j = 0; j < P; j++)
+      {
+         const int dof = dofs[j];
+         tp_el_dof[j + el_offset] = dof >= 0 ? dof : -1 - dof;
+         tp_el_orients[j + el_offset] = dof < 0;
+      }
+   }
+
+   CeedElemRestrictionCreateOriented(ceed, nelem, P, 1, 1, fes.GetNDofs(),
+                                     CEED_MEM_HOST, CEED_COPY_VALUES,
+                                     tp_el_dof.GetData(),
+                                     tp_el_orients.GetData(), restr);
+}
+
 static void InitRestrictionImpl(const mfem::FiniteElementSpace &fes,
                                 Ceed ceed, CeedElemRestriction *restr)
 {
    const mfem::FiniteElement *fe = fes.GetFE(0);
    const mfem::TensorBasisElement * tfe =
       dynamic_cast<const mfem::TensorBasisElement *>(fe);
-   if ( tfe && tfe->GetDofMap().Size()>0 ) // Native ordering using dof_map
+   if ( fe->GetRangeType() == mfem::FiniteElement::VECTOR )
+   {
+      InitOrientedRestr(fes, fes.GetNE(), nullptr, ceed, restr);
+   }
+   else if ( tfe && tfe->GetDofMap().Size()>0 ) // Native ordering using dof_map
    {
       InitNativeRestr(fes, ceed, restr);
    }
@@ -160,7 +203,11 @@ static void InitRestrictionWithIndicesImpl(
    const mfem::FiniteElement *fe = fes.GetFE(indices[0]);
    const mfem::TensorBasisElement * tfe =
       dynamic_cast<const mfem::TensorBasisElement *>(fe);
-   if ( tfe && tfe->GetDofMap().Size()>0 ) // Native ordering using dof_map
+   if ( fe->GetRangeType() == mfem::FiniteElement::VECTOR )
+   {
+      InitOrientedRestr(fes, nelem, indices, ceed, restr);
+   }
+   else if ( tfe && tfe->GetDofMap().Size()>0 ) // Native ordering using dof_map
    {
       InitNativeRestrWithIndices(fes, nelem, indices, ceed, restr);
    }
@@ -203,7 +250,11 @@ void InitStridedRestriction(const mfem::FiniteElementSpace &fes,
                             const CeedInt *strides,
                             CeedElemRestriction *restr)
 {
-   RestrKey restr_key(&fes, nelem, nqpts, qdatasize, restr_type::Strided);
+   // Quadrature data uses the backend strides while quadrature coefficients
+   // use explicit strides: the two layouts must not share a restriction.
+   const int type = (strides == CEED_STRIDES_BACKEND) ?
+                    restr_type::StridedBackend : restr_type::Strided;
+   RestrKey restr_key(&fes, nelem, nqpts, qdatasize, type);
    auto restr_itr = mfem::internal::ceed_restr_map.find(restr_key);
    if (restr_itr == mfem::internal::ceed_restr_map.end())
    {
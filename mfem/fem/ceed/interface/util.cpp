@@ -210,6 +210,36 @@ const IntegrationRule & GetRule<VectorMassIntegrator>(
    return MassIntegrator::GetRule(trial_fe, test_fe, trans);
 }
 
+template <>
+const IntegrationRule & GetRule<VectorFEMassIntegrator>(
+   const VectorFEMassIntegrator &integ,
+   const FiniteElement &trial_fe,
+   const FiniteElement &test_fe,
+   ElementTransformation &trans)
+{
+   return MassIntegrator::GetRule(trial_fe, test_fe, trans);
+}
+
+template <>
+const IntegrationRule & GetRule<CurlCurlIntegrator>(
+   const CurlCurlIntegrator &integ,
+   const FiniteElement &trial_fe,
+   const FiniteElement &test_fe,
+   ElementTransformation &trans)
+{
+   return MassIntegrator::GetRule(trial_fe, test_fe, trans);
+}
+
+template <>
+const IntegrationRule & GetRule<ElasticityIntegrator>(
+   const ElasticityIntegrator &integ,
+   const FiniteElement &trial_fe,
+   const FiniteElement &test_fe,
+   ElementTransformation &trans)
+{
+   return ElasticityIntegrator::GetRule(trial_fe, trans);
+}
+
 template <>
 const IntegrationRule & GetRule<ConvectionIntegrator>(
    const ConvectionIntegrator &integ,
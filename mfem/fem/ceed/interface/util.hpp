@@ -140,7 +140,7 @@ struct BasisHash
 };
 using BasisMap = std::unordered_map<const BasisKey, CeedBasis, BasisHash>;
 
-enum restr_type {Standard, Strided, Coeff};
+enum restr_type {Standard, Strided, StridedBackend, Coeff};
 
 // Hash table for CeedElemRestriction
 using RestrKey =
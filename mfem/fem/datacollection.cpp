@@ -17,8 +17,14 @@
 #include "picojson.h"
 
 #include <cerrno>      // errno
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
 #include <sstream>
 #include <regex>
+#include <thread>
 
 #ifndef _WIN32
 #include <sys/stat.h>  // mkdir
@@ -758,6 +764,108 @@ void VisItDataCollection::ParseVisItRootString(const std::string& json)
    }
 }
 
+// Background thread writing the VTU files staged by the asynchronous
+// ParaViewDataCollection::Save(). The files of each save are queued as a job,
+// and at most max_pending jobs are queued or being written.
+class ParaViewDataCollection::AsyncWriter
+{
+public:
+   /// VTU file staged for writing.
+   struct File
+   {
+      std::string name;
+      VTKDeferredStream data;
+      File(const std::string &name_) : name(name_) { }
+   };
+   /// The files staged by one Save().
+   typedef std::list<File> Job;
+
+private:
+   const int max_pending;
+   int pending;
+   bool failed, stop;
+   std::deque<Job> queue;
+   std::mutex mutex;
+   std::condition_variable cond;
+   std::thread thread;
+
+   void Run()
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true)
+      {
+         cond.wait(lock, [this] { return stop || !queue.empty(); });
+         if (queue.empty()) { return; }
+         Job job = std::move(queue.front());
+         queue.pop_front();
+         lock.unlock();
+
+         bool ok = true;
+         for (const File &file : job)
+         {
+            std::ofstream os(file.name);
+            file.data.WriteEncoded(os);
+            os.close();
+            ok = ok && !os.fail();
+         }
+         job.clear();
+
+         lock.lock();
+         failed = failed || !ok;
+         pending--;
+         cond.notify_all();
+      }
+   }
+
+public:
+   AsyncWriter(int max_pending_)
+      : max_pending(max_pending_), pending(0), failed(false), stop(false),
+        thread(&AsyncWriter::Run, this) { }
+
+   /// Block until a new job can be submitted.
+   void WaitForSlot()
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      cond.wait(lock, [this] { return pending < max_pending; });
+   }
+
+   /// Queue @a job for writing.
+   void Submit(Job &&job)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push_back(std::move(job));
+      pending++;
+      cond.notify_all();
+   }
+
+   /// Block until all submitted jobs are written.
+   void Wait()
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      cond.wait(lock, [this] { return pending == 0; });
+   }
+
+   /// Return true if a file failed to be written since the last call.
+   bool Failed()
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      const bool f = failed;
+      failed = false;
+      return f;
+   }
+
+   /// Write the queued jobs and stop the thread.
+   ~AsyncWriter()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stop = true;
+      }
+      cond.notify_all();
+      thread.join();
+   }
+};
+
 ParaViewDataCollection::ParaViewDataCollection(const std::string&
                                                collection_name,
                                                Mesh *mesh_)
@@ -765,7 +873,8 @@ ParaViewDataCollection::ParaViewDataCollection(const std::string&
      levels_of_detail(1),
      pv_data_format(VTKFormat::BINARY),
      high_order_output(false),
-     restart_mode(false)
+     restart_mode(false),
+     async_writer(NULL)
 {
    cycle = 0; // always include a valid cycle index in file names
 
@@ -787,6 +896,30 @@ void ParaViewDataCollection::Load(int )
    MFEM_WARNING("ParaViewDataCollection::Load() is not implemented!");
 }
 
+void ParaViewDataCollection::SetAsyncSave(bool async_save, int max_pending)
+{
+   MFEM_VERIFY(max_pending > 0, "invalid max_pending = " << max_pending);
+   WaitForSave();
+   delete async_writer;
+   async_writer = async_save ? new AsyncWriter(max_pending) : NULL;
+}
+
+void ParaViewDataCollection::WaitForSave()
+{
+   if (!async_writer) { return; }
+   async_writer->Wait();
+   if (async_writer->Failed())
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing the files of an asynchronous save.");
+   }
+}
+
+ParaViewDataCollection::~ParaViewDataCollection()
+{
+   delete async_writer;
+}
+
 std::string ParaViewDataCollection::GenerateCollectionPath()
 {
    return prefix_path + DataCollection::GetCollectionName();
@@ -909,22 +1042,56 @@ void ParaViewDataCollection::Save()
 
    std::string vtu_prefix = col_path + "/" + GenerateVTUPath() + "/";
 
+   // In asynchronous mode, the VTU files are staged in memory (with deferred
+   // encoding) and written by the background thread.
+   AsyncWriter::Job job;
+   if (async_writer)
+   {
+      if (async_writer->Failed())
+      {
+         error = WRITE_ERROR;
+         MFEM_WARNING("Error writing the files of an asynchronous save.");
+      }
+      async_writer->WaitForSlot();
+   }
+   auto save_vtu = [&](const std::string &fname,
+                       const std::function<void(std::ostream&)> &save)
+   {
+      if (async_writer)
+      {
+         job.emplace_back(fname);
+         save(job.back().data);
+      }
+      else
+      {
+         std::ofstream os(fname);
+         save(os);
+      }
+   };
+
    // Save the local part of the mesh and grid functions fields to the local
    // VTU file
+   save_vtu(vtu_prefix + GenerateVTUFileName("proc", myid),
+            [&](std::ostream &os)
    {
-      std::ofstream os(vtu_prefix + GenerateVTUFileName("proc", myid));
       os.precision(precision);
       SaveDataVTU(os, levels_of_detail);
-   }
+   });
 
    // Save the local part of the quadrature function fields
    for (const auto &qfield : q_field_map)
    {
       const std::string &field_name = qfield.first;
-      std::ofstream os(vtu_prefix + GenerateVTUFileName(field_name, myid));
-      qfield.second->SaveVTU(os, pv_data_format, GetCompressionLevel(), field_name);
+      save_vtu(vtu_prefix + GenerateVTUFileName(field_name, myid),
+               [&](std::ostream &os)
+      {
+         qfield.second->SaveVTU(os, pv_data_format, GetCompressionLevel(),
+                                field_name);
+      });
    }
 
+   if (async_writer) { async_writer->Submit(std::move(job)); }
+
    // MPI rank 0 also creates a "PVTU" file that points to all of the separately
    // written VTU files.
    // This file path is then appended to the PVD file.
@@ -513,6 +513,10 @@ private:
    bool high_order_output;
    bool restart_mode;
 
+   /// Background writer used by Save() in asynchronous mode.
+   class AsyncWriter;
+   AsyncWriter *async_writer;
+
 protected:
    void WritePVTUHeader(std::ostream &out);
    void WritePVTUFooter(std::ostream &out, const std::string &vtu_prefix);
@@ -589,8 +593,38 @@ public:
    /// Initially, restart mode is disabled.
    void UseRestartMode(bool restart_mode_);
 
+   /** @brief Enable or disable asynchronous saving. Initially, the collection
+       is saved synchronously. */
+   /** In asynchronous mode, Save() evaluates the mesh and the fields into
+       staging buffers on the calling thread, while the compression, base 64
+       encoding and writing of the VTU files are performed on a background
+       thread. Save() returns once the data is staged, so the fields can be
+       modified (or deleted) right away. At most @a max_pending saves are
+       staged or being written at any time: when this bound is reached, Save()
+       blocks until the oldest one is written. The default bound allows one
+       save to be staged while the previous one is written.
+
+       Only the binary data arrays are deferred: with VTKFormat::ASCII the
+       output is formatted on the calling thread, and only the file writes are
+       performed in the background.
+
+       Disabling the asynchronous mode calls WaitForSave(). */
+   void SetAsyncSave(bool async_save, int max_pending = 2);
+
+   /// Returns true if asynchronous saving is enabled, see SetAsyncSave().
+   bool IsAsyncSave() const { return async_writer != NULL; }
+
+   /** @brief Block until all the files of the previous asynchronous Save()
+       calls are written. */
+   /** If a background write failed, the error state of the collection is set
+       to WRITE_ERROR. */
+   void WaitForSave();
+
    /// Load the collection - not implemented in the ParaView writer
    virtual void Load(int cycle_ = 0) override;
+
+   /// Waits for the pending asynchronous saves, see WaitForSave().
+   virtual ~ParaViewDataCollection();
 };
 
 }
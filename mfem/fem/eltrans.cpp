@@ -29,6 +29,9 @@ double ElementTransformation::EvalWeight()
 {
    MFEM_ASSERT((EvalState & WEIGHT_MASK) == 0, "");
    Jacobian();
+   // The Jacobian evaluation may also set the weight, the adjugate and the
+   // inverse, see BatchedIsoparametricTransformation.
+   if (EvalState & WEIGHT_MASK) { return Wght; }
    EvalState |= WEIGHT_MASK;
    return (Wght = (dFdx.Width() == 0) ? 1.0 : dFdx.Weight());
 }
@@ -37,6 +40,7 @@ const DenseMatrix &ElementTransformation::EvalAdjugateJ()
 {
    MFEM_ASSERT((EvalState & ADJUGATE_MASK) == 0, "");
    Jacobian();
+   if (EvalState & ADJUGATE_MASK) { return adjJ; }
    adjJ.SetSize(dFdx.Width(), dFdx.Height());
    if (dFdx.Width() > 0) { CalcAdjugate(dFdx, adjJ); }
    EvalState |= ADJUGATE_MASK;
@@ -60,6 +64,7 @@ const DenseMatrix &ElementTransformation::EvalInverseJ()
    //                         \ adjJ/Weight^2,  otherwise.
    MFEM_ASSERT((EvalState & INVERSE_MASK) == 0, "");
    Jacobian();
+   if (EvalState & INVERSE_MASK) { return invJ; }
    invJ.SetSize(dFdx.Width(), dFdx.Height());
    if (dFdx.Width() > 0) { CalcInverse(dFdx, invJ); }
    EvalState |= INVERSE_MASK;
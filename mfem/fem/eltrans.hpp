@@ -367,6 +367,7 @@ private:
    const FiniteElement *FElem;
    DenseMatrix PointMat; // dim x dof
 
+protected:
    /** @brief Evaluate the Jacobian of the transformation at the IntPoint and
        store it in dFdx. */
    virtual const DenseMatrix &EvalJacobian();
@@ -0,0 +1,253 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "fem.hpp"
+#include "eltrans_batch.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace mfem
+{
+
+int BatchedIsoparametricTransformation::BatchPoint(
+   const IntegrationPoint *ip) const
+{
+   if (batch == NULL || ip == NULL) { return -1; }
+   // Compare the addresses first: the difference of pointers into different
+   // arrays is undefined, and computed with an exact division.
+   const IntegrationPoint *begin = batch->ir.GetData();
+   std::less<const IntegrationPoint*> less;
+   if (less(ip, begin) || !less(ip, begin + batch->nq)) { return -1; }
+   return (int)(ip - begin);
+}
+
+const DenseMatrix &BatchedIsoparametricTransformation::EvalJacobian()
+{
+   const int q = BatchPoint(IntPoint);
+   if (q < 0) { return IsoparametricTransformation::EvalJacobian(); }
+
+   const ElementTransformationBatch &b = *batch;
+   const int nq = b.nq, dim = b.dim, sdim = b.sdim;
+   const int off = q + nq*sdim*dim*be;
+   dFdx.SetSize(sdim, dim);
+   adjJ.SetSize(dim, sdim);
+   invJ.SetSize(dim, sdim);
+   for (int k = 0; k < sdim*dim; k++)
+   {
+      dFdx.GetData()[k] = b.J(off + nq*k);
+      adjJ.GetData()[k] = b.AdjJ(off + nq*k);
+      invJ.GetData()[k] = b.InvJ(off + nq*k);
+   }
+   Wght = b.W(q + nq*be);
+   EvalState |= JACOBIAN_MASK | WEIGHT_MASK | ADJUGATE_MASK | INVERSE_MASK;
+   return dFdx;
+}
+
+void BatchedIsoparametricTransformation::Transform(const IntegrationPoint &ip,
+                                                   Vector &trans)
+{
+   const int q = BatchPoint(&ip);
+   if (q < 0)
+   {
+      IsoparametricTransformation::Transform(ip, trans);
+      return;
+   }
+   const int nq = batch->nq, sdim = batch->sdim;
+   trans.SetSize(sdim);
+   for (int c = 0; c < sdim; c++)
+   {
+      trans(c) = batch->X(q + nq*(c + sdim*be));
+   }
+}
+
+void BatchedIsoparametricTransformation::Transform(const IntegrationRule &ir,
+                                                   DenseMatrix &tr)
+{
+   if (batch == NULL || &ir != &batch->ir)
+   {
+      IsoparametricTransformation::Transform(ir, tr);
+      return;
+   }
+   const int nq = batch->nq, sdim = batch->sdim;
+   tr.SetSize(sdim, nq);
+   for (int q = 0; q < nq; q++)
+   {
+      for (int c = 0; c < sdim; c++)
+      {
+         tr(c, q) = batch->X(q + nq*(c + sdim*be));
+      }
+   }
+}
+
+
+ElementTransformationBatch::ElementTransformationBatch(
+   Mesh &mesh_, const IntegrationRule &ir_, Geometry::Type geom_)
+   : mesh(mesh_), ir(ir_), geom(geom_), fe(NULL),
+     dim(mesh_.Dimension()), sdim(mesh_.SpaceDimension()), nd(0),
+     nq(ir_.GetNPoints()), e_begin(0), e_end(0)
+{
+   // The shape functions of NURBS elements depend on the element.
+   if (mesh.NURBSext || nq == 0 || dim == 0) { return; }
+
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      if (mesh.GetElementGeometry(e) == geom)
+      {
+         fe = GetTransformationFE(e);
+         break;
+      }
+   }
+   if (fe == NULL) { return; }
+
+   nd = fe->GetDof();
+   B.SetSize(nd*nq);
+   G.SetSize(nd*dim*nq);
+   for (int q = 0; q < nq; q++)
+   {
+      Vector shape(B.GetData() + nd*q, nd);
+      DenseMatrix dshape(G.GetData() + nd*dim*q, nd, dim);
+      fe->CalcShape(ir.IntPoint(q), shape);
+      fe->CalcDShape(ir.IntPoint(q), dshape);
+   }
+}
+
+const FiniteElement *ElementTransformationBatch::GetTransformationFE(
+   int e) const
+{
+   const GridFunction *nodes = mesh.GetNodes();
+   if (nodes) { return nodes->FESpace()->GetFE(e); }
+   return mesh.GetTransformationFEforElementType(mesh.GetElementType(e));
+}
+
+void ElementTransformationBatch::Compute(int e_begin_, int e_end_)
+{
+   MFEM_VERIFY(0 <= e_begin_ && e_begin_ <= e_end_ && e_end_ <= mesh.GetNE(),
+               "invalid element range [" << e_begin_ << ", " << e_end_ << ")");
+   e_begin = e_begin_;
+   e_end = e_end_;
+   const int ne = e_end - e_begin;
+
+   batched.SetSize(ne);
+   P.SetSize(sdim*nd*ne);
+   X.SetSize(nq*sdim*ne);
+   J.SetSize(nq*sdim*dim*ne);
+   W.SetSize(nq*ne);
+   AdjJ.SetSize(nq*dim*sdim*ne);
+   InvJ.SetSize(nq*dim*sdim*ne);
+
+   const GridFunction *nodes = mesh.GetNodes();
+   const FiniteElementSpace *nfes = nodes ? nodes->FESpace() : NULL;
+   const Table *elem_dof = nfes ? &nfes->GetElementToDofTable() : NULL;
+   if (nodes) { nodes->HostRead(); }
+
+   const int nd_ = nd, dim_ = dim, sdim_ = sdim, nq_ = nq;
+   const double *b = B.HostRead(), *g = G.HostRead();
+   double *p = P.HostWrite(), *x = X.HostWrite(), *j = J.HostWrite();
+   double *w = W.HostWrite();
+   double *adj = AdjJ.HostWrite(), *inv = InvJ.HostWrite();
+
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int be = 0; be < ne; be++)
+   {
+      const int e = e_begin + be;
+      batched[be] = (fe != NULL && mesh.GetElementGeometry(e) == geom &&
+                     GetTransformationFE(e) == fe);
+      if (!batched[be]) { continue; }
+
+      // Gather the point matrix, (sdim x nd), as in
+      // Mesh::GetElementTransformation().
+      double *pe = p + sdim_*nd_*be;
+      if (nodes)
+      {
+         const int *dofs = elem_dof->GetRow(e);
+         for (int i = 0; i < nd_; i++)
+         {
+            for (int c = 0; c < sdim_; c++)
+            {
+               pe[c + sdim_*i] = (*nodes)(nfes->DofToVDof(dofs[i], c));
+            }
+         }
+      }
+      else
+      {
+         const int *v = mesh.GetElement(e)->GetVertices();
+         for (int i = 0; i < nd_; i++)
+         {
+            const double *vx = mesh.GetVertex(v[i]);
+            for (int c = 0; c < sdim_; c++) { pe[c + sdim_*i] = vx[c]; }
+         }
+      }
+
+      double jq[9], adjq[9], invq[9];
+      DenseMatrix Jq(jq, sdim_, dim_);
+      DenseMatrix Adjq(adjq, dim_, sdim_), Invq(invq, dim_, sdim_);
+      for (int q = 0; q < nq_; q++)
+      {
+         const double *bq = b + nd_*q, *gq = g + nd_*dim_*q;
+         for (int c = 0; c < sdim_; c++)
+         {
+            double xc = 0.0;
+            for (int i = 0; i < nd_; i++) { xc += pe[c + sdim_*i]*bq[i]; }
+            x[q + nq_*(c + sdim_*be)] = xc;
+            for (int d = 0; d < dim_; d++)
+            {
+               double jcd = 0.0;
+               for (int i = 0; i < nd_; i++)
+               {
+                  jcd += pe[c + sdim_*i]*gq[i + nd_*d];
+               }
+               Jq(c, d) = jcd;
+            }
+         }
+         w[q + nq_*be] = Jq.Weight();
+         CalcAdjugate(Jq, Adjq);
+         CalcInverse(Jq, Invq);
+         for (int k = 0; k < sdim_*dim_; k++)
+         {
+            j[q + nq_*(k + sdim_*dim_*be)] = jq[k];
+            adj[q + nq_*(k + sdim_*dim_*be)] = adjq[k];
+            inv[q + nq_*(k + sdim_*dim_*be)] = invq[k];
+         }
+      }
+   }
+}
+
+void ElementTransformationBatch::GetElementTransformation(
+   int e, BatchedIsoparametricTransformation *T) const
+{
+   MFEM_ASSERT(e_begin <= e && e < e_end,
+               "element " << e << " is not in the current range");
+   const int be = e - e_begin;
+   if (!batched[be])
+   {
+      T->batch = NULL;
+      T->be = -1;
+      mesh.GetElementTransformation(e, T);
+      return;
+   }
+   T->batch = this;
+   T->be = be;
+   T->Attribute = mesh.GetAttribute(e);
+   T->ElementNo = e;
+   T->ElementType = ElementTransformation::ELEMENT;
+   T->mesh = &mesh;
+   T->Reset();
+   DenseMatrix &pm = T->GetPointMat();
+   pm.SetSize(sdim, nd);
+   std::copy(P.HostRead() + sdim*nd*be, P.HostRead() + sdim*nd*(be+1),
+             pm.GetData());
+   T->SetFE(fe);
+}
+
+} // namespace mfem
@@ -0,0 +1,121 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_ELTRANS_BATCH
+#define MFEM_ELTRANS_BATCH
+
+#include "../config/config.hpp"
+#include "eltrans.hpp"
+
+namespace mfem
+{
+
+class Mesh;
+class ElementTransformationBatch;
+
+/** @brief The IsoparametricTransformation of one element of an
+    ElementTransformationBatch. */
+/** At the points of the IntegrationRule of the batch, the physical coordinates,
+    the Jacobian and its weight, adjugate and inverse are copied from the batch
+    instead of being evaluated. At all other points, the transformation is
+    evaluated as in IsoparametricTransformation, with the point matrix gathered
+    by the batch. Objects of this class are set up with
+    ElementTransformationBatch::GetElementTransformation(). */
+class BatchedIsoparametricTransformation : public IsoparametricTransformation
+{
+   friend class ElementTransformationBatch;
+
+protected:
+   const ElementTransformationBatch *batch;
+   int be; // index of the element in the batch
+
+   /// Return the index of @a ip in the rule of the batch, or -1.
+   int BatchPoint(const IntegrationPoint *ip) const;
+
+   virtual const DenseMatrix &EvalJacobian();
+
+public:
+   BatchedIsoparametricTransformation() : batch(NULL), be(-1) { }
+
+   using IsoparametricTransformation::Transform;
+
+   virtual void Transform(const IntegrationPoint &ip, Vector &trans);
+
+   virtual void Transform(const IntegrationRule &ir, DenseMatrix &tr);
+};
+
+/** @brief Element transformations of a range of mesh elements, evaluated at all
+    points of an IntegrationRule at once. */
+/** Compute() gathers the nodal coordinates of a range of elements and evaluates
+    the physical coordinates, the Jacobians and their weights, adjugates and
+    inverses at the points of the rule, using reference basis tables that are
+    computed once. The results are stored in flat arrays in which the point
+    index runs fastest, e.g. the entry (i,j) of the Jacobian at point q of the
+    element with batch index be is J[q + nq*(i + sdim*(j + dim*be))].
+
+    Element loops access the batch through BatchedIsoparametricTransformation
+    objects, which the AssembleElementMatrix() methods of the integrators use
+    as any other ElementTransformation. Elements whose geometry or
+    transformation FiniteElement differ from the ones of the batch (including
+    all elements of NURBS meshes) are set up with
+    Mesh::GetElementTransformation(). */
+class ElementTransformationBatch
+{
+   friend class BatchedIsoparametricTransformation;
+
+protected:
+   Mesh &mesh;
+   const IntegrationRule &ir;
+   const Geometry::Type geom;
+   const FiniteElement *fe; // transformation FE of the batched elements
+   int dim, sdim, nd, nq;
+
+   Vector B, G; // basis (nd x nq) and derivatives (nd x dim x nq) at the rule
+   int e_begin, e_end;
+   Array<int> batched; // whether element e_begin + be is batched
+   Vector P, X, J, W, AdjJ, InvJ;
+
+   const FiniteElement *GetTransformationFE(int e) const;
+
+public:
+   /// Batch the elements of @a mesh with geometry @a geom at the points of @a ir.
+   /** The rule must outlive the batch; the rules of IntRules do. */
+   ElementTransformationBatch(Mesh &mesh, const IntegrationRule &ir,
+                              Geometry::Type geom);
+
+   /// Compute the transformations of the elements in [@a e_begin, @a e_end).
+   void Compute(int e_begin, int e_end);
+
+   /// Set up @a T as the transformation of element @a e of the current range.
+   void GetElementTransformation(int e,
+                                 BatchedIsoparametricTransformation *T) const;
+
+   /// Return the rule at the points of which the transformations are computed.
+   const IntegrationRule &GetIntRule() const { return ir; }
+
+   /// Return true if element @a e of the current range is batched.
+   bool IsBatched(int e) const { return batched[e - e_begin]; }
+
+   /// Physical coordinates, (nq x sdim x ne).
+   const Vector &GetCoordinates() const { return X; }
+   /// Jacobians, (nq x sdim x dim x ne).
+   const Vector &GetJacobians() const { return J; }
+   /// Weights (determinants) of the Jacobians, (nq x ne).
+   const Vector &GetWeights() const { return W; }
+   /// Adjugates of the Jacobians, (nq x dim x sdim x ne).
+   const Vector &GetAdjugates() const { return AdjJ; }
+   /// (Left) inverses of the Jacobians, (nq x dim x sdim x ne).
+   const Vector &GetInverses() const { return InvJ; }
+};
+
+} // namespace mfem
+
+#endif
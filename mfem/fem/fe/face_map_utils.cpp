@@ -35,6 +35,27 @@ std::pair<int,int> GetFaceNormal3D(const int face_id)
    return std::make_pair(-1, -1); // invalid
 }
 
+std::pair<int,int> GetFaceNormal(const int dim, const int face_id)
+{
+   switch (dim)
+   {
+      case 1: return std::make_pair(0, face_id); // x = 0 or x = 1
+      case 2:
+         switch (face_id)
+         {
+            case 0: return std::make_pair(1, 0); // y = 0
+            case 1: return std::make_pair(0, 1); // x = 1
+            case 2: return std::make_pair(1, 1); // y = 1
+            case 3: return std::make_pair(0, 0); // x = 0
+            default: MFEM_ABORT("Invalid face ID.")
+         }
+         break;
+      case 3: return GetFaceNormal3D(face_id);
+      default: MFEM_ABORT("Invalid dimension.")
+   }
+   return std::make_pair(-1, -1); // invalid
+}
+
 void FillFaceMap(const int n_face_dofs_per_component,
                  const std::vector<int> &offsets,
                  const std::vector<int> &strides,
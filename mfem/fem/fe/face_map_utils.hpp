@@ -27,6 +27,10 @@ namespace internal
 /// Returns i and level.
 std::pair<int,int> GetFaceNormal3D(const int face_id);
 
+/// Same as GetFaceNormal3D(), for the faces of segments (dim = 1),
+/// quadrilaterals (dim = 2) and hexahedra (dim = 3).
+std::pair<int,int> GetFaceNormal(const int dim, const int face_id);
+
 /// @brief Fills in the entries of the lexicographic face_map.
 ///
 /// For use in FiniteElement::GetFaceMap.
@@ -18,6 +18,7 @@
 #include "fe_coll.hpp"
 #include "doftrans.hpp"
 #include "eltrans.hpp"
+#include "eltrans_batch.hpp"
 #include "coefficient.hpp"
 #include "complex_fem.hpp"
 #include "convergence.hpp"
@@ -17,6 +17,7 @@
 #include "fem.hpp"
 #include "ceed/interface/util.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdarg>
 
@@ -349,39 +350,66 @@ void FiniteElementSpace::BuildElementToDofTable() const
 {
    if (elem_dof) { return; }
 
-   // TODO: can we call GetElementDofs only once per element?
-   Table *el_dof = new Table;
-   Table *el_fos = (mesh->Dimension() > 2) ? (new Table) : NULL;
-   Array<int> dofs;
-   Array<int> F, Fo;
-   el_dof -> MakeI (mesh -> GetNE());
-   if (el_fos) { el_fos -> MakeI (mesh -> GetNE()); }
-   for (int i = 0; i < mesh -> GetNE(); i++)
+   const int NE = mesh->GetNE();
+   int *I = new int[NE+1];
+   int *fos_I = (mesh->Dimension() > 2) ? new int[NE+1] : NULL;
+   int *J = NULL, *fos_J = NULL;
+   I[0] = 0;
+   if (fos_I) { fos_I[0] = 0; }
+
+   // The rows are first counted and then written directly into the flat J
+   // arrays. In fixed-order spaces the elements are processed concurrently: in
+   // variable order spaces the FiniteElementCollection creates the
+   // collections of other orders on demand.
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel if (!IsVariableOrder())
+#endif
    {
-      GetElementDofs (i, dofs);
-      el_dof -> AddColumnsInRow (i, dofs.Size());
-
-      if (el_fos)
+      Array<int> dofs, V, E, Eo, F, Fo;
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp for
+#endif
+      for (int i = 0; i < NE; i++)
       {
-         mesh->GetElementFaces(i, F, Fo);
-         el_fos -> AddColumnsInRow (i, Fo.Size());
+         GetElementDofsImpl(i, dofs, V, E, Eo, F, Fo);
+         I[i+1] = dofs.Size();
+         if (fos_I) { fos_I[i+1] = mesh->GetElement(i)->GetNFaces(); }
       }
-   }
-   el_dof -> MakeJ();
-   if (el_fos) { el_fos -> MakeJ(); }
-   for (int i = 0; i < mesh -> GetNE(); i++)
-   {
-      GetElementDofs (i, dofs);
-      el_dof -> AddConnections (i, (int *)dofs, dofs.Size());
-
-      if (el_fos)
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp single
+#endif
       {
-         mesh->GetElementFaces(i, F, Fo);
-         el_fos -> AddConnections (i, (int *)Fo, Fo.Size());
+         for (int i = 0; i < NE; i++) { I[i+1] += I[i]; }
+         J = new int[I[NE]];
+         if (fos_I)
+         {
+            for (int i = 0; i < NE; i++) { fos_I[i+1] += fos_I[i]; }
+            fos_J = new int[fos_I[NE]];
+         }
       }
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp for
+#endif
+      for (int i = 0; i < NE; i++)
+      {
+         GetElementDofsImpl(i, dofs, V, E, Eo, F, Fo);
+         std::copy(dofs.begin(), dofs.end(), J + I[i]);
+         if (fos_J)
+         {
+            mesh->GetElementFaces(i, F, Fo);
+            std::copy(Fo.begin(), Fo.end(), fos_J + fos_I[i]);
+         }
+      }
+   }
+
+   Table *el_dof = new Table;
+   el_dof->SetIJ(I, J, NE);
+   Table *el_fos = NULL;
+   if (fos_I)
+   {
+      el_fos = new Table;
+      el_fos->SetIJ(fos_I, fos_J, NE);
    }
-   el_dof -> ShiftUpI();
-   if (el_fos) { el_fos -> ShiftUpI(); }
    elem_dof = el_dof;
    elem_fos = el_fos;
 }
@@ -2454,14 +2482,21 @@ void FiniteElementSpace::Construct()
    {
       if (IsVariableOrder() || mixed_elements)
       {
-         bdofs = new int[mesh->GetNE()+1];
+         // count the interior DOFs of each element, then number them with
+         // a prefix sum
+         const int NE = mesh->GetNE();
+         bdofs = new int[NE+1];
          bdofs[0] = 0;
-         for (int i = 0; i < mesh->GetNE(); i++)
+#ifdef MFEM_USE_LEGACY_OPENMP
+         #pragma omp parallel for if (!IsVariableOrder())
+#endif
+         for (int i = 0; i < NE; i++)
          {
             int p = GetElementOrderImpl(i);
-            nbdofs += fec->GetNumDof(mesh->GetElementGeometry(i), p);
-            bdofs[i+1] = nbdofs;
+            bdofs[i+1] = fec->GetNumDof(mesh->GetElementGeometry(i), p);
          }
+         for (int i = 0; i < NE; i++) { bdofs[i+1] += bdofs[i]; }
+         nbdofs = bdofs[NE];
       }
       else
       {
@@ -2747,6 +2782,20 @@ FiniteElementSpace::GetElementDofs(int elem, Array<int> &dofs) const
 
    Array<int> V, E, Eo, F, Fo; // TODO: LocalArray
 
+   GetElementDofsImpl(elem, dofs, V, E, Eo, F, Fo);
+
+   if (DoFTrans[mesh->GetElementBaseGeometry(elem)] && Fo.Size())
+   {
+      DoFTrans[mesh->GetElementBaseGeometry(elem)]->SetFaceOrientations(Fo);
+   }
+   return DoFTrans[mesh->GetElementBaseGeometry(elem)];
+}
+
+void FiniteElementSpace::GetElementDofsImpl(int elem, Array<int> &dofs,
+                                            Array<int> &V, Array<int> &E,
+                                            Array<int> &Eo, Array<int> &F,
+                                            Array<int> &Fo) const
+{
    int dim = mesh->Dimension();
    auto geom = mesh->GetElementGeometry(elem);
    int order = GetElementOrderImpl(elem);
@@ -2755,6 +2804,9 @@ FiniteElementSpace::GetElementDofs(int elem, Array<int> &dofs) const
    int ne = (dim > 1) ? fec->GetNumDof(Geometry::SEGMENT, order) : 0;
    int nb = (dim > 0) ? fec->GetNumDof(geom, order) : 0;
 
+   V.SetSize(0);
+   E.SetSize(0);
+   Fo.SetSize(0);
    if (nv) { mesh->GetElementVertices(elem, V); }
    if (ne) { mesh->GetElementEdges(elem, E, Eo); }
 
@@ -2766,15 +2818,10 @@ FiniteElementSpace::GetElementDofs(int elem, Array<int> &dofs) const
       {
          nfd += fec->GetNumDof(mesh->GetFaceGeometry(F[i]), order);
       }
-      if (DoFTrans[mesh->GetElementBaseGeometry(elem)])
-      {
-         DoFTrans[mesh->GetElementBaseGeometry(elem)]
-         -> SetFaceOrientations(Fo);
-      }
    }
 
-   dofs.SetSize(0);
-   dofs.Reserve(nv*V.Size() + ne*E.Size() + nfd + nb);
+   dofs.SetSize(nv*V.Size() + ne*E.Size() + nfd + nb);
+   int *d = dofs.GetData();
 
    if (nv) // vertex DOFs
    {
@@ -2782,7 +2829,7 @@ FiniteElementSpace::GetElementDofs(int elem, Array<int> &dofs) const
       {
          for (int j = 0; j < nv; j++)
          {
-            dofs.Append(V[i]*nv + j);
+            *d++ = V[i]*nv + j;
          }
       }
    }
@@ -2796,7 +2843,7 @@ FiniteElementSpace::GetElementDofs(int elem, Array<int> &dofs) const
 
          for (int j = 0; j < ne; j++)
          {
-            dofs.Append(EncodeDof(nvdofs + ebase, ind[j]));
+            *d++ = EncodeDof(nvdofs + ebase, ind[j]);
          }
       }
    }
@@ -2813,7 +2860,7 @@ FiniteElementSpace::GetElementDofs(int elem, Array<int> &dofs) const
 
          for (int j = 0; j < nf; j++)
          {
-            dofs.Append(EncodeDof(nvdofs + nedofs + fbase, ind[j]));
+            *d++ = EncodeDof(nvdofs + nedofs + fbase, ind[j]);
          }
       }
    }
@@ -2825,10 +2872,9 @@ FiniteElementSpace::GetElementDofs(int elem, Array<int> &dofs) const
 
       for (int j = 0; j < nb; j++)
       {
-         dofs.Append(bbase + j);
+         *d++ = bbase + j;
       }
    }
-   return DoFTrans[mesh->GetElementBaseGeometry(elem)];
 }
 
 void FiniteElementSpace::GetPatchDofs(int patch, Array<int> &dofs) const
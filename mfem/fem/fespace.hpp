@@ -351,6 +351,17 @@ protected:
    /// Return element order: internal version of GetElementOrder without checks.
    int GetElementOrderImpl(int i) const;
 
+   /** @brief Compute the dofs of element @a elem from the mesh entities,
+       without using #elem_dof and without setting the face orientations of
+       the DofTransformation.
+
+       The arrays @a V, @a E, @a Eo, @a F and @a Fo are work space. In
+       fixed-order spaces the method may be called concurrently for different
+       elements, each thread using its own arrays. */
+   void GetElementDofsImpl(int elem, Array<int> &dofs, Array<int> &V,
+                           Array<int> &E, Array<int> &Eo,
+                           Array<int> &F, Array<int> &Fo) const;
+
    /** In a variable order space, calculate a bitmask of polynomial orders that
        need to be represented on each edge and face. */
    void CalcEdgeFaceVarOrders(Array<VarOrderBits> &edge_orders,
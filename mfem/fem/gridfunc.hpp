@@ -281,6 +281,39 @@ public:
                            DenseMatrix &vals, DenseMatrix &tr) const;
    ///@}
 
+   /** @name Batched Point Evaluation Methods
+
+       These methods evaluate the field at a set of points, each given by an
+       element index and reference coordinates within that element, e.g. as
+       returned by Mesh::FindPoints(). Points with a negative element index get
+       zero values.
+
+       The points are grouped by element geometry and order. Groups of nodal
+       tensor-product elements (e.g. H1 and L2 spaces on segments,
+       quadrilaterals and hexahedra) are evaluated in bulk with mfem::forall
+       kernels, the remaining points are evaluated one at a time on the host.
+    */
+   ///@{
+   /** @brief Evaluate the field at the points given by @a elem_ids and @a ips.
+
+       On return, @a vals contains VectorDim() values per point, stored by
+       components (Ordering::byNODES) or by points (Ordering::byVDIM). */
+   void GetPointValues(const Array<int> &elem_ids,
+                       const Array<IntegrationPoint> &ips, Vector &vals,
+                       Ordering::Type ordering = Ordering::byNODES) const;
+
+   /** @brief Evaluate the gradient of the field with respect to the physical
+       coordinates at the points given by @a elem_ids and @a ips.
+
+       On return, @a grads contains the VectorDim() x SpaceDimension() gradient
+       of each point, stored column-major as in GetVectorGradient(), by
+       components (Ordering::byNODES) or by points (Ordering::byVDIM). The space
+       must have scalar basis functions. */
+   void GetPointGradients(const Array<int> &elem_ids,
+                          const Array<IntegrationPoint> &ips, Vector &grads,
+                          Ordering::Type ordering = Ordering::byNODES) const;
+   ///@}
+
    void GetLaplacians(int i, const IntegrationRule &ir, Vector &laps,
                       int vdim = 1) const;
 
@@ -0,0 +1,348 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+// Batched evaluation of GridFunctions at points given by element indices and
+// reference coordinates.
+
+#include "gridfunc.hpp"
+#include "../general/forall.hpp"
+#include "../linalg/kernels.hpp"
+
+#include <map>
+
+namespace mfem
+{
+
+/// Return @a fe if it is a nodal tensor-product element whose shape functions
+/// can be evaluated by the batched point kernels, NULL otherwise.
+static const NodalTensorFiniteElement *GetBatchedElement(
+   const FiniteElement *fe)
+{
+   auto tfe = dynamic_cast<const NodalTensorFiniteElement*>(fe);
+   if (!tfe || fe->GetMapType() != FiniteElement::VALUE) { return nullptr; }
+   if (tfe->GetBasis1D().IsIntegratedType()) { return nullptr; }
+   if (fe->GetOrder() + 1 > DeviceDofQuadLimits::Get().MAX_D1D)
+   {
+      return nullptr;
+   }
+   return tfe;
+}
+
+/// Evaluate the @a n Lagrange polynomials with nodes @a z and barycentric
+/// weights @a w, and their derivatives, at @a x.
+MFEM_HOST_DEVICE inline
+void EvalLagrange1D(const int n, const double *z, const double *w,
+                    const double x, double *B, double *G)
+{
+   for (int i = 0; i < n; i++)
+   {
+      double b = w[i], g = 0.0;
+      for (int j = 0; j < n; j++)
+      {
+         if (j == i) { continue; }
+         g = g*(x - z[j]) + b;
+         b *= x - z[j];
+      }
+      B[i] = b;
+      G[i] = g;
+   }
+}
+
+/** @brief Evaluate the components of @a x, a function in @a fes, at the points
+    @a idx, where point k lies in element @a elem[k] at the reference
+    coordinates @a pts[3*k+d]. All the elements use @a fe.
+
+    With @a derivs, the derivatives with respect to the reference coordinates
+    are computed instead of the values. The result for the j-th point of @a idx
+    is written to @a out as a column-major vdim x dim matrix (vdim values
+    without @a derivs). */
+static void EvalTensorPoints(const FiniteElementSpace &fes, const Vector &x,
+                             const NodalTensorFiniteElement &fe,
+                             const Array<int> &idx, const Array<int> &elem,
+                             const Vector &pts, const bool derivs, Vector &out)
+{
+   const int dim = fe.GetDim();
+   const int p = fe.GetOrder();
+   const int D1D = p + 1;
+   const int vdim = fes.GetVDim();
+   const int ndofs = fes.GetNDofs();
+   const bool byvdim = fes.GetOrdering() == Ordering::byVDIM;
+   const int n = idx.Size();
+   const int nd = derivs ? dim : 1;
+
+   // Nodes and barycentric weights of the 1D Lagrange basis
+   Vector nodes(D1D), weights(D1D);
+   const double *z = poly1d.GetPoints(p, fe.GetBasisType());
+   for (int i = 0; i < D1D; i++)
+   {
+      nodes(i) = z[i];
+      weights(i) = 1.0;
+      for (int j = 0; j < D1D; j++)
+      {
+         if (j != i) { weights(i) /= z[i] - z[j]; }
+      }
+   }
+
+   // Lexicographic to native ordering, empty for elements that use the
+   // lexicographic ordering natively
+   Array<int> dof_map(fe.GetDofMap());
+   if (dof_map.Size() == 0)
+   {
+      dof_map.SetSize(fe.GetDof());
+      for (int i = 0; i < dof_map.Size(); i++) { dof_map[i] = i; }
+   }
+
+   const Table &el_dof = fes.GetElementToDofTable();
+   const int *I = el_dof.ReadI(), *J = el_dof.ReadJ();
+   const int *map = dof_map.Read();
+   const int *d_idx = idx.Read(), *d_elem = elem.Read();
+   const double *d_pts = pts.Read(), *X = x.Read();
+   const double *d_z = nodes.Read(), *d_w = weights.Read();
+   out.SetSize(n*vdim*nd);
+   double *Y = out.Write();
+
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int j)
+   {
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      double B[3][MD1], G[3][MD1];
+      const int k = d_idx[j];
+      for (int d = 0; d < 3; d++)
+      {
+         if (d < dim)
+         {
+            EvalLagrange1D(D1D, d_z, d_w, d_pts[3*k+d], B[d], G[d]);
+         }
+         else { B[d][0] = 1.0; G[d][0] = 0.0; }
+      }
+      const int nx = D1D, ny = (dim > 1) ? D1D : 1, nz = (dim > 2) ? D1D : 1;
+      const int *edofs = J + I[d_elem[k]];
+
+      for (int c = 0; c < vdim; c++)
+      {
+         double v[3] = {0.0, 0.0, 0.0};
+         for (int iz = 0; iz < nz; iz++)
+         {
+            for (int iy = 0; iy < ny; iy++)
+            {
+               for (int ix = 0; ix < nx; ix++)
+               {
+                  const int s = edofs[map[ix + nx*(iy + ny*iz)]];
+                  const int dof = (s >= 0) ? s : -1-s;
+                  const double u = ((s >= 0) ? 1.0 : -1.0) *
+                                   X[byvdim ? c + vdim*dof : dof + ndofs*c];
+                  if (!derivs)
+                  {
+                     v[0] += u * B[0][ix] * B[1][iy] * B[2][iz];
+                  }
+                  else
+                  {
+                     v[0] += u * G[0][ix] * B[1][iy] * B[2][iz];
+                     v[1] += u * B[0][ix] * G[1][iy] * B[2][iz];
+                     v[2] += u * B[0][ix] * B[1][iy] * G[2][iz];
+                  }
+               }
+            }
+         }
+         for (int d = 0; d < nd; d++) { Y[c + vdim*(d + nd*j)] = v[d]; }
+      }
+   });
+}
+
+/// Invert the DIM x DIM Jacobian matrix @a J.
+template <int DIM> MFEM_HOST_DEVICE inline
+void InvertJacobian(const double *J, double *Jinv)
+{
+   kernels::CalcInverse<DIM>(J, Jinv);
+}
+
+template <> MFEM_HOST_DEVICE inline
+void InvertJacobian<1>(const double *J, double *Jinv)
+{
+   Jinv[0] = 1.0/J[0];
+}
+
+/// Map the reference gradients @a G (vdim x dim per point) to physical
+/// gradients using the Jacobians @a Jac (dim x dim per point), in place.
+template <int DIM>
+static void ApplyInverseJacobians(const int n, const int vdim,
+                                  const Vector &Jac, Vector &G)
+{
+   const double *J = Jac.Read();
+   double *Y = G.ReadWrite();
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int j)
+   {
+      double Jinv[DIM*DIM], g[DIM];
+      InvertJacobian<DIM>(J + DIM*DIM*j, Jinv);
+      for (int c = 0; c < vdim; c++)
+      {
+         double *y = Y + vdim*DIM*j + c;
+         for (int d = 0; d < DIM; d++) { g[d] = y[vdim*d]; }
+         for (int s = 0; s < DIM; s++)
+         {
+            double gs = 0.0;
+            for (int d = 0; d < DIM; d++) { gs += g[d] * Jinv[d + DIM*s]; }
+            y[vdim*s] = gs;
+         }
+      }
+   });
+}
+
+/// Common implementation of GridFunction::GetPointValues() and
+/// GridFunction::GetPointGradients().
+static void EvalPoints(const GridFunction &gf, const Array<int> &elem_ids,
+                       const Array<IntegrationPoint> &ips, const bool grads,
+                       Vector &out, const Ordering::Type ordering)
+{
+   const FiniteElementSpace &fes = *gf.FESpace();
+   Mesh &mesh = *fes.GetMesh();
+   const int npts = elem_ids.Size();
+   MFEM_VERIFY(ips.Size() == npts, "incompatible number of points");
+   const int dim = mesh.Dimension();
+   const int sdim = mesh.SpaceDimension();
+   const int vdim = gf.VectorDim();
+   const int ncomp = grads ? vdim*sdim : vdim;
+   MFEM_VERIFY(!grads || fes.FEColl()->GetRangeType(dim) ==
+               FiniteElement::SCALAR,
+               "gradients require a space with scalar basis functions");
+
+   out.SetSize(ncomp*npts);
+   out.UseDevice(true);
+   out = 0.0;
+   if (npts == 0) { return; }
+
+   // Reference coordinates of the points, and groups of points by element
+   // geometry and order
+   Vector pts(3*npts);
+   double *h_pts = pts.HostWrite();
+   std::map<int, Array<int>> groups;
+   for (int k = 0; k < npts; k++)
+   {
+      h_pts[3*k+0] = ips[k].x;
+      h_pts[3*k+1] = ips[k].y;
+      h_pts[3*k+2] = ips[k].z;
+      const int e = elem_ids[k];
+      if (e < 0) { continue; }
+      MFEM_VERIFY(e < mesh.GetNE(), "invalid element index " << e);
+      const int key = fes.GetElementOrder(e) * Geometry::NumGeom +
+                      mesh.GetElementGeometry(e);
+      groups[key].Append(k);
+   }
+
+   const GridFunction *nodes = mesh.GetNodes();
+   const FiniteElementSpace *nodes_fes = nodes ? nodes->FESpace() : NULL;
+   const bool byvdim = (ordering == Ordering::byVDIM);
+   Array<int> host_pts;
+   for (auto &group : groups)
+   {
+      const Array<int> &idx = group.second;
+      const int e0 = elem_ids[idx[0]];
+      const NodalTensorFiniteElement *fe = GetBatchedElement(fes.GetFE(e0));
+      if (!fe || (grads && dim != sdim))
+      {
+         host_pts.Append(idx);
+         continue;
+      }
+
+      const int n = idx.Size();
+      Vector res;
+      EvalTensorPoints(fes, gf, *fe, idx, elem_ids, pts, grads, res);
+      if (grads)
+      {
+         // Jacobians of the element transformations at the points
+         Vector jac(dim*dim*n);
+         const NodalTensorFiniteElement *nodes_fe =
+            (nodes && !nodes_fes->IsVariableOrder()) ?
+            GetBatchedElement(nodes_fes->GetFE(e0)) : NULL;
+         if (nodes_fe)
+         {
+            EvalTensorPoints(*nodes_fes, *nodes, *nodes_fe, idx, elem_ids, pts,
+                             true, jac);
+         }
+         else
+         {
+            double *h_jac = jac.HostWrite();
+            IsoparametricTransformation T;
+            for (int j = 0; j < n; j++)
+            {
+               const int k = idx[j];
+               mesh.GetElementTransformation(elem_ids[k], &T);
+               T.SetIntPoint(&ips[k]);
+               const DenseMatrix &Jk = T.Jacobian();
+               std::copy(Jk.Data(), Jk.Data() + dim*dim, h_jac + dim*dim*j);
+            }
+         }
+         switch (dim)
+         {
+            case 1: ApplyInverseJacobians<1>(n, vdim, jac, res); break;
+            case 2: ApplyInverseJacobians<2>(n, vdim, jac, res); break;
+            case 3: ApplyInverseJacobians<3>(n, vdim, jac, res); break;
+         }
+      }
+
+      const int *d_idx = idx.Read();
+      const double *R = res.Read();
+      double *Y = out.ReadWrite();
+      mfem::forall(n, [=] MFEM_HOST_DEVICE (int j)
+      {
+         const int k = d_idx[j];
+         for (int q = 0; q < ncomp; q++)
+         {
+            Y[byvdim ? q + ncomp*k : k + npts*q] = R[q + ncomp*j];
+         }
+      });
+   }
+
+   // Points in elements that are not supported by the batched kernels
+   if (host_pts.Size() == 0) { return; }
+   double *h_out = out.HostReadWrite();
+   IsoparametricTransformation T;
+   Vector val;
+   DenseMatrix grad;
+   for (int k : host_pts)
+   {
+      mesh.GetElementTransformation(elem_ids[k], &T);
+      T.SetIntPoint(&ips[k]);
+      if (!grads)
+      {
+         gf.GetVectorValue(T, ips[k], val);
+      }
+      else if (vdim == 1)
+      {
+         gf.GetGradient(T, val);
+      }
+      else
+      {
+         gf.GetVectorGradient(T, grad);
+         val.SetDataAndSize(grad.Data(), ncomp);
+      }
+      for (int q = 0; q < ncomp; q++)
+      {
+         h_out[byvdim ? q + ncomp*k : k + npts*q] = val(q);
+      }
+   }
+}
+
+void GridFunction::GetPointValues(const Array<int> &elem_ids,
+                                  const Array<IntegrationPoint> &ips,
+                                  Vector &vals, Ordering::Type ordering) const
+{
+   EvalPoints(*this, elem_ids, ips, false, vals, ordering);
+}
+
+void GridFunction::GetPointGradients(const Array<int> &elem_ids,
+                                     const Array<IntegrationPoint> &ips,
+                                     Vector &grads,
+                                     Ordering::Type ordering) const
+{
+   EvalPoints(*this, elem_ids, ips, true, grads, ordering);
+}
+
+} // namespace mfem
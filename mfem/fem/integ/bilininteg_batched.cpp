@@ -0,0 +1,367 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../bilininteg.hpp"
+#include "../gridfunc.hpp"
+#include "../eltrans_batch.hpp"
+#include "bilininteg_batched_kernels.hpp"
+
+// Batched element matrices (see AssembleElementMatrices) for the integrators
+// used with legacy (full) assembly. The quadrature rules are chosen as in the
+// corresponding AssembleElementMatrix methods.
+
+namespace mfem
+{
+
+using internal::BatchedBasis;
+
+static bool IsScalarValueElement(const FiniteElement &el)
+{
+   return el.GetRangeType() == FiniteElement::SCALAR &&
+          el.GetMapType() == FiniteElement::VALUE;
+}
+
+// Values of the coefficient @a Q at the points of @a ir in the elements
+// [e_begin, e_begin + ne), stored as in CoefficientVector with COMPRESSED
+// storage: a single value for constant (or NULL) coefficients, (NQ, ne) values
+// otherwise.
+static void BatchedCoefficient(Coefficient *Q, const FiniteElementSpace &fes,
+                               const IntegrationRule &ir, const int e_begin,
+                               const int ne, Vector &C)
+{
+   if (Q == NULL || dynamic_cast<ConstantCoefficient*>(Q))
+   {
+      C.SetSize(1);
+      C = Q ? static_cast<ConstantCoefficient*>(Q)->constant : 1.0;
+      return;
+   }
+   const int NQ = ir.GetNPoints();
+   C.SetSize(NQ*ne);
+   double *c = C.HostWrite();
+   IsoparametricTransformation T;
+   for (int e = 0; e < ne; e++)
+   {
+      fes.GetMesh()->GetElementTransformation(e_begin + e, &T);
+      for (int q = 0; q < NQ; q++)
+      {
+         const IntegrationPoint &ip = ir.IntPoint(q);
+         T.SetIntPoint(&ip);
+         c[q + NQ*e] = Q->Eval(T, ip);
+      }
+   }
+}
+
+// Same as above for a vector coefficient @a VQ with @a vdim components, with
+// layout (vdim) for constant coefficients and (vdim, NQ, ne) otherwise.
+static void BatchedCoefficient(VectorCoefficient &VQ,
+                               const FiniteElementSpace &fes,
+                               const IntegrationRule &ir, const int e_begin,
+                               const int ne, Vector &C)
+{
+   const int vdim = VQ.GetVDim();
+   if (auto *const_VQ = dynamic_cast<VectorConstantCoefficient*>(&VQ))
+   {
+      C = const_VQ->GetVec();
+      return;
+   }
+   const int NQ = ir.GetNPoints();
+   C.SetSize(vdim*NQ*ne);
+   C.HostWrite();
+   IsoparametricTransformation T;
+   Vector cq;
+   for (int e = 0; e < ne; e++)
+   {
+      fes.GetMesh()->GetElementTransformation(e_begin + e, &T);
+      for (int q = 0; q < NQ; q++)
+      {
+         const IntegrationPoint &ip = ir.IntPoint(q);
+         T.SetIntPoint(&ip);
+         cq.SetDataAndSize(C.GetData() + vdim*(q + NQ*e), vdim);
+         VQ.Eval(cq, T, ip);
+      }
+   }
+}
+
+// Compute the element matrices sum_q B^T D_e B of the elements [e_begin,
+// e_begin + emats.SizeK()) with the reference basis of type @a type and
+// quadrature data computed by @a setup from the Jacobians at the points of
+// @a ir. The Jacobians passed to @a setup are those of the elements of
+// @a emats, numbered from zero.
+static void AssembleBatched(const FiniteElementSpace &fes,
+                            const IntegrationRule &ir,
+                            const BatchedBasis type, const int vdim,
+                            const std::function<void(int, int, const Vector&,
+                                                     Vector&)> &setup,
+                            DenseTensor &emats, const bool add,
+                            const int e_begin,
+                            const bool block_diag = false)
+{
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   const int ne = emats.SizeK();
+   MFEM_VERIFY(e_begin >= 0 && e_begin + ne <= fes.GetNE(),
+               "invalid element range");
+   Vector B;
+   internal::BatchedElementBasis(el, ir, type, B);
+   const int ND = el.GetDof();
+   const int NQ = ir.GetNPoints();
+   const int NC = B.Size() / (NQ*ND);
+   const int dim = mesh->Dimension();
+
+   // The Jacobians are computed in the elements of the range only, instead of
+   // using the (cached) GeometricFactors of the whole mesh.
+   ElementTransformationBatch eltrans(*mesh, ir, el.GetGeomType());
+   eltrans.Compute(e_begin, e_begin + ne);
+   Vector J(eltrans.GetJacobians());
+   IsoparametricTransformation T;
+   for (int e = 0; e < ne; e++)
+   {
+      if (eltrans.IsBatched(e_begin + e)) { continue; }
+      // Elements with a different transformation FiniteElement.
+      mesh->GetElementTransformation(e_begin + e, &T);
+      for (int q = 0; q < NQ; q++)
+      {
+         T.SetIntPoint(&ir.IntPoint(q));
+         const DenseMatrix &Jq = T.Jacobian();
+         for (int j = 0; j < dim; j++)
+         {
+            for (int i = 0; i < dim; i++)
+            {
+               J(q + NQ*(i + dim*(j + dim*e))) = Jq(i,j);
+            }
+         }
+      }
+   }
+   internal::BatchedElementMatrices(
+      ne, ND, NQ, NC, vdim, B,
+      [&](const int e0, const int nb, Vector &D) { setup(e0, nb, J, D); },
+      emats, add, block_diag);
+}
+
+bool MassIntegrator::SupportsBatchedElementMatrices(
+   const FiniteElementSpace &fes) const
+{
+   return internal::BatchedElementMatricesSupported(fes, 1) &&
+          IsScalarValueElement(*fes.GetFE(0));
+}
+
+void MassIntegrator::AssembleElementMatrices(const FiniteElementSpace &fes,
+                                             DenseTensor &emats,
+                                             const bool add,
+                                             const int e_begin)
+{
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation &T = *fes.GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, T);
+   const int dim = mesh->Dimension();
+   const int NQ = ir->GetNPoints();
+   Vector coeff;
+   BatchedCoefficient(Q, fes, *ir, e_begin, emats.SizeK(), coeff);
+   const Array<double> &W = ir->GetWeights();
+   AssembleBatched(fes, *ir, BatchedBasis::VALUE, 1,
+                   [&](int e0, int nb, const Vector &J, Vector &D)
+   {
+      internal::BatchedMassSetup(dim, NQ, 1, e0, nb, W, J, coeff, false, D);
+   }, emats, add, e_begin);
+}
+
+bool DiffusionIntegrator::SupportsBatchedElementMatrices(
+   const FiniteElementSpace &fes) const
+{
+   return !VQ && !MQ && !patchRules && fes.GetMesh()->Dimension() > 1 &&
+          internal::BatchedElementMatricesSupported(fes, 1) &&
+          IsScalarValueElement(*fes.GetFE(0));
+}
+
+void DiffusionIntegrator::AssembleElementMatrices(
+   const FiniteElementSpace &fes, DenseTensor &emats, const bool add,
+   const int e_begin)
+{
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el);
+   const int dim = mesh->Dimension();
+   const int NQ = ir->GetNPoints();
+   Vector coeff;
+   BatchedCoefficient(Q, fes, *ir, e_begin, emats.SizeK(), coeff);
+   const Array<double> &W = ir->GetWeights();
+   AssembleBatched(fes, *ir, BatchedBasis::GRAD, 1,
+                   [&](int e0, int nb, const Vector &J, Vector &D)
+   {
+      internal::BatchedAdjugateSetup(dim, NQ, e0, nb, W, J, coeff, D);
+   }, emats, add, e_begin);
+}
+
+bool VectorMassIntegrator::SupportsBatchedElementMatrices(
+   const FiniteElementSpace &fes) const
+{
+   const int sdim = fes.GetMesh()->SpaceDimension();
+   return !MQ &&
+          internal::BatchedElementMatricesSupported(
+             fes, (vdim == -1) ? sdim : vdim) &&
+          IsScalarValueElement(*fes.GetFE(0));
+}
+
+void VectorMassIntegrator::AssembleElementMatrices(
+   const FiniteElementSpace &fes, DenseTensor &emats, const bool add,
+   const int e_begin)
+{
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation &T = *fes.GetElementTransformation(0);
+   vdim = (vdim == -1) ? mesh->SpaceDimension() : vdim;
+   const IntegrationRule *ir = IntRule;
+   if (ir == NULL)
+   {
+      const int order = 2 * el.GetOrder() + T.OrderW() + Q_order;
+      ir = (el.Space() == FunctionSpace::rQk) ?
+           &RefinedIntRules.Get(el.GetGeomType(), order) :
+           &IntRules.Get(el.GetGeomType(), order);
+   }
+   const int dim = mesh->Dimension();
+   const int NQ = ir->GetNPoints();
+   const int VDIM = vdim;
+   Vector coeff;
+   if (VQ) { BatchedCoefficient(*VQ, fes, *ir, e_begin, emats.SizeK(), coeff); }
+   else { BatchedCoefficient(Q, fes, *ir, e_begin, emats.SizeK(), coeff); }
+   const Array<double> &W = ir->GetWeights();
+   AssembleBatched(fes, *ir, BatchedBasis::VALUE, VDIM,
+                   [&](int e0, int nb, const Vector &J, Vector &D)
+   {
+      internal::BatchedMassSetup(dim, NQ, VDIM, e0, nb, W, J,
+                                 coeff, VQ != NULL, D);
+   }, emats, add, e_begin, true);
+}
+
+bool CurlCurlIntegrator::SupportsBatchedElementMatrices(
+   const FiniteElementSpace &fes) const
+{
+   if (MQ || DQ || !internal::BatchedElementMatricesSupported(fes, 1))
+   {
+      return false;
+   }
+   const FiniteElement &el = *fes.GetFE(0);
+   return el.GetDim() > 1 && el.GetMapType() == FiniteElement::H_CURL &&
+          el.GetDerivType() == FiniteElement::CURL;
+}
+
+void CurlCurlIntegrator::AssembleElementMatrices(
+   const FiniteElementSpace &fes, DenseTensor &emats, const bool add,
+   const int e_begin)
+{
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule *ir = IntRule;
+   if (ir == NULL)
+   {
+      const int order = (el.Space() == FunctionSpace::Pk) ?
+                        2*el.GetOrder() - 2 : 2*el.GetOrder();
+      ir = &IntRules.Get(el.GetGeomType(), order);
+   }
+   const int dim = mesh->Dimension();
+   const int NQ = ir->GetNPoints();
+   Vector coeff;
+   BatchedCoefficient(Q, fes, *ir, e_begin, emats.SizeK(), coeff);
+   const Array<double> &W = ir->GetWeights();
+   AssembleBatched(fes, *ir, BatchedBasis::CURL, 1,
+                   [&](int e0, int nb, const Vector &J, Vector &D)
+   {
+      internal::BatchedJacobianSetup(dim, NQ, e0, nb, dim == 2, W, J, coeff, D);
+   }, emats, add, e_begin);
+}
+
+bool VectorFEMassIntegrator::SupportsBatchedElementMatrices(
+   const FiniteElementSpace &fes) const
+{
+   if (MQ || DQ || !internal::BatchedElementMatricesSupported(fes, 1))
+   {
+      return false;
+   }
+   const FiniteElement &el = *fes.GetFE(0);
+   return el.GetDim() > 1 && (el.GetMapType() == FiniteElement::H_CURL ||
+                              el.GetMapType() == FiniteElement::H_DIV);
+}
+
+void VectorFEMassIntegrator::AssembleElementMatrices(
+   const FiniteElementSpace &fes, DenseTensor &emats, const bool add,
+   const int e_begin)
+{
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation &T = *fes.GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule;
+   if (ir == NULL)
+   {
+      const int order = T.OrderW() + 2 * el.GetOrder();
+      ir = &IntRules.Get(el.GetGeomType(), order);
+   }
+   const int dim = mesh->Dimension();
+   const int NQ = ir->GetNPoints();
+   const bool hcurl = el.GetMapType() == FiniteElement::H_CURL;
+   Vector coeff;
+   BatchedCoefficient(Q, fes, *ir, e_begin, emats.SizeK(), coeff);
+   const Array<double> &W = ir->GetWeights();
+   AssembleBatched(fes, *ir, BatchedBasis::VECTOR, 1,
+                   [&](int e0, int nb, const Vector &J, Vector &D)
+   {
+      // H(curl) functions map with J^{-T}, H(div) functions with J/det(J)
+      if (hcurl)
+      {
+         internal::BatchedAdjugateSetup(dim, NQ, e0, nb, W, J, coeff, D);
+      }
+      else
+      {
+         internal::BatchedJacobianSetup(dim, NQ, e0, nb, false, W, J, coeff, D);
+      }
+   }, emats, add, e_begin);
+}
+
+bool ElasticityIntegrator::SupportsBatchedElementMatrices(
+   const FiniteElementSpace &fes) const
+{
+   const int dim = fes.GetMesh()->Dimension();
+   return dim > 1 && internal::BatchedElementMatricesSupported(fes, dim) &&
+          IsScalarValueElement(*fes.GetFE(0));
+}
+
+void ElasticityIntegrator::AssembleElementMatrices(
+   const FiniteElementSpace &fes, DenseTensor &emats, const bool add,
+   const int e_begin)
+{
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation &T = *fes.GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule;
+   if (ir == NULL)
+   {
+      const int order = 2 * T.OrderGrad(&el);
+      ir = &IntRules.Get(el.GetGeomType(), order);
+   }
+   const int dim = mesh->Dimension();
+   const int NQ = ir->GetNPoints();
+   // With a single coefficient: lambda = q_lambda * mu, mu = q_mu * mu
+   Vector mu_coeff, lambda_coeff;
+   BatchedCoefficient(mu, fes, *ir, e_begin, emats.SizeK(), mu_coeff);
+   BatchedCoefficient(lambda ? lambda : mu, fes, *ir, e_begin, emats.SizeK(),
+                      lambda_coeff);
+   const double lf = lambda ? 1.0 : q_lambda;
+   const double mf = lambda ? 1.0 : q_mu;
+   const Array<double> &W = ir->GetWeights();
+   AssembleBatched(fes, *ir, BatchedBasis::GRAD, dim,
+                   [&](int e0, int nb, const Vector &J, Vector &D)
+   {
+      internal::BatchedElasticitySetup(dim, NQ, e0, nb, W, J,
+                                       lf, lambda_coeff, mf, mu_coeff, D);
+   }, emats, add, e_begin);
+}
+
+} // namespace mfem
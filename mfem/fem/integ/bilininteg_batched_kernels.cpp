@@ -0,0 +1,424 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bilininteg_batched_kernels.hpp"
+#include "../../general/forall.hpp"
+#include "../../linalg/kernels.hpp"
+#include "../../mesh/mesh.hpp"
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// Upper bound on the number of doubles in the temporary (D,T) arrays used for
+// one batch of elements in BatchedElementMatrices.
+static constexpr int BATCHED_EMAT_ENTRIES = 1 << 22;
+
+bool BatchedElementMatricesSupported(const FiniteElementSpace &fes,
+                                     const int vdim)
+{
+   const Mesh &mesh = *fes.GetMesh();
+   if (fes.GetNE() == 0 || fes.GetVDim() != vdim || fes.IsVariableOrder() ||
+       fes.GetNURBSext())
+   {
+      return false;
+   }
+   const int dim = mesh.Dimension();
+   return dim == mesh.SpaceDimension() && mesh.GetNumGeometries(dim) == 1;
+}
+
+void BatchedElementBasis(const FiniteElement &fe, const IntegrationRule &ir,
+                         const BatchedBasis type, Vector &B)
+{
+   const int ND = fe.GetDof();
+   const int NQ = ir.GetNPoints();
+   const int dim = fe.GetDim();
+   const int NC = (type == BatchedBasis::VALUE) ? 1 :
+                  (type == BatchedBasis::CURL) ? fe.GetCurlDim() : dim;
+
+   B.SetSize(NQ*NC*ND);
+   auto b = Reshape(B.HostWrite(), NQ, NC, ND);
+   Vector shape(type == BatchedBasis::VALUE ? ND : 0);
+   DenseMatrix dshape(ND, NC);
+   for (int q = 0; q < NQ; q++)
+   {
+      const IntegrationPoint &ip = ir.IntPoint(q);
+      switch (type)
+      {
+         case BatchedBasis::VALUE:
+            fe.CalcShape(ip, shape);
+            for (int i = 0; i < ND; i++) { b(q,0,i) = shape(i); }
+            continue;
+         case BatchedBasis::GRAD: fe.CalcDShape(ip, dshape); break;
+         case BatchedBasis::VECTOR: fe.CalcVShape(ip, dshape); break;
+         case BatchedBasis::CURL: fe.CalcCurlShape(ip, dshape); break;
+      }
+      for (int i = 0; i < ND; i++)
+      {
+         for (int c = 0; c < NC; c++) { b(q,c,i) = dshape(i,c); }
+      }
+   }
+}
+
+void BatchedElementMatrices(const int NE, const int ND, const int NQ,
+                            const int NC, const int VDIM,
+                            const Vector &B,
+                            const BatchedQuadratureSetup &setup,
+                            DenseTensor &emats,
+                            const bool add,
+                            const bool block_diag)
+{
+   const int VC = VDIM*NC;
+   const int VN = VDIM*ND;
+   MFEM_VERIFY(emats.SizeI() == VN && emats.SizeJ() == VN &&
+               emats.SizeK() == NE, "invalid element matrices size");
+
+   // Elements are processed in batches: the quadrature data D (NQ,VC,VC) and
+   // the products T = D B (NQ,VC,VN) of a batch are kept in temporaries of
+   // bounded size.
+   const int per_elem = NQ*VC*(VC + VN);
+   const int NB = std::max(1, std::min(NE, BATCHED_EMAT_ENTRIES / per_elem));
+   Vector D(NQ*VC*VC*NB), T(NQ*VC*VN*NB);
+
+   // Transposed basis, Bt(i,k) = B(q,a,i) with k = q + NQ a.
+   Vector Bt(ND*NQ*NC);
+   {
+      const auto b = Reshape(B.Read(), NQ*NC, ND);
+      auto bt = Reshape(Bt.Write(), ND, NQ*NC);
+      mfem::forall(ND*NQ*NC, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int i = idx % ND;
+         const int k = idx / ND;
+         bt(i,k) = b(k,i);
+      });
+   }
+
+   const auto b = Reshape(B.Read(), NQ, NC, ND);
+   const auto bt = Reshape(Bt.Read(), ND, NQ*NC);
+   auto M = Reshape(add ? emats.ReadWrite() : emats.Write(), VN, VN, NE);
+   for (int e0 = 0; e0 < NE; e0 += NB)
+   {
+      const int nb = std::min(NB, NE - e0);
+      setup(e0, nb, D);
+
+      // T(q,A,j + ND c2) = sum_b D(q,A,b + NC c2) B(q,b,j)
+      const auto d = Reshape(D.Read(), NQ, VC, VC, NB);
+      auto t = Reshape(T.Write(), NQ, VC, VN, NB);
+      mfem::forall(nb*VN, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int J = idx % VN;
+         const int e = idx / VN;
+         const int j = J % ND;
+         const int c2 = J / ND;
+         const int A_begin = block_diag ? NC*c2 : 0;
+         const int A_end = block_diag ? NC*(c2 + 1) : VC;
+         for (int A = A_begin; A < A_end; A++)
+         {
+            for (int q = 0; q < NQ; q++) { t(q,A,J,e) = 0.0; }
+            for (int bb = 0; bb < NC; bb++)
+            {
+               for (int q = 0; q < NQ; q++)
+               {
+                  t(q,A,J,e) += d(q,A,bb + NC*c2,e) * b(q,bb,j);
+               }
+            }
+         }
+      });
+
+      // A_e(i + ND c1,J) = sum_k Bt(i,k) T(k,c1,J), with k = q + NQ a: each
+      // thread accumulates the upper part of the (contiguous) column J of one
+      // element matrix, which is then mirrored to the lower part.
+      const auto tt = Reshape(T.Read(), NQ*NC, VDIM, VN, NB);
+      mfem::forall(nb*VN, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int J = idx % VN;
+         const int e = idx / VN;
+         const int j = J % ND;
+         const int c2 = J / ND;
+         if (!add)
+         {
+            for (int I = 0; I <= J; I++) { M(I,J,e0+e) = 0.0; }
+         }
+         for (int c1 = block_diag ? c2 : 0; c1 <= c2; c1++)
+         {
+            const int i_end = (c1 == c2) ? j + 1 : ND;
+            for (int k = 0; k < NQ*NC; k++)
+            {
+               const double tk = tt(k,c1,J,e);
+               for (int i = 0; i < i_end; i++)
+               {
+                  M(i + ND*c1,J,e0+e) += bt(i,k) * tk;
+               }
+            }
+         }
+      });
+      mfem::forall(nb*VN, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int J = idx % VN;
+         const int e = idx / VN;
+         for (int I = 0; I < J; I++) { M(J,I,e0+e) = M(I,J,e0+e); }
+      });
+   }
+}
+
+// Coefficient values stored as in CoefficientVector with COMPRESSED storage:
+// either a single constant or (NQ,NE) values.
+#define MFEM_BATCHED_COEFF(C, c, NQ, NE) \
+   const bool const_##c = C.Size() == 1; \
+   const auto c = const_##c ? Reshape(C.Read(), 1, 1) : \
+                  Reshape(C.Read(), NQ, NE)
+#define MFEM_BATCHED_COEFF_EVAL(c, q, e) (const_##c ? c(0,0) : c(q,e))
+
+// Compute the inverses and the determinants of the Jacobians J (layout (NQ,
+// DIM, DIM, NE)) of the elements [e0, e0+nb), with the batched interleaved
+// kernels: the Jacobians at the quadrature points of one element are stored
+// as NQ interleaved matrices.
+template <int DIM>
+static void BatchedInverseJacobians(const int NQ, const int e0, const int nb,
+                                    const Vector &J, Vector &Jinv,
+                                    Vector &detJ)
+{
+   Vector Jb;
+   Jb.MakeRef(const_cast<Vector&>(J), NQ*DIM*DIM*e0, NQ*DIM*DIM*nb);
+   BatchInverse(DIM, NQ, Jb, Jinv);
+   BatchDet(DIM, NQ, Jb, detJ);
+}
+
+template <int DIM>
+static inline MFEM_HOST_DEVICE void BatchedLoadJacobian(
+   const DeviceTensor<4, const double> &J, const int q, const int e,
+   double *Jq)
+{
+   for (int n = 0; n < DIM; n++)
+   {
+      for (int m = 0; m < DIM; m++) { Jq[m + DIM*n] = J(q,m,n,e); }
+   }
+}
+
+void BatchedMassSetup(const int dim, const int NQ, const int vdim,
+                      const int e0, const int nb,
+                      const Array<double> &W, const Vector &J,
+                      const Vector &C, const bool vector_c, Vector &D)
+{
+   const int NE = J.Size() / (NQ*dim*dim);
+   const int cdim = vector_c ? vdim : 1;
+   const auto w = Reshape(W.Read(), NQ);
+   const auto j = Reshape(J.Read(), NQ, dim, dim, NE);
+   const bool const_c = C.Size() == cdim;
+   const auto c = const_c ? Reshape(C.Read(), cdim, 1, 1) :
+                  Reshape(C.Read(), cdim, NQ, NE);
+   auto d = Reshape(D.Write(), NQ, vdim, vdim, nb);
+   mfem::forall(nb*NQ, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ;
+      const int e = idx / NQ;
+      double Jq[9];
+      double detJ = 0.0;
+      if (dim == 1) { detJ = j(q,0,0,e0+e); }
+      else if (dim == 2)
+      {
+         BatchedLoadJacobian<2>(j, q, e0+e, Jq);
+         detJ = kernels::Det<2>(Jq);
+      }
+      else
+      {
+         BatchedLoadJacobian<3>(j, q, e0+e, Jq);
+         detJ = kernels::Det<3>(Jq);
+      }
+      const double wdetJ = w(q) * detJ;
+      for (int c2 = 0; c2 < vdim; c2++)
+      {
+         const int k = vector_c ? c2 : 0;
+         const double val = wdetJ * (const_c ? c(k,0,0) : c(k,q,e0+e));
+         for (int c1 = 0; c1 < vdim; c1++)
+         {
+            d(q,c1,c2,e) = (c1 == c2) ? val : 0.0;
+         }
+      }
+   });
+}
+
+template <int DIM>
+static void BatchedAdjugateSetup(const int NQ, const int e0, const int nb,
+                                 const Array<double> &W, const Vector &J,
+                                 const Vector &C, Vector &D)
+{
+   const int NE = J.Size() / (NQ*DIM*DIM);
+   Vector Jinv, detJ;
+   BatchedInverseJacobians<DIM>(NQ, e0, nb, J, Jinv, detJ);
+   const auto w = Reshape(W.Read(), NQ);
+   const auto ji = Reshape(Jinv.Read(), NQ, DIM, DIM, nb);
+   const auto dj = Reshape(detJ.Read(), NQ, nb);
+   MFEM_BATCHED_COEFF(C, c, NQ, NE);
+   auto d = Reshape(D.Write(), NQ, DIM, DIM, nb);
+   mfem::forall(nb*NQ, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ;
+      const int e = idx / NQ;
+      // adj(J) = det(J) J^{-1}
+      const double val = w(q) * MFEM_BATCHED_COEFF_EVAL(c, q, e0+e) * dj(q,e);
+      for (int b = 0; b < DIM; b++)
+      {
+         for (int a = 0; a < DIM; a++)
+         {
+            double s = 0.0;
+            for (int m = 0; m < DIM; m++) { s += ji(q,a,m,e) * ji(q,b,m,e); }
+            d(q,a,b,e) = val * s;
+         }
+      }
+   });
+}
+
+void BatchedAdjugateSetup(const int dim, const int NQ,
+                          const int e0, const int nb,
+                          const Array<double> &W, const Vector &J,
+                          const Vector &C, Vector &D)
+{
+   switch (dim)
+   {
+      case 2: return BatchedAdjugateSetup<2>(NQ, e0, nb, W, J, C, D);
+      case 3: return BatchedAdjugateSetup<3>(NQ, e0, nb, W, J, C, D);
+   }
+   MFEM_ABORT("Unsupported dimension " << dim);
+}
+
+template <int DIM>
+static void BatchedJacobianSetup(const int NQ, const int e0, const int nb,
+                                 const bool scalar_curl,
+                                 const Array<double> &W, const Vector &J,
+                                 const Vector &C, Vector &D)
+{
+   const int NE = J.Size() / (NQ*DIM*DIM);
+   const int NC = scalar_curl ? 1 : DIM;
+   const auto w = Reshape(W.Read(), NQ);
+   const auto j = Reshape(J.Read(), NQ, DIM, DIM, NE);
+   MFEM_BATCHED_COEFF(C, c, NQ, NE);
+   auto d = Reshape(D.Write(), NQ, NC, NC, nb);
+   mfem::forall(nb*NQ, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ;
+      const int e = idx / NQ;
+      double Jq[DIM*DIM];
+      BatchedLoadJacobian<DIM>(j, q, e0+e, Jq);
+      const double val = w(q) * MFEM_BATCHED_COEFF_EVAL(c, q, e0+e) /
+                         kernels::Det<DIM>(Jq);
+      if (scalar_curl) { d(q,0,0,e) = val; return; }
+      for (int b = 0; b < DIM; b++)
+      {
+         for (int a = 0; a < DIM; a++)
+         {
+            double s = 0.0;
+            for (int m = 0; m < DIM; m++)
+            {
+               s += Jq[m + DIM*a] * Jq[m + DIM*b];
+            }
+            d(q,a,b,e) = val * s;
+         }
+      }
+   });
+}
+
+void BatchedJacobianSetup(const int dim, const int NQ,
+                          const int e0, const int nb,
+                          const bool scalar_curl,
+                          const Array<double> &W, const Vector &J,
+                          const Vector &C, Vector &D)
+{
+   switch (dim)
+   {
+      case 2:
+         return BatchedJacobianSetup<2>(NQ, e0, nb, scalar_curl, W, J, C, D);
+      case 3:
+         return BatchedJacobianSetup<3>(NQ, e0, nb, scalar_curl, W, J, C, D);
+   }
+   MFEM_ABORT("Unsupported dimension " << dim);
+}
+
+template <int DIM>
+static void BatchedElasticitySetup(const int NQ, const int e0, const int nb,
+                                   const Array<double> &W, const Vector &J,
+                                   const double lf, const Vector &L,
+                                   const double mf, const Vector &M,
+                                   Vector &D)
+{
+   const int NE = J.Size() / (NQ*DIM*DIM);
+   Vector Jinv, detJ;
+   BatchedInverseJacobians<DIM>(NQ, e0, nb, J, Jinv, detJ);
+   const auto w = Reshape(W.Read(), NQ);
+   const auto ji = Reshape(Jinv.Read(), NQ, DIM*DIM, nb);
+   const auto dj = Reshape(detJ.Read(), NQ, nb);
+   MFEM_BATCHED_COEFF(L, l, NQ, NE);
+   MFEM_BATCHED_COEFF(M, m, NQ, NE);
+   auto d = Reshape(D.Write(), NQ, DIM, DIM, DIM, DIM, nb);
+   mfem::forall(nb*NQ, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ;
+      const int e = idx / NQ;
+      double Ji[DIM*DIM];
+      for (int i = 0; i < DIM*DIM; i++) { Ji[i] = ji(q,i,e); }
+      const double wdetJ = w(q) * dj(q,e);
+      const double lw = wdetJ * lf * MFEM_BATCHED_COEFF_EVAL(l, q, e0+e);
+      const double mw = wdetJ * mf * MFEM_BATCHED_COEFF_EVAL(m, q, e0+e);
+      // With the physical gradients g = dshape J^{-1}, the element matrix is
+      //    lambda (div u, div v) + mu (grad u, grad v) + mu (grad u^T, grad v)
+      // which gives, for components c1, c2 and reference directions a, b:
+      //    lambda Ji(a,c1) Ji(b,c2) + mu delta(c1,c2) (Ji Ji^T)(a,b)
+      //    + mu Ji(a,c2) Ji(b,c1)
+      for (int c2 = 0; c2 < DIM; c2++)
+      {
+         for (int b = 0; b < DIM; b++)
+         {
+            for (int c1 = 0; c1 < DIM; c1++)
+            {
+               for (int a = 0; a < DIM; a++)
+               {
+                  double s = lw * Ji[a + DIM*c1] * Ji[b + DIM*c2] +
+                             mw * Ji[a + DIM*c2] * Ji[b + DIM*c1];
+                  if (c1 == c2)
+                  {
+                     for (int k = 0; k < DIM; k++)
+                     {
+                        s += mw * Ji[a + DIM*k] * Ji[b + DIM*k];
+                     }
+                  }
+                  d(q,a,c1,b,c2,e) = s;
+               }
+            }
+         }
+      }
+   });
+}
+
+void BatchedElasticitySetup(const int dim, const int NQ,
+                            const int e0, const int nb,
+                            const Array<double> &W, const Vector &J,
+                            const double lf, const Vector &L,
+                            const double mf, const Vector &M,
+                            Vector &D)
+{
+   switch (dim)
+   {
+      case 2:
+         return BatchedElasticitySetup<2>(NQ, e0, nb, W, J, lf, L, mf, M, D);
+      case 3:
+         return BatchedElasticitySetup<3>(NQ, e0, nb, W, J, lf, L, mf, M, D);
+   }
+   MFEM_ABORT("Unsupported dimension " << dim);
+}
+
+#undef MFEM_BATCHED_COEFF
+#undef MFEM_BATCHED_COEFF_EVAL
+
+} // namespace internal
+
+} // namespace mfem
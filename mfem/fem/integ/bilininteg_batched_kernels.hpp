@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BILININTEG_BATCHED_KERNELS_HPP
+#define MFEM_BILININTEG_BATCHED_KERNELS_HPP
+
+#include "../../config/config.hpp"
+#include "../../linalg/densemat.hpp"
+#include "../../linalg/vector.hpp"
+#include "../fe/fe_base.hpp"
+#include "../fespace.hpp"
+#include <functional>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+/// Reference-space basis data used by the batched element matrix assembly.
+enum class BatchedBasis
+{
+   VALUE, ///< Scalar shape functions, 1 component.
+   GRAD,  ///< Reference gradients of scalar shape functions, dim components.
+   VECTOR,///< Reference vector shape functions, dim components.
+   CURL   ///< Reference curls of vector shape functions, curl dim components.
+};
+
+/** @brief Return true if the element matrices of @a fes can be computed with
+    BatchedElementMatrices(): a single element geometry and order, a square
+    element Jacobian, no NURBS, and @a vdim vector components. */
+bool BatchedElementMatricesSupported(const FiniteElementSpace &fes,
+                                     const int vdim);
+
+/** @brief Evaluate the reference basis of type @a type of @a fe at the points
+    of @a ir, once for all elements. The result @a B has layout (NQ, NC, ND),
+    where NC is the number of components of the basis type. */
+void BatchedElementBasis(const FiniteElement &fe, const IntegrationRule &ir,
+                         const BatchedBasis type, Vector &B);
+
+/** @brief Callback computing the quadrature point data of the elements
+    [e0, e0+nb) of a batch, see BatchedElementMatrices(). */
+using BatchedQuadratureSetup =
+   std::function<void(const int e0, const int nb, Vector &D)>;
+
+/** @brief Compute the element matrices
+
+      A_e(i + ND c1, j + ND c2) = sum_q sum_{a,b} B(q,a,i) D_e(q,A,B) B(q,b,j),
+
+    where A = a + NC c1 and B = b + NC c2, for all NE elements, in batches of
+    elements of bounded size.
+
+    The reference basis @a B (layout (NQ, NC, ND)) is shared by all elements,
+    see BatchedElementBasis(). For each batch, @a setup fills the quadrature
+    data D with layout (NQ, VDIM*NC, VDIM*NC, nb), which must be symmetric in
+    its second and third indices: only the upper triangle of the element
+    matrices is computed and then mirrored. If @a block_diag is true, D does
+    not couple different components (c1 != c2) and only the diagonal blocks of
+    the element matrices are computed. The element matrices are added to
+    @a emats (layout (VDIM*ND, VDIM*ND, NE)), which must then be symmetric, if
+    @a add is true, otherwise they are set. */
+void BatchedElementMatrices(const int NE, const int ND, const int NQ,
+                            const int NC, const int VDIM,
+                            const Vector &B,
+                            const BatchedQuadratureSetup &setup,
+                            DenseTensor &emats,
+                            const bool add,
+                            const bool block_diag = false);
+
+/** @brief Quadrature data for block diagonal mass terms:
+    D(q,c,c,e) = W(q) det(J) C(c,q,e), c < @a vdim.
+
+    The coefficient C has @a vdim components if @a vector_c is true, otherwise
+    the same scalar coefficient is used for all components. */
+void BatchedMassSetup(const int dim, const int NQ, const int vdim,
+                      const int e0, const int nb,
+                      const Array<double> &W, const Vector &J,
+                      const Vector &C, const bool vector_c, Vector &D);
+
+/** @brief Quadrature data for terms transforming with the adjugate of the
+    Jacobian (gradients of H1 and values of H(curl) functions):
+    D(q,a,b,e) = W(q) C(q,e) / det(J) (adj(J) adj(J)^T)(a,b). */
+void BatchedAdjugateSetup(const int dim, const int NQ,
+                          const int e0, const int nb,
+                          const Array<double> &W, const Vector &J,
+                          const Vector &C, Vector &D);
+
+/** @brief Quadrature data for terms transforming with the Jacobian (values of
+    H(div) and curls of 3D H(curl) functions):
+    D(q,a,b,e) = W(q) C(q,e) / det(J) (J^T J)(a,b).
+
+    In 2D with @a scalar_curl set, the 1-component curl is used instead:
+    D(q,0,0,e) = W(q) C(q,e) / det(J). */
+void BatchedJacobianSetup(const int dim, const int NQ,
+                          const int e0, const int nb,
+                          const bool scalar_curl,
+                          const Array<double> &W, const Vector &J,
+                          const Vector &C, Vector &D);
+
+/** @brief Quadrature data for the linear elasticity term with Lame parameters
+    lambda = @a lf L(q,e) and mu = @a mf M(q,e), acting on the reference
+    gradients of each of the @a dim displacement components. */
+void BatchedElasticitySetup(const int dim, const int NQ,
+                            const int e0, const int nb,
+                            const Array<double> &W, const Vector &J,
+                            const double lf, const Vector &L,
+                            const double mf, const Vector &M,
+                            Vector &D);
+
+} // namespace internal
+
+} // namespace mfem
+
+#endif
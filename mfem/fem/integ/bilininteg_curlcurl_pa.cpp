@@ -11,24 +11,44 @@
 
 #include "../qfunction.hpp"
 #include "bilininteg_hcurl_kernels.hpp"
+#include "../ceed/integrators/curlcurl/curlcurl.hpp"
 
 namespace mfem
 {
 
 void CurlCurlIntegrator::AssemblePA(const FiniteElementSpace &fes)
 {
-   // Assumes tensor-product elements
    Mesh *mesh = fes.GetMesh();
+   if (mesh->GetNE() == 0) { return; }
    const FiniteElement *fel = fes.GetFE(0);
 
+   const IntegrationRule *ir
+      = IntRule ? IntRule : &MassIntegrator::GetRule(*fel, *fel,
+                                                     *mesh->GetElementTransformation(0));
+
+   if (DeviceCanUseCeed())
+   {
+      delete ceedOp;
+      MFEM_VERIFY(!DQ && !MQ, "Only scalar coefficients are supported with"
+                  " libCEED.");
+      const bool mixed = mesh->GetNumGeometries(mesh->Dimension()) > 1 ||
+                         fes.IsVariableOrder();
+      if (mixed)
+      {
+         ceedOp = new ceed::MixedPACurlCurlIntegrator(*this, fes, Q);
+      }
+      else
+      {
+         ceedOp = new ceed::PACurlCurlIntegrator(fes, *ir, Q);
+      }
+      return;
+   }
+
+   // Assumes tensor-product elements
    const VectorTensorFiniteElement *el =
       dynamic_cast<const VectorTensorFiniteElement*>(fel);
    MFEM_VERIFY(el != NULL, "Only VectorTensorFiniteElement is supported!");
 
-   const IntegrationRule *ir
-      = IntRule ? IntRule : &MassIntegrator::GetRule(*el, *el,
-                                                     *mesh->GetElementTransformation(0));
-
    const int dims = el->GetDim();
    MFEM_VERIFY(dims == 2 || dims == 3, "");
 
@@ -77,7 +97,11 @@ void CurlCurlIntegrator::AssemblePA(const FiniteElementSpace &fes)
 
 void CurlCurlIntegrator::AssembleDiagonalPA(Vector& diag)
 {
-   if (dim == 3)
+   if (DeviceCanUseCeed())
+   {
+      ceedOp->GetDiagonal(diag);
+   }
+   else if (dim == 3)
    {
       if (Device::Allows(Backend::DEVICE_MASK))
       {
@@ -146,7 +170,11 @@ void CurlCurlIntegrator::AssembleDiagonalPA(Vector& diag)
 
 void CurlCurlIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
-   if (dim == 3)
+   if (DeviceCanUseCeed())
+   {
+      ceedOp->AddMult(x, y);
+   }
+   else if (dim == 3)
    {
       if (Device::Allows(Backend::DEVICE_MASK))
       {
@@ -0,0 +1,401 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../bilininteg.hpp"
+#include "../gridfunc.hpp"
+#include "../restriction.hpp"
+#include "../fe/face_map_utils.hpp"
+
+namespace mfem
+{
+
+// PA DG Diffusion Integrator
+//
+// At each face quadrature point, the gradient of the function of each side is
+// expressed through its derivatives along the face coordinates of the first
+// element (the lexicographic ordering of L2FaceRestriction) and along the
+// outward normal axis of the reference element of the side, which are given
+// by L2NormalDerivativeFaceRestriction. With M = [t_1, ..., t_{dim-1}, a],
+// where t_i are the tangent vectors of the face and a is the image of the
+// reference normal axis, the flux (Q grad(u)).n is c.du with c = M^{-1} Q^T n,
+// where du is the vector of these derivatives. The quadrature data of each
+// point is (c_1, c_2, kappa {h^{-1} Q}), including the weights.
+
+const IntegrationRule &DGDiffusionIntegrator::GetRule(Geometry::Type geom,
+                                                      int order)
+{
+   return IntRules.Get(geom, 2*order);
+}
+
+void DGDiffusionIntegrator::SetupPA(const FiniteElementSpace &fes,
+                                    FaceType type)
+{
+   const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
+                         Device::GetDeviceMemoryType() : pa_mt;
+
+   nf = fes.GetNFbyType(type);
+   if (nf == 0) { return; }
+   // Assumes tensor-product elements
+   Mesh &mesh = *fes.GetMesh();
+   dim = mesh.Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Only 2D and 3D meshes are supported.");
+   MFEM_VERIFY(mesh.SpaceDimension() == dim,
+               "Surface meshes are not supported.");
+   const FiniteElement &el = *fes.GetTraceElement(0, mesh.GetFaceGeometry(0));
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &GetRule(el.GetGeomType(),
+                                        fes.GetFE(0)->GetOrder());
+   nq = ir->GetNPoints();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+
+   const int nd = 2*dim + 1;
+   pa_data.SetSize(nq*nd*nf, mt);
+   auto op = Reshape(pa_data.HostWrite(), nq, nd, nf);
+
+   Vector nor(dim), qn(dim), c(dim);
+   DenseMatrix M(dim), Minv(dim), mq(dim);
+   int f_ind = 0;
+   for (int f = 0; f < mesh.GetNumFaces(); ++f)
+   {
+      Mesh::FaceInformation face = mesh.GetFaceInformation(f);
+      if (face.IsNonconformingCoarse() || !face.IsOfFaceType(type))
+      {
+         continue;
+      }
+      MFEM_VERIFY(face.IsConforming() || face.IsBoundary(),
+                  "Nonconforming faces are not supported.");
+      const int face_id1 = face.element[0].local_face_id;
+      const int normal1 = internal::GetFaceNormal(dim, face_id1).first;
+      const bool interior = face.IsInterior();
+      const int nsides = interior ? 2 : 1;
+      FaceElementTransformations &T = *mesh.GetFaceElementTransformations(f);
+      for (int q = 0; q < nq; ++q)
+      {
+         // Convert to lexicographic ordering
+         const int iq = ToLexOrdering(dim, face_id1, quad1D, q);
+         const IntegrationPoint &ip = ir->IntPoint(q);
+         T.SetAllIntPoints(&ip);
+         CalcOrtho(T.Jacobian(), nor);
+
+         // Tangent vectors of the face, in the ordering of the first element
+         const DenseMatrix &J1 = T.Elem1->Jacobian();
+         for (int i = 0, k = 0; i < dim; i++)
+         {
+            if (i == normal1) { continue; }
+            for (int j = 0; j < dim; j++) { M(j,k) = J1(j,i); }
+            k++;
+         }
+
+         const double w = interior ? ip.weight/2 : ip.weight;
+         double wq = 0.0;
+         for (int s = 0; s < 2; s++)
+         {
+            if (s >= nsides)
+            {
+               for (int k = 0; k < dim; k++) { op(iq, s*dim + k, f_ind) = 0.0; }
+               continue;
+            }
+            ElementTransformation &Ts = (s == 0) ? *T.Elem1 : *T.Elem2;
+            const IntegrationPoint &eip = (s == 0) ? T.GetElement1IntPoint()
+                                          : T.GetElement2IntPoint();
+            const std::pair<int,int> normal =
+               internal::GetFaceNormal(dim, face.element[s].local_face_id);
+            const DenseMatrix &Js = Ts.Jacobian();
+            const double sgn = normal.second ? 1.0 : -1.0;
+            for (int j = 0; j < dim; j++)
+            {
+               M(j,dim-1) = sgn*Js(j,normal.first);
+            }
+
+            if (MQ)
+            {
+               MQ->Eval(mq, Ts, eip);
+               mq.MultTranspose(nor, qn);
+            }
+            else
+            {
+               qn.Set(Q ? Q->Eval(Ts, eip) : 1.0, nor);
+            }
+            // See DGDiffusionIntegrator::AssembleFaceMatrix() for the size
+            // h = det(J)/|nor| of the element used in the penalty term.
+            wq += w/Ts.Weight()*(qn*nor);
+
+            CalcInverse(M, Minv);
+            Minv.Mult(qn, c);
+            for (int k = 0; k < dim; k++)
+            {
+               op(iq, s*dim + k, f_ind) = w*c(k);
+            }
+         }
+         op(iq, 2*dim, f_ind) = kappa*wq;
+      }
+      f_ind++;
+   }
+   MFEM_VERIFY(f_ind == nf, "Incorrect number of faces.");
+}
+
+void DGDiffusionIntegrator::AssemblePAInteriorFaces(
+   const FiniteElementSpace &fes)
+{
+   SetupPA(fes, FaceType::Interior);
+}
+
+void DGDiffusionIntegrator::AssemblePABoundaryFaces(
+   const FiniteElementSpace &fes)
+{
+   SetupPA(fes, FaceType::Boundary);
+}
+
+// PA DG Diffusion Apply 2D kernel. The values at the quadrature points are
+// combined as
+//    r   = alpha (c_1.du_1 + c_2.du_2) + kappa {h^{-1} Q} [u], tested with [v],
+//    e_s = beta [u] c_s,                                    tested with dv_s,
+// i.e. (alpha, beta) = (-1, sigma) for the action and (sigma, -1) for its
+// transpose.
+static void PADGDiffusionApply2D(const int NF,
+                                 const Array<double> &b,
+                                 const Array<double> &g,
+                                 const Vector &op_,
+                                 const Vector &x_,
+                                 const Vector &dxdn_,
+                                 Vector &y_,
+                                 Vector &dydn_,
+                                 const double alpha,
+                                 const double beta,
+                                 const int D1D,
+                                 const int Q1D)
+{
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto op = Reshape(op_.Read(), Q1D, 5, NF);
+   auto x = Reshape(x_.Read(), D1D, 2, NF);
+   auto dxdn = Reshape(dxdn_.Read(), D1D, 2, NF);
+   auto y = Reshape(y_.ReadWrite(), D1D, 2, NF);
+   auto dydn = Reshape(dydn_.ReadWrite(), D1D, 2, NF);
+
+   mfem::forall(NF, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
+      double r[max_Q1D];
+      double e[2][2][max_Q1D];
+      for (int q = 0; q < Q1D; ++q)
+      {
+         double u[2], du[2][2];
+         for (int s = 0; s < 2; s++)
+         {
+            u[s] = 0.0;
+            du[s][0] = 0.0;
+            du[s][1] = 0.0;
+            for (int d = 0; d < D1D; ++d)
+            {
+               u[s] += B(q,d)*x(d,s,f);
+               du[s][0] += G(q,d)*x(d,s,f);
+               du[s][1] += B(q,d)*dxdn(d,s,f);
+            }
+         }
+         const double jump = u[0] - u[1];
+         double flux = 0.0;
+         for (int s = 0; s < 2; s++)
+         {
+            for (int k = 0; k < 2; k++)
+            {
+               flux += op(q,2*s+k,f)*du[s][k];
+               e[s][k][q] = beta*jump*op(q,2*s+k,f);
+            }
+         }
+         r[q] = alpha*flux + op(q,4,f)*jump;
+      }
+      for (int d = 0; d < D1D; ++d)
+      {
+         for (int s = 0; s < 2; s++)
+         {
+            const double sgn = (s == 0) ? 1.0 : -1.0;
+            double yv = 0.0, ydn = 0.0;
+            for (int q = 0; q < Q1D; ++q)
+            {
+               yv += B(q,d)*sgn*r[q] + G(q,d)*e[s][0][q];
+               ydn += B(q,d)*e[s][1][q];
+            }
+            y(d,s,f) += yv;
+            dydn(d,s,f) += ydn;
+         }
+      }
+   });
+}
+
+// PA DG Diffusion Apply 3D kernel, see PADGDiffusionApply2D.
+static void PADGDiffusionApply3D(const int NF,
+                                 const Array<double> &b,
+                                 const Array<double> &g,
+                                 const Vector &op_,
+                                 const Vector &x_,
+                                 const Vector &dxdn_,
+                                 Vector &y_,
+                                 Vector &dydn_,
+                                 const double alpha,
+                                 const double beta,
+                                 const int D1D,
+                                 const int Q1D)
+{
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto op = Reshape(op_.Read(), Q1D, Q1D, 7, NF);
+   auto x = Reshape(x_.Read(), D1D, D1D, 2, NF);
+   auto dxdn = Reshape(dxdn_.Read(), D1D, D1D, 2, NF);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, 2, NF);
+   auto dydn = Reshape(dydn_.ReadWrite(), D1D, D1D, 2, NF);
+
+   mfem::forall(NF, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int max_D1D = DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
+      // Values (index 0) and derivatives along the two face coordinates and
+      // the normal axis (indices 1 to 3) of both sides at the quadrature points
+      double u[2][4][max_Q1D][max_Q1D];
+      for (int s = 0; s < 2; s++)
+      {
+         double Bx[max_D1D][max_Q1D], Gx[max_D1D][max_Q1D];
+         double Bn[max_D1D][max_Q1D];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               double bx = 0.0, gx = 0.0, bn = 0.0;
+               for (int dy = 0; dy < D1D; ++dy)
+               {
+                  bx += B(qy,dy)*x(dx,dy,s,f);
+                  gx += G(qy,dy)*x(dx,dy,s,f);
+                  bn += B(qy,dy)*dxdn(dx,dy,s,f);
+               }
+               Bx[dx][qy] = bx;
+               Gx[dx][qy] = gx;
+               Bn[dx][qy] = bn;
+            }
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               double v = 0.0, d1 = 0.0, d2 = 0.0, dn = 0.0;
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  v += B(qx,dx)*Bx[dx][qy];
+                  d1 += G(qx,dx)*Bx[dx][qy];
+                  d2 += B(qx,dx)*Gx[dx][qy];
+                  dn += B(qx,dx)*Bn[dx][qy];
+               }
+               u[s][0][qx][qy] = v;
+               u[s][1][qx][qy] = d1;
+               u[s][2][qx][qy] = d2;
+               u[s][3][qx][qy] = dn;
+            }
+         }
+      }
+      // Replace the values and derivatives with the quantities tested with
+      // the values and derivatives of the test functions
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double jump = u[0][0][qx][qy] - u[1][0][qx][qy];
+            double flux = 0.0;
+            for (int s = 0; s < 2; s++)
+            {
+               for (int k = 0; k < 3; k++)
+               {
+                  const double c = op(qx,qy,3*s+k,f);
+                  flux += c*u[s][k+1][qx][qy];
+                  u[s][k+1][qx][qy] = beta*jump*c;
+               }
+            }
+            const double r = alpha*flux + op(qx,qy,6,f)*jump;
+            u[0][0][qx][qy] = r;
+            u[1][0][qx][qy] = -r;
+         }
+      }
+      for (int s = 0; s < 2; s++)
+      {
+         double Bu[max_D1D][max_Q1D], Bd2[max_D1D][max_Q1D];
+         double Bdn[max_D1D][max_Q1D];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               double bu = 0.0, bd2 = 0.0, bdn = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  bu += B(qx,dx)*u[s][0][qx][qy] + G(qx,dx)*u[s][1][qx][qy];
+                  bd2 += B(qx,dx)*u[s][2][qx][qy];
+                  bdn += B(qx,dx)*u[s][3][qx][qy];
+               }
+               Bu[dx][qy] = bu;
+               Bd2[dx][qy] = bd2;
+               Bdn[dx][qy] = bdn;
+            }
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               double yv = 0.0, ydn = 0.0;
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  yv += B(qy,dy)*Bu[dx][qy] + G(qy,dy)*Bd2[dx][qy];
+                  ydn += B(qy,dy)*Bdn[dx][qy];
+               }
+               y(dx,dy,s,f) += yv;
+               dydn(dx,dy,s,f) += ydn;
+            }
+         }
+      }
+   });
+}
+
+void DGDiffusionIntegrator::ApplyPA(const Vector &x, const Vector &dxdn,
+                                    Vector &y, Vector &dydn,
+                                    const double alpha,
+                                    const double beta) const
+{
+   if (nf == 0) { return; }
+   if (dim == 2)
+   {
+      PADGDiffusionApply2D(nf, maps->B, maps->G, pa_data, x, dxdn, y, dydn,
+                           alpha, beta, dofs1D, quad1D);
+   }
+   else
+   {
+      PADGDiffusionApply3D(nf, maps->B, maps->G, pa_data, x, dxdn, y, dydn,
+                           alpha, beta, dofs1D, quad1D);
+   }
+}
+
+void DGDiffusionIntegrator::AddMultPAFaces(const Vector &x, const Vector &dxdn,
+                                           Vector &y, Vector &dydn) const
+{
+   ApplyPA(x, dxdn, y, dydn, -1.0, sigma);
+}
+
+void DGDiffusionIntegrator::AddMultTransposePAFaces(const Vector &x,
+                                                    const Vector &dxdn,
+                                                    Vector &y,
+                                                    Vector &dydn) const
+{
+   ApplyPA(x, dxdn, y, dydn, sigma, -1.0);
+}
+
+} // namespace mfem
@@ -10,6 +10,7 @@
 // CONTRIBUTING.md for details.
 
 #include "bilininteg_diffusion_kernels.hpp"
+#include "../../linalg/kernels.hpp"
 
 namespace mfem
 {
@@ -437,42 +438,113 @@ void PADiffusionApply(const int dim,
       MFEM_ABORT("OCCA PADiffusionApply unknown kernel!");
    }
 #endif // MFEM_USE_OCCA
-   const int id = (D1D << 4) | Q1D;
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension: " << dim);
+   const auto &kernels = PADiffusionApplyKernels(dim);
+   kernels.Get(D1D, Q1D)(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D);
+}
 
+void PADiffusionApplyElements(const int dim,
+                              const int D1D,
+                              const int Q1D,
+                              const int NE,
+                              const Array<int> &elems,
+                              const bool symm,
+                              const Array<double> &B,
+                              const Array<double> &G,
+                              const Array<double> &Bt,
+                              const Array<double> &Gt,
+                              const Vector &D,
+                              const Vector &X,
+                              Vector &Y)
+{
+   if (elems.Size() == 0) { return; }
    if (dim == 2)
    {
-      switch (id)
-      {
-         case 0x22: return SmemPADiffusionApply2D<2,2,16>(NE,symm,B,G,D,X,Y);
-         case 0x33: return SmemPADiffusionApply2D<3,3,16>(NE,symm,B,G,D,X,Y);
-         case 0x44: return SmemPADiffusionApply2D<4,4,8>(NE,symm,B,G,D,X,Y);
-         case 0x55: return SmemPADiffusionApply2D<5,5,8>(NE,symm,B,G,D,X,Y);
-         case 0x66: return SmemPADiffusionApply2D<6,6,4>(NE,symm,B,G,D,X,Y);
-         case 0x77: return SmemPADiffusionApply2D<7,7,4>(NE,symm,B,G,D,X,Y);
-         case 0x88: return SmemPADiffusionApply2D<8,8,2>(NE,symm,B,G,D,X,Y);
-         case 0x99: return SmemPADiffusionApply2D<9,9,2>(NE,symm,B,G,D,X,Y);
-         default:   return PADiffusionApply2D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D);
-      }
+      return PADiffusionApply2D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D,&elems);
    }
-
    if (dim == 3)
    {
-      switch (id)
-      {
-         case 0x22: return SmemPADiffusionApply3D<2,2>(NE,symm,B,G,D,X,Y);
-         case 0x23: return SmemPADiffusionApply3D<2,3>(NE,symm,B,G,D,X,Y);
-         case 0x34: return SmemPADiffusionApply3D<3,4>(NE,symm,B,G,D,X,Y);
-         case 0x45: return SmemPADiffusionApply3D<4,5>(NE,symm,B,G,D,X,Y);
-         case 0x46: return SmemPADiffusionApply3D<4,6>(NE,symm,B,G,D,X,Y);
-         case 0x56: return SmemPADiffusionApply3D<5,6>(NE,symm,B,G,D,X,Y);
-         case 0x58: return SmemPADiffusionApply3D<5,8>(NE,symm,B,G,D,X,Y);
-         case 0x67: return SmemPADiffusionApply3D<6,7>(NE,symm,B,G,D,X,Y);
-         case 0x78: return SmemPADiffusionApply3D<7,8>(NE,symm,B,G,D,X,Y);
-         case 0x89: return SmemPADiffusionApply3D<8,9>(NE,symm,B,G,D,X,Y);
-         default:   return PADiffusionApply3D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D);
-      }
+      return PADiffusionApply3D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D,&elems);
    }
-   MFEM_ABORT("Unknown kernel: 0x"<<std::hex << id << std::dec);
+   MFEM_ABORT("Unsupported dimension: " << dim);
+}
+
+// Generic PA Diffusion Apply kernels, used for non-specialized sizes
+static void PADiffusionApply2DFallback(const int NE,
+                                       const bool symm,
+                                       const Array<double> &B,
+                                       const Array<double> &G,
+                                       const Array<double> &Bt,
+                                       const Array<double> &Gt,
+                                       const Vector &D,
+                                       const Vector &X,
+                                       Vector &Y,
+                                       const int D1D,
+                                       const int Q1D)
+{
+   PADiffusionApply2D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D);
+}
+
+static void PADiffusionApply3DFallback(const int NE,
+                                       const bool symm,
+                                       const Array<double> &B,
+                                       const Array<double> &G,
+                                       const Array<double> &Bt,
+                                       const Array<double> &Gt,
+                                       const Vector &D,
+                                       const Vector &X,
+                                       Vector &Y,
+                                       const int D1D,
+                                       const int Q1D)
+{
+   PADiffusionApply3D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D);
+}
+
+KernelDispatchTable<PADiffusionApplyKernel> &PADiffusionApplyKernels(
+   const int dim)
+{
+   static KernelDispatchTable<PADiffusionApplyKernel> kernels_2d = []()
+   {
+      KernelDispatchTable<PADiffusionApplyKernel> k(PADiffusionApply2DFallback);
+      k.Add(2,2,PADiffusionApply2DKernel<2,2,16>);
+      k.Add(3,3,PADiffusionApply2DKernel<3,3,16>);
+      k.Add(4,4,PADiffusionApply2DKernel<4,4,8>);
+      k.Add(5,5,PADiffusionApply2DKernel<5,5,8>);
+      k.Add(6,6,PADiffusionApply2DKernel<6,6,4>);
+      k.Add(7,7,PADiffusionApply2DKernel<7,7,4>);
+      k.Add(8,8,PADiffusionApply2DKernel<8,8,2>);
+      k.Add(9,9,PADiffusionApply2DKernel<9,9,2>);
+#ifdef MFEM_PA_KERNELS
+#define MFEM_PA_KERNEL(D1D,Q1D) \
+      if (!k.Has(D1D,Q1D)) { k.Add(D1D,Q1D,PADiffusionApply2DKernel<D1D,Q1D>); }
+      MFEM_PA_KERNELS
+#undef MFEM_PA_KERNEL
+#endif
+      return k;
+   }();
+   static KernelDispatchTable<PADiffusionApplyKernel> kernels_3d = []()
+   {
+      KernelDispatchTable<PADiffusionApplyKernel> k(PADiffusionApply3DFallback);
+      k.Add(2,2,PADiffusionApply3DKernel<2,2>);
+      k.Add(2,3,PADiffusionApply3DKernel<2,3>);
+      k.Add(3,4,PADiffusionApply3DKernel<3,4>);
+      k.Add(4,5,PADiffusionApply3DKernel<4,5>);
+      k.Add(4,6,PADiffusionApply3DKernel<4,6>);
+      k.Add(5,6,PADiffusionApply3DKernel<5,6>);
+      k.Add(5,8,PADiffusionApply3DKernel<5,8>);
+      k.Add(6,7,PADiffusionApply3DKernel<6,7>);
+      k.Add(7,8,PADiffusionApply3DKernel<7,8>);
+      k.Add(8,9,PADiffusionApply3DKernel<8,9>);
+#ifdef MFEM_PA_KERNELS
+#define MFEM_PA_KERNEL(D1D,Q1D) \
+      if (!k.Has(D1D,Q1D)) { k.Add(D1D,Q1D,PADiffusionApply3DKernel<D1D,Q1D>); }
+      MFEM_PA_KERNELS
+#undef MFEM_PA_KERNEL
+#endif
+      return k;
+   }();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension: " << dim);
+   return dim == 2 ? kernels_2d : kernels_3d;
 }
 
 #ifdef MFEM_USE_OCCA
@@ -573,6 +645,228 @@ void OccaPADiffusionApply3D(const int D1D,
 }
 #endif // MFEM_USE_OCCA
 
+// Position of entry (i,j) of the quadrature point matrix in the non-tensor
+// PA data, see PADiffusionSetupDense.
+MFEM_HOST_DEVICE inline int PADiffusionDenseIndex(const int dim,
+                                                  const bool symm,
+                                                  int i, int j)
+{
+   if (!symm) { return i*dim + j; }
+   if (i > j) { const int t = i; i = j; j = t; }
+   return i*dim - (i*(i-1))/2 + (j-i);
+}
+
+template<int DIM>
+static void PADiffusionSetupDense(const int NQ,
+                                  const int coeffDim,
+                                  const int NE,
+                                  const Array<double> &w,
+                                  const Vector &j,
+                                  const Vector &c,
+                                  Vector &d)
+{
+   constexpr int SYMM_DIM = (DIM*(DIM+1))/2;
+   const bool symmetric = (coeffDim != DIM*DIM);
+   const bool matrix_c = (coeffDim == SYMM_DIM && DIM > 1) ||
+                         coeffDim == DIM*DIM;
+   const bool const_c = c.Size() == 1;
+   MFEM_VERIFY(!matrix_c || !const_c,
+               "Constant matrix coefficient not supported");
+   const auto W = Reshape(w.Read(), NQ);
+   const auto J = Reshape(j.Read(), NQ, DIM, DIM, NE);
+   const auto C = const_c ? Reshape(c.Read(), 1, 1, 1) :
+                  Reshape(c.Read(), coeffDim, NQ, NE);
+   auto D = Reshape(d.Write(), NQ, symmetric ? SYMM_DIM : DIM*DIM, NE);
+   mfem::forall(NE*NQ, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ;
+      const int e = idx / NQ;
+      // Column-major (DIM x DIM) matrices
+      double Jq[DIM*DIM], A[DIM*DIM], M[DIM*DIM];
+      for (int jj = 0; jj < DIM; ++jj)
+      {
+         for (int ii = 0; ii < DIM; ++ii) { Jq[ii + DIM*jj] = J(q,ii,jj,e); }
+      }
+      // detJ J^{-1} M J^{-T} = (1/detJ) adj(J) M adj(J)^T
+      kernels::CalcAdjugate<DIM>(Jq, A);
+      const double w_detJ = W(q) / kernels::Det<DIM>(Jq);
+      for (int k = 0; k < DIM; ++k)
+      {
+         for (int l = 0; l < DIM; ++l)
+         {
+            double M_kl;
+            if (matrix_c)
+            {
+               M_kl = C(PADiffusionDenseIndex(DIM, symmetric, k, l), q, e);
+            }
+            else if (k != l) { M_kl = 0.0; }
+            else if (const_c) { M_kl = C(0,0,0); }
+            else { M_kl = C(coeffDim == DIM ? k : 0, q, e); }
+            M[k + DIM*l] = M_kl;
+         }
+      }
+      for (int ii = 0; ii < DIM; ++ii)
+      {
+         for (int jj = (symmetric ? ii : 0); jj < DIM; ++jj)
+         {
+            double s = 0.0;
+            for (int k = 0; k < DIM; ++k)
+            {
+               for (int l = 0; l < DIM; ++l)
+               {
+                  s += A[ii + DIM*k] * M[k + DIM*l] * A[jj + DIM*l];
+               }
+            }
+            D(q, PADiffusionDenseIndex(DIM, symmetric, ii, jj), e) = w_detJ*s;
+         }
+      }
+   });
+}
+
+void PADiffusionSetupDense(const int dim,
+                           const int NQ,
+                           const int coeffDim,
+                           const int NE,
+                           const Array<double> &W,
+                           const Vector &J,
+                           const Vector &C,
+                           Vector &D)
+{
+   if (dim == 2) { return PADiffusionSetupDense<2>(NQ,coeffDim,NE,W,J,C,D); }
+   if (dim == 3) { return PADiffusionSetupDense<3>(NQ,coeffDim,NE,W,J,C,D); }
+   MFEM_ABORT("Unsupported dimension: " << dim);
+}
+
+template<int DIM>
+static void PADiffusionApplyDense(const int ND,
+                                  const int NQ,
+                                  const int NE,
+                                  const bool symmetric,
+                                  const Array<double> &g,
+                                  const Array<double> &gt,
+                                  const Vector &d,
+                                  const Vector &x,
+                                  Vector &y,
+                                  const Array<int> *elems)
+{
+   constexpr int SYMM_DIM = (DIM*(DIM+1))/2;
+   const auto G = Reshape(g.Read(), NQ, DIM, ND);
+   const auto Gt = Reshape(gt.Read(), ND, NQ, DIM);
+   const auto D = Reshape(d.Read(), NQ, symmetric ? SYMM_DIM : DIM*DIM, NE);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   const int n = elems ? elems->Size() : NE;
+   const auto E = elems ? elems->Read() : nullptr;
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int e = E ? E[i] : i;
+      // One quadrature point at a time: reference gradient, multiplication
+      // by the quadrature point matrix, and the transposed gradient.
+      for (int q = 0; q < NQ; ++q)
+      {
+         double grad[DIM], v[DIM];
+         for (int c = 0; c < DIM; ++c) { grad[c] = 0.0; }
+         for (int dof = 0; dof < ND; ++dof)
+         {
+            const double s = X(dof,e);
+            for (int c = 0; c < DIM; ++c) { grad[c] += G(q,c,dof) * s; }
+         }
+         for (int i = 0; i < DIM; ++i)
+         {
+            v[i] = 0.0;
+            for (int j = 0; j < DIM; ++j)
+            {
+               v[i] += D(q, PADiffusionDenseIndex(DIM, symmetric, i, j), e) *
+                       grad[j];
+            }
+         }
+         for (int dof = 0; dof < ND; ++dof)
+         {
+            double s = 0.0;
+            for (int c = 0; c < DIM; ++c) { s += Gt(dof,q,c) * v[c]; }
+            Y(dof,e) += s;
+         }
+      }
+   });
+}
+
+void PADiffusionApplyDense(const int dim,
+                           const int ND,
+                           const int NQ,
+                           const int NE,
+                           const bool symm,
+                           const Array<double> &G,
+                           const Array<double> &Gt,
+                           const Vector &D,
+                           const Vector &X,
+                           Vector &Y,
+                           const Array<int> *elems)
+{
+   if (dim == 2)
+   {
+      return PADiffusionApplyDense<2>(ND,NQ,NE,symm,G,Gt,D,X,Y,elems);
+   }
+   if (dim == 3)
+   {
+      return PADiffusionApplyDense<3>(ND,NQ,NE,symm,G,Gt,D,X,Y,elems);
+   }
+   MFEM_ABORT("Unsupported dimension: " << dim);
+}
+
+template<int DIM>
+static void PADiffusionAssembleDiagonalDense(const int ND,
+                                             const int NQ,
+                                             const int NE,
+                                             const bool symmetric,
+                                             const Array<double> &g,
+                                             const Vector &d,
+                                             Vector &y)
+{
+   constexpr int SYMM_DIM = (DIM*(DIM+1))/2;
+   const auto G = Reshape(g.Read(), NQ, DIM, ND);
+   const auto D = Reshape(d.Read(), NQ, symmetric ? SYMM_DIM : DIM*DIM, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int dof = 0; dof < ND; ++dof)
+      {
+         double s = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            for (int i = 0; i < DIM; ++i)
+            {
+               for (int j = 0; j < DIM; ++j)
+               {
+                  s += G(q,i,dof) * G(q,j,dof) *
+                       D(q, PADiffusionDenseIndex(DIM, symmetric, i, j), e);
+               }
+            }
+         }
+         Y(dof,e) += s;
+      }
+   });
+}
+
+void PADiffusionAssembleDiagonalDense(const int dim,
+                                      const int ND,
+                                      const int NQ,
+                                      const int NE,
+                                      const bool symm,
+                                      const Array<double> &G,
+                                      const Vector &D,
+                                      Vector &Y)
+{
+   if (dim == 2)
+   {
+      return PADiffusionAssembleDiagonalDense<2>(ND,NQ,NE,symm,G,D,Y);
+   }
+   if (dim == 3)
+   {
+      return PADiffusionAssembleDiagonalDense<3>(ND,NQ,NE,symm,G,D,Y);
+   }
+   MFEM_ABORT("Unsupported dimension: " << dim);
+}
+
 } // namespace internal
 
 } // namespace mfem
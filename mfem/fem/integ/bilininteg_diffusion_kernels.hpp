@@ -15,6 +15,7 @@
 #include "../../config/config.hpp"
 #include "../../general/array.hpp"
 #include "../../general/forall.hpp"
+#include "../../general/kernel_dispatch.hpp"
 #include "../../linalg/dtensor.hpp"
 #include "../../linalg/vector.hpp"
 #include "../bilininteg.hpp"
@@ -479,6 +480,63 @@ void PADiffusionApply(const int dim,
                       const Vector &X,
                       Vector &Y);
 
+// PA Diffusion Apply kernel restricted to the elements listed in elems, using
+// the generic tensor kernels, see PAMassApplyElements.
+void PADiffusionApplyElements(const int dim,
+                              const int D1D,
+                              const int Q1D,
+                              const int NE,
+                              const Array<int> &elems,
+                              const bool symm,
+                              const Array<double> &B,
+                              const Array<double> &G,
+                              const Array<double> &Bt,
+                              const Array<double> &Gt,
+                              const Vector &D,
+                              const Vector &X,
+                              Vector &Y);
+
+// Dense PA Diffusion kernels, for non-tensor elements (e.g. simplices and
+// wedges), see PADiffusionApplyDense.
+
+// Dense PA Diffusion Assemble kernel. The quadrature data D has layout (NQ, symm ? dim*(dim+1)/2 :
+// dim*dim, NE) with the entries of the (dim x dim) matrix at each point stored
+// row-wise (upper triangle only in the symmetric case).
+void PADiffusionSetupDense(const int dim,
+                           const int NQ,
+                           const int coeffDim,
+                           const int NE,
+                           const Array<double> &W,
+                           const Vector &J,
+                           const Vector &C,
+                           Vector &D);
+
+// Dense PA Diffusion Apply kernel, using the DofToQuad::FULL basis gradients. There is no sum factorization: the cost is
+// O(ND*NQ*dim) per element, since the nodal simplex bases are not of
+// collapsed-coordinate (Duffy) tensor-product form. If elems is given, only
+// the listed elements are applied.
+void PADiffusionApplyDense(const int dim,
+                           const int ND,
+                           const int NQ,
+                           const int NE,
+                           const bool symm,
+                           const Array<double> &G,
+                           const Array<double> &Gt,
+                           const Vector &D,
+                           const Vector &X,
+                           Vector &Y,
+                           const Array<int> *elems = nullptr);
+
+// Dense PA Diffusion Diagonal kernel.
+void PADiffusionAssembleDiagonalDense(const int dim,
+                                      const int ND,
+                                      const int NQ,
+                                      const int NE,
+                                      const bool symm,
+                                      const Array<double> &G,
+                                      const Vector &D,
+                                      Vector &Y);
+
 #ifdef MFEM_USE_OCCA
 // OCCA PA Diffusion Apply 2D kernel
 void OccaPADiffusionApply2D(const int D1D,
@@ -517,7 +575,8 @@ inline void PADiffusionApply2D(const int NE,
                                const Vector &x_,
                                Vector &y_,
                                const int d1d = 0,
-                               const int q1d = 0)
+                               const int q1d = 0,
+                               const Array<int> *elems = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -530,8 +589,11 @@ inline void PADiffusionApply2D(const int NE,
    auto D = Reshape(d_.Read(), Q1D*Q1D, symmetric ? 3 : 4, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
-   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   const int n = elems ? elems->Size() : NE;
+   const auto E = elems ? elems->Read() : nullptr;
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
    {
+      const int e = E ? E[i] : i;
       const int D1D = T_D1D ? T_D1D : d1d;
       const int Q1D = T_Q1D ? T_Q1D : q1d;
       // the following variables are evaluated at compile time
@@ -796,7 +858,8 @@ inline void PADiffusionApply3D(const int NE,
                                const Vector &d_,
                                const Vector &x_,
                                Vector &y_,
-                               int d1d = 0, int q1d = 0)
+                               int d1d = 0, int q1d = 0,
+                               const Array<int> *elems = nullptr)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
@@ -809,8 +872,11 @@ inline void PADiffusionApply3D(const int NE,
    auto D = Reshape(d_.Read(), Q1D*Q1D*Q1D, symmetric ? 6 : 9, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
-   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   const int n = elems ? elems->Size() : NE;
+   const auto E = elems ? elems->Read() : nullptr;
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
    {
+      const int e = E ? E[i] : i;
       const int D1D = T_D1D ? T_D1D : d1d;
       const int Q1D = T_Q1D ? T_Q1D : q1d;
       constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
@@ -1201,6 +1267,71 @@ inline void SmemPADiffusionApply3D(const int NE,
    });
 }
 
+/// Signature of the tensor-product PA diffusion apply kernels.
+using PADiffusionApplyKernel = void (*)(const int NE,
+                                        const bool symm,
+                                        const Array<double> &B,
+                                        const Array<double> &G,
+                                        const Array<double> &Bt,
+                                        const Array<double> &Gt,
+                                        const Vector &D,
+                                        const Vector &X,
+                                        Vector &Y,
+                                        const int d1d,
+                                        const int q1d);
+
+// Specialized PA Diffusion Apply 2D kernel, with the PADiffusionApplyKernel
+// signature.
+template<int T_D1D, int T_Q1D, int T_NBZ = KernelNBZ2D(T_Q1D)>
+void PADiffusionApply2DKernel(const int NE,
+                              const bool symm,
+                              const Array<double> &B,
+                              const Array<double> &G,
+                              const Array<double> &,
+                              const Array<double> &,
+                              const Vector &D,
+                              const Vector &X,
+                              Vector &Y,
+                              const int,
+                              const int)
+{
+   SmemPADiffusionApply2D<T_D1D,T_Q1D,T_NBZ>(NE,symm,B,G,D,X,Y);
+}
+
+// Specialized PA Diffusion Apply 3D kernel, with the PADiffusionApplyKernel
+// signature.
+template<int T_D1D, int T_Q1D>
+void PADiffusionApply3DKernel(const int NE,
+                              const bool symm,
+                              const Array<double> &B,
+                              const Array<double> &G,
+                              const Array<double> &,
+                              const Array<double> &,
+                              const Vector &D,
+                              const Vector &X,
+                              Vector &Y,
+                              const int,
+                              const int)
+{
+   SmemPADiffusionApply3D<T_D1D,T_Q1D>(NE,symm,B,G,D,X,Y);
+}
+
+/// Dispatch table of the PA diffusion apply kernels in dimension @a dim (2 or
+/// 3), used by PADiffusionApply.
+KernelDispatchTable<PADiffusionApplyKernel> &PADiffusionApplyKernels(
+   const int dim);
+
+/// Register the (D1D,Q1D) specialization of the DIM-dimensional PA diffusion
+/// apply kernel, e.g. for high orders or over-integration.
+template<int DIM, int T_D1D, int T_Q1D>
+void AddPADiffusionApplySpecialization()
+{
+   static_assert(DIM == 2 || DIM == 3, "Unsupported dimension");
+   PADiffusionApplyKernels(DIM).Add(
+      T_D1D, T_Q1D, DIM == 2 ? &PADiffusionApply2DKernel<T_D1D,T_Q1D> :
+      &PADiffusionApply3DKernel<T_D1D,T_Q1D>);
+}
+
 } // namespace internal
 
 } // namespace mfem
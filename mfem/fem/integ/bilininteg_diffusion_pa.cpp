@@ -54,7 +54,8 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    ne = fes.GetNE();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS, mt);
    const int sdim = mesh->SpaceDimension();
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   const bool tensor = UsesTensorBasis(fes);
+   maps = &el.GetDofToQuad(*ir, tensor ? DofToQuad::TENSOR : DofToQuad::FULL);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
 
@@ -71,10 +72,96 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    const int pa_size = symmetric ? symmDims : dims*dims;
 
    pa_data.SetSize(pa_size * nq * ne, mt);
+   if (!tensor)
+   {
+      MFEM_VERIFY(dims == sdim, "Non-tensor PA diffusion requires the element"
+                  " dimension to match the space dimension.");
+      internal::PADiffusionSetupDense(dim, nq, coeff_dim, ne,
+                                      ir->GetWeights(), geom->J, coeff,
+                                      pa_data);
+      return;
+   }
    internal::PADiffusionSetup(dim, sdim, dofs1D, quad1D, coeff_dim, ne,
                               ir->GetWeights(), geom->J, coeff, pa_data);
 }
 
+void DiffusionIntegrator::AssemblePAUpdate(const FiniteElementSpace &fes,
+                                           const Array<int> &old_elem)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int old_ne = ne;
+   if (DeviceCanUseCeed() || VQ || MQ || mesh->GetNE() == 0 || old_ne == 0 ||
+       pa_data.Size() % old_ne != 0 ||
+       mesh->GetNumGeometries(mesh->Dimension()) > 1 || fes.IsVariableOrder())
+   {
+      AssemblePA(fes);
+      return;
+   }
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el);
+   const int dims = el.GetDim();
+   const int symmDims = (dims * (dims + 1)) / 2;
+   const int nq = ir->GetNPoints();
+   const int stride = symmDims * nq;
+   if (pa_data.Size() != stride * old_ne)
+   {
+      AssemblePA(fes);
+      return;
+   }
+   MFEM_VERIFY(old_elem.Size() == mesh->GetNE(), "invalid element map");
+
+   fespace = &fes;
+   ne = mesh->GetNE();
+   geom = nullptr;
+   const int sdim = mesh->SpaceDimension();
+   const bool tensor = UsesTensorBasis(fes);
+
+   Array<int> changed;
+   for (int e = 0; e < ne; e++)
+   {
+      if (old_elem[e] < 0) { changed.Append(e); }
+   }
+   const int nc = changed.Size();
+
+   // Evaluate the Jacobians and the coefficient of the new elements on the
+   // host, with the layout of GeometricFactors::J, and reuse the setup kernels
+   // of AssemblePA() on them.
+   Vector J(nq*sdim*dims*nc), C(nq*nc);
+   auto d_J = Reshape(J.HostWrite(), nq, sdim, dims, nc);
+   auto d_C = Reshape(C.HostWrite(), nq, nc);
+   for (int k = 0; k < nc; k++)
+   {
+      ElementTransformation &T = *mesh->GetElementTransformation(changed[k]);
+      for (int q = 0; q < nq; q++)
+      {
+         const IntegrationPoint &ip = ir->IntPoint(q);
+         T.SetIntPoint(&ip);
+         const DenseMatrix &Jq = T.Jacobian();
+         for (int c = 0; c < dims; c++)
+         {
+            for (int r = 0; r < sdim; r++) { d_J(q,r,c,k) = Jq(r,c); }
+         }
+         d_C(q,k) = Q ? Q->Eval(T, ip) : 1.0;
+      }
+   }
+
+   Vector changed_data(stride*nc);
+   if (nc > 0)
+   {
+      if (!tensor)
+      {
+         internal::PADiffusionSetupDense(dim, nq, 1, nc, ir->GetWeights(),
+                                         J, C, changed_data);
+      }
+      else
+      {
+         internal::PADiffusionSetup(dim, sdim, dofs1D, quad1D, 1, nc,
+                                    ir->GetWeights(), J, C, changed_data);
+      }
+   }
+   RemapPAData(old_elem, changed, changed_data, stride, pa_data);
+}
+
 void DiffusionIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
 {
    fespace = &fes;
@@ -107,6 +194,13 @@ void DiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
    else
    {
       if (pa_data.Size()==0) { AssemblePA(*fespace); }
+      if (maps->mode == DofToQuad::FULL)
+      {
+         internal::PADiffusionAssembleDiagonalDense(dim, dofs1D, quad1D, ne,
+                                                    symmetric, maps->G,
+                                                    pa_data, diag);
+         return;
+      }
       internal::PADiffusionAssembleDiagonal(dim, dofs1D, quad1D, ne, symmetric,
                                             maps->B, maps->G, pa_data, diag);
    }
@@ -118,6 +212,11 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    {
       ceedOp->AddMult(x, y);
    }
+   else if (maps->mode == DofToQuad::FULL)
+   {
+      internal::PADiffusionApplyDense(dim, dofs1D, quad1D, ne, symmetric,
+                                      maps->G, maps->Gt, pa_data, x, y);
+   }
    else
    {
       internal::PADiffusionApply(dim, dofs1D, quad1D, ne, symmetric,
@@ -139,6 +238,32 @@ void DiffusionIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
    }
 }
 
+void DiffusionIntegrator::AddMultPAElements(const Array<int> &elems,
+                                            const Vector &x, Vector &y) const
+{
+   if (maps->mode == DofToQuad::FULL)
+   {
+      internal::PADiffusionApplyDense(dim, dofs1D, quad1D, ne, symmetric,
+                                      maps->G, maps->Gt, pa_data, x, y,
+                                      &elems);
+   }
+   else
+   {
+      internal::PADiffusionApplyElements(dim, dofs1D, quad1D, ne, elems,
+                                         symmetric, maps->B, maps->G, maps->Bt,
+                                         maps->Gt, pa_data, x, y);
+   }
+}
+
+void DiffusionIntegrator::AddMultTransposePAElements(const Array<int> &elems,
+                                                     const Vector &x,
+                                                     Vector &y) const
+{
+   MFEM_VERIFY(symmetric, "DiffusionIntegrator::AddMultTransposePAElements "
+               "only implemented in the symmetric case.");
+   AddMultPAElements(elems, x, y);
+}
+
 // This version uses full 1D quadrature rules, taking into account the
 // minimum interaction between basis functions and integration points.
 void DiffusionIntegrator::AddMultPatchPA(const int patch, const Vector &x,
@@ -144,101 +144,6 @@ void SetupPatch3D(const int Q1Dx,
    });
 }
 
-// Compute a reduced integration rule, using NNLSSolver, for DiffusionIntegrator
-// on a NURBS patch with partial assembly.
-void GetReducedRule(const int nq, const int nd,
-                    Array2D<double> const& B,
-                    Array2D<double> const& G,
-                    std::vector<int> minQ,
-                    std::vector<int> maxQ,
-                    std::vector<int> minD,
-                    std::vector<int> maxD,
-                    std::vector<int> minDD,
-                    std::vector<int> maxDD,
-                    const IntegrationRule *ir,
-                    const bool zeroOrder,
-                    std::vector<Vector> & reducedWeights,
-                    std::vector<std::vector<int>> & reducedIDs)
-{
-   MFEM_VERIFY(B.NumRows() == nq, "");
-   MFEM_VERIFY(B.NumCols() == nd, "");
-   MFEM_VERIFY(G.NumRows() == nq, "");
-   MFEM_VERIFY(G.NumCols() == nd, "");
-   MFEM_VERIFY(ir->GetNPoints() == nq, "");
-
-   for (int dof=0; dof<nd; ++dof)
-   {
-      // Integrate diffusion for B(:,dof) against all other B(:,i)
-
-      const int nc_dof = maxDD[dof] - minDD[dof] + 1;
-      const int nw_dof = maxD[dof] - minD[dof] + 1;
-
-      // G is of size nc_dof x nw_dof
-      MFEM_VERIFY(nc_dof <= nw_dof, "The NNLS system for the reduced "
-                  "integration rule requires more full integration points. Try"
-                  " increasing the order of the full integration rule.");
-      DenseMatrix Gmat(nc_dof, nw_dof);
-      Gmat = 0.0;
-
-      Vector w(nw_dof);
-      w = 0.0;
-
-      for (int qx = minD[dof]; qx <= maxD[dof]; ++qx)
-      {
-         const double Bq = zeroOrder ? B(qx,dof) : G(qx,dof);
-
-         const IntegrationPoint &ip = ir->IntPoint(qx);
-         const double w_qx = ip.weight;
-         w[qx - minD[dof]] = w_qx;
-
-         for (int dx = minQ[qx]; dx <= maxQ[qx]; ++dx)
-         {
-            const double Bd = zeroOrder ? B(qx,dx) : G(qx,dx);
-
-            Gmat(dx - minDD[dof], qx - minD[dof]) = Bq * Bd;
-         }
-      }
-
-      Vector sol(Gmat.NumCols());
-
-#ifdef MFEM_USE_LAPACK
-      NNLSSolver nnls;
-      nnls.SetOperator(Gmat);
-
-      nnls.Mult(w, sol);
-#else
-      MFEM_ABORT("NNLSSolver requires building with LAPACK");
-#endif
-
-      int nnz = 0;
-      for (int i=0; i<sol.Size(); ++i)
-      {
-         if (sol(i) != 0.0)
-         {
-            nnz++;
-         }
-      }
-
-      MFEM_VERIFY(nnz > 0, "");
-
-      Vector wred(nnz);
-      std::vector<int> idnnz(nnz);
-      nnz = 0;
-      for (int i=0; i<sol.Size(); ++i)
-      {
-         if (sol(i) != 0.0)
-         {
-            wred[nnz] = sol[i];
-            idnnz[nnz] = i;
-            nnz++;
-         }
-      }
-
-      reducedWeights.push_back(wred);
-      reducedIDs.push_back(idnnz);
-   }
-}
-
 // Adapted from AssemblePA
 void DiffusionIntegrator::SetupPatchPA(const int patch, Mesh *mesh,
                                        bool unitWeights)
@@ -754,119 +659,26 @@ void DiffusionIntegrator::SetupPatchBasisData(Mesh *mesh, unsigned int patch)
    MFEM_VERIFY(pminDD.size() == patch && pmaxDD.size() == patch, "");
    MFEM_VERIFY(pir1d.size() == patch, "");
 
-   // Set basis functions and gradients for this patch
-   Array<const KnotVector*> pkv;
-   mesh->NURBSext->GetPatchKnotVectors(patch, pkv);
-   MFEM_VERIFY(pkv.Size() == dim, "");
-
-   Array<int> Q1D(dim);
-   Array<int> orders(dim);
-   Array<int> D1D(dim);
-   std::vector<Array2D<double>> B(dim);
-   std::vector<Array2D<double>> G(dim);
-   Array<const IntegrationRule*> ir1d(dim);
-
-   IntArrayVar2D minD(dim);
-   IntArrayVar2D maxD(dim);
-   IntArrayVar2D minQ(dim);
-   IntArrayVar2D maxQ(dim);
-
-   IntArrayVar2D minDD(dim);
-   IntArrayVar2D maxDD(dim);
-
-   for (int d=0; d<dim; ++d)
-   {
-      ir1d[d] = patchRules->GetPatchRule1D(patch, d);
-
-      Q1D[d] = ir1d[d]->GetNPoints();
-
-      orders[d] = pkv[d]->GetOrder();
-      D1D[d] = pkv[d]->GetNCP();
-
-      Vector shapeKV(orders[d]+1);
-      Vector dshapeKV(orders[d]+1);
-
-      B[d].SetSize(Q1D[d], D1D[d]);
-      G[d].SetSize(Q1D[d], D1D[d]);
-
-      minD[d].assign(D1D[d], Q1D[d]);
-      maxD[d].assign(D1D[d], 0);
-
-      minQ[d].assign(Q1D[d], D1D[d]);
-      maxQ[d].assign(Q1D[d], 0);
-
-      B[d] = 0.0;
-      G[d] = 0.0;
-
-      const Array<int>& knotSpan1D = patchRules->GetPatchRule1D_KnotSpan(patch, d);
-      MFEM_VERIFY(knotSpan1D.Size() == Q1D[d], "");
-
-      for (int i = 0; i < Q1D[d]; i++)
-      {
-         const IntegrationPoint &ip = ir1d[d]->IntPoint(i);
-         const int ijk = knotSpan1D[i];
-         const double kv0 = (*pkv[d])[orders[d] + ijk];
-         double kv1 = (*pkv[d])[0];
-         for (int j = orders[d] + ijk + 1; j < pkv[d]->Size(); ++j)
-         {
-            if ((*pkv[d])[j] > kv0)
-            {
-               kv1 = (*pkv[d])[j];
-               break;
-            }
-         }
-
-         MFEM_VERIFY(kv1 > kv0, "");
-
-         pkv[d]->CalcShape(shapeKV, ijk, (ip.x - kv0) / (kv1 - kv0));
-         pkv[d]->CalcDShape(dshapeKV, ijk, (ip.x - kv0) / (kv1 - kv0));
-
-         // Put shapeKV into array B storing shapes for all points.
-         // TODO: This should be based on NURBS3DFiniteElement::CalcShape and CalcDShape.
-         // For now, it works under the assumption that all NURBS weights are 1.
-         for (int j=0; j<orders[d]+1; ++j)
-         {
-            B[d](i,ijk + j) = shapeKV[j];
-            G[d](i,ijk + j) = dshapeKV[j];
-
-            minD[d][ijk + j] = std::min(minD[d][ijk + j], i);
-            maxD[d][ijk + j] = std::max(maxD[d][ijk + j], i);
-         }
-
-         minQ[d][i] = std::min(minQ[d][i], ijk);
-         maxQ[d][i] = std::max(maxQ[d][i], ijk + orders[d]);
-      }
-
-      // Determine which DOFs each DOF interacts with, in 1D.
-      minDD[d].resize(D1D[d]);
-      maxDD[d].resize(D1D[d]);
-      for (int i=0; i<D1D[d]; ++i)
-      {
-         const int qmin = minD[d][i];
-         minDD[d][i] = minQ[d][qmin];
-
-         const int qmax = maxD[d][i];
-         maxDD[d][i] = maxQ[d][qmax];
-      }
-   }
+   PatchBasisInfo pb(mesh, patch, patchRules);
+   MFEM_VERIFY(pb.dim == dim, "");
 
    // Push patch data to global data structures
-   pB.push_back(B);
-   pG.push_back(G);
+   pB.push_back(pb.B);
+   pG.push_back(pb.G);
 
-   pQ1D.push_back(Q1D);
-   pD1D.push_back(D1D);
+   pQ1D.push_back(pb.Q1D);
+   pD1D.push_back(pb.D1D);
 
-   pminQ.push_back(minQ);
-   pmaxQ.push_back(maxQ);
+   pminQ.push_back(pb.minQ);
+   pmaxQ.push_back(pb.maxQ);
 
-   pminD.push_back(minD);
-   pmaxD.push_back(maxD);
+   pminD.push_back(pb.minD);
+   pmaxD.push_back(pb.maxD);
 
-   pminDD.push_back(minDD);
-   pmaxDD.push_back(maxDD);
+   pminDD.push_back(pb.minDD);
+   pmaxDD.push_back(pb.maxDD);
 
-   pir1d.push_back(ir1d);
+   pir1d.push_back(pb.ir1d);
 }
 
 // This version uses reduced 1D quadrature rules.
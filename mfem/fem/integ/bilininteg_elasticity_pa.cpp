@@ -0,0 +1,333 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../../linalg/kernels.hpp"
+#include "../bilininteg.hpp"
+#include "../gridfunc.hpp"
+#include "../qfunction.hpp"
+#include "../ceed/integrators/elasticity/elasticity.hpp"
+
+#include <memory>
+
+namespace mfem
+{
+
+// Return true if the PA kernels below support the elements of @a fes: a single
+// element type and order, with scalar H1-type basis functions and dim = sdim =
+// vdim.
+static bool ElasticityPASupported(const FiniteElementSpace &fes)
+{
+   const Mesh *mesh = fes.GetMesh();
+   const int dim = mesh->Dimension();
+   if (mesh->GetNE() == 0) { return false; }
+   const FiniteElement &el = *fes.GetFE(0);
+   return (dim == 2 || dim == 3) && mesh->SpaceDimension() == dim &&
+          fes.GetVDim() == dim && !fes.GetNURBSext() &&
+          !fes.IsVariableOrder() && mesh->GetNumGeometries(dim) == 1 &&
+          el.GetRangeType() == FiniteElement::SCALAR &&
+          el.GetMapType() == FiniteElement::VALUE;
+}
+
+// Reference gradients of the basis at the points of @a ir, (NQ, dim, ND), with
+// the dofs ordered as in the E-vectors (lexicographic for tensor-product
+// elements), and quadrature data (NQ, 2 + dim*dim, NE): the weights
+// W*detJ*lambda and W*detJ*mu followed by the inverse Jacobian.
+template <int DIM>
+static void ElasticityPASetup(const FiniteElementSpace &fes,
+                              const IntegrationRule &ir,
+                              Coefficient *lambda, Coefficient &mu,
+                              const double lf, const double mf,
+                              Vector &G, Vector &D)
+{
+   Mesh &mesh = *fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   const int NE = mesh.GetNE();
+   const int NQ = ir.GetNPoints();
+   const int ND = el.GetDof();
+
+   const DofToQuad &maps = el.GetDofToQuad(ir, DofToQuad::FULL);
+   const TensorBasisElement *tbe = UsesTensorBasis(fes) ?
+                                   dynamic_cast<const TensorBasisElement*>(&el) : nullptr;
+   const int *dof_map = (tbe && tbe->GetDofMap().Size() > 0) ?
+                        tbe->GetDofMap().GetData() : nullptr;
+   G.SetSize(NQ*DIM*ND);
+   const auto g = Reshape(maps.G.HostRead(), NQ, DIM, ND);
+   auto gl = Reshape(G.HostWrite(), NQ, DIM, ND);
+   for (int i = 0; i < ND; i++)
+   {
+      const int s = dof_map ? dof_map[i] : i;
+      for (int d = 0; d < DIM; d++)
+      {
+         for (int q = 0; q < NQ; q++) { gl(q, d, i) = g(q, d, s); }
+      }
+   }
+
+   const GeometricFactors *geom =
+      mesh.GetGeometricFactors(ir, GeometricFactors::JACOBIANS);
+   QuadratureSpace qs(mesh, ir);
+   CoefficientVector mu_coeff(mu, qs, CoefficientStorage::COMPRESSED);
+   CoefficientVector lambda_coeff(lambda ? *lambda : mu, qs,
+                                  CoefficientStorage::COMPRESSED);
+   const bool const_l = lambda_coeff.Size() == 1;
+   const bool const_m = mu_coeff.Size() == 1;
+   const auto W = Reshape(ir.GetWeights().Read(), NQ);
+   const auto J = Reshape(geom->J.Read(), NQ, DIM, DIM, NE);
+   const auto L = const_l ? Reshape(lambda_coeff.Read(), 1, 1) :
+                  Reshape(lambda_coeff.Read(), NQ, NE);
+   const auto M = const_m ? Reshape(mu_coeff.Read(), 1, 1) :
+                  Reshape(mu_coeff.Read(), NQ, NE);
+   D.SetSize(NQ*(2 + DIM*DIM)*NE);
+   auto d = Reshape(D.Write(), NQ, 2 + DIM*DIM, NE);
+   mfem::forall(NE*NQ, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ;
+      const int e = idx / NQ;
+      double Jq[DIM*DIM], Ji[DIM*DIM];
+      for (int b = 0; b < DIM; b++)
+      {
+         for (int a = 0; a < DIM; a++) { Jq[a + DIM*b] = J(q, a, b, e); }
+      }
+      kernels::CalcInverse<DIM>(Jq, Ji);
+      const double wdetJ = W(q) * kernels::Det<DIM>(Jq);
+      d(q, 0, e) = wdetJ * lf * (const_l ? L(0, 0) : L(q, e));
+      d(q, 1, e) = wdetJ * mf * (const_m ? M(0, 0) : M(q, e));
+      for (int m = 0; m < DIM*DIM; m++) { d(q, 2 + m, e) = Ji[m]; }
+   });
+}
+
+// y += A x, one element per thread. With the physical gradient of the
+// displacement gu = gr J^{-1}, where gr is its reference gradient, the stress
+// s = lambda div(u) I + mu (gu + gu^T) is integrated against the physical
+// gradients of the test functions.
+template <int DIM>
+static void ElasticityPAApply(const int NE, const int NQ, const int ND,
+                              const Vector &G_, const Vector &D_,
+                              const Vector &x_, Vector &y_)
+{
+   const auto G = Reshape(G_.Read(), NQ, DIM, ND);
+   const auto D = Reshape(D_.Read(), NQ, 2 + DIM*DIM, NE);
+   const auto X = Reshape(x_.Read(), ND, DIM, NE);
+   auto Y = Reshape(y_.ReadWrite(), ND, DIM, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int q = 0; q < NQ; q++)
+      {
+         // gr(c,a) = du_c/dxi_a
+         double gr[DIM*DIM];
+         for (int m = 0; m < DIM*DIM; m++) { gr[m] = 0.0; }
+         for (int i = 0; i < ND; i++)
+         {
+            for (int a = 0; a < DIM; a++)
+            {
+               const double g = G(q, a, i);
+               for (int c = 0; c < DIM; c++) { gr[c + DIM*a] += X(i, c, e)*g; }
+            }
+         }
+         // gu(c,k) = du_c/dx_k, with Ji(a,k) = D(q, 2 + a + DIM*k, e)
+         double gu[DIM*DIM];
+         for (int k = 0; k < DIM; k++)
+         {
+            for (int c = 0; c < DIM; c++)
+            {
+               double s = 0.0;
+               for (int a = 0; a < DIM; a++)
+               {
+                  s += gr[c + DIM*a] * D(q, 2 + a + DIM*k, e);
+               }
+               gu[c + DIM*k] = s;
+            }
+         }
+         const double lw = D(q, 0, e), mw = D(q, 1, e);
+         double div = 0.0;
+         for (int c = 0; c < DIM; c++) { div += gu[c + DIM*c]; }
+         // Weighted stress, pulled back to the reference element:
+         // sr(c,a) = sum_k s(c,k) Ji(a,k)
+         double sr[DIM*DIM];
+         for (int a = 0; a < DIM; a++)
+         {
+            for (int c = 0; c < DIM; c++)
+            {
+               double s = 0.0;
+               for (int k = 0; k < DIM; k++)
+               {
+                  const double skc = mw*(gu[c + DIM*k] + gu[k + DIM*c]) +
+                                     (c == k ? lw*div : 0.0);
+                  s += skc * D(q, 2 + a + DIM*k, e);
+               }
+               sr[c + DIM*a] = s;
+            }
+         }
+         for (int i = 0; i < ND; i++)
+         {
+            for (int c = 0; c < DIM; c++)
+            {
+               double s = 0.0;
+               for (int a = 0; a < DIM; a++) { s += G(q, a, i)*sr[c + DIM*a]; }
+               Y(i, c, e) += s;
+            }
+         }
+      }
+   });
+}
+
+// diag += diagonal of A, one (dof, element) pair per thread. With the physical
+// gradient g of the basis function, the diagonal entry of the component c is
+// the integral of lambda g_c^2 + mu (|g|^2 + g_c^2).
+template <int DIM>
+static void ElasticityPADiagonal(const int NE, const int NQ, const int ND,
+                                 const Vector &G_, const Vector &D_,
+                                 Vector &diag, const bool add)
+{
+   const auto G = Reshape(G_.Read(), NQ, DIM, ND);
+   const auto D = Reshape(D_.Read(), NQ, 2 + DIM*DIM, NE);
+   auto Y = Reshape(add ? diag.ReadWrite() : diag.Write(), ND, DIM, NE);
+   mfem::forall(NE*ND, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int i = idx % ND;
+      const int e = idx / ND;
+      double y[DIM];
+      for (int c = 0; c < DIM; c++) { y[c] = 0.0; }
+      for (int q = 0; q < NQ; q++)
+      {
+         double g[DIM], g2 = 0.0;
+         for (int k = 0; k < DIM; k++)
+         {
+            double s = 0.0;
+            for (int a = 0; a < DIM; a++)
+            {
+               s += G(q, a, i) * D(q, 2 + a + DIM*k, e);
+            }
+            g[k] = s;
+            g2 += s*s;
+         }
+         const double lw = D(q, 0, e), mw = D(q, 1, e);
+         for (int c = 0; c < DIM; c++)
+         {
+            y[c] += (lw + mw)*g[c]*g[c] + mw*g2;
+         }
+      }
+      for (int c = 0; c < DIM; c++)
+      {
+         Y(i, c, e) = add ? Y(i, c, e) + y[c] : y[c];
+      }
+   });
+}
+
+static void ElasticityPASetup(const int dim, const FiniteElementSpace &fes,
+                              const IntegrationRule &ir,
+                              Coefficient *lambda, Coefficient &mu,
+                              const double lf, const double mf,
+                              Vector &G, Vector &D)
+{
+   if (dim == 2) { ElasticityPASetup<2>(fes, ir, lambda, mu, lf, mf, G, D); }
+   else { ElasticityPASetup<3>(fes, ir, lambda, mu, lf, mf, G, D); }
+}
+
+static void ElasticityPADiagonal(const int dim, const int NE, const int NQ,
+                                 const int ND, const Vector &G,
+                                 const Vector &D, Vector &diag,
+                                 const bool add)
+{
+   if (dim == 2) { ElasticityPADiagonal<2>(NE, NQ, ND, G, D, diag, add); }
+   else { ElasticityPADiagonal<3>(NE, NQ, ND, G, D, diag, add); }
+}
+
+void ElasticityIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   // Assuming the same element type
+   Mesh *mesh = fes.GetMesh();
+   pa_fes = NULL;
+   ne = mesh->GetNE();
+   if (ne == 0) { return; }
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation *T = mesh->GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, *T);
+   if (DeviceCanUseCeed())
+   {
+      delete ceedOp;
+      // The Lame coefficient is evaluated during the construction of ceedOp
+      std::unique_ptr<VectorCoefficient> lame(ceed::NewLameCoefficient(*this));
+      const bool mixed = mesh->GetNumGeometries(mesh->Dimension()) > 1 ||
+                         fes.IsVariableOrder();
+      if (mixed)
+      {
+         ceedOp = new ceed::MixedPAElasticityIntegrator(*this, fes, lame.get());
+      }
+      else
+      {
+         ceedOp = new ceed::PAElasticityIntegrator(fes, *ir, lame.get());
+      }
+      return;
+   }
+   MFEM_VERIFY(ElasticityPASupported(fes), "ElasticityIntegrator::AssemblePA"
+               " requires a single element type with dim = sdim = vdim");
+   dim = mesh->Dimension();
+   nq = ir->GetNPoints();
+   nd = el.GetDof();
+   ElasticityPASetup(dim, fes, *ir, lambda, *mu, lambda ? 1.0 : q_lambda,
+                     lambda ? 1.0 : q_mu, pa_G, pa_data);
+   pa_fes = &fes;
+}
+
+void ElasticityIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   if (DeviceCanUseCeed())
+   {
+      ceedOp->AddMult(x, y);
+   }
+   else if (ne > 0)
+   {
+      if (dim == 2) { ElasticityPAApply<2>(ne, nq, nd, pa_G, pa_data, x, y); }
+      else { ElasticityPAApply<3>(ne, nq, nd, pa_G, pa_data, x, y); }
+   }
+}
+
+void ElasticityIntegrator::AssembleDiagonalPA(Vector &diag)
+{
+   if (DeviceCanUseCeed())
+   {
+      ceedOp->GetDiagonal(diag);
+   }
+   else if (ne > 0)
+   {
+      ElasticityPADiagonal(dim, ne, nq, nd, pa_G, pa_data, diag, true);
+   }
+}
+
+void ElasticityIntegrator::AssembleElementDiagonals(
+   const FiniteElementSpace &fes, Vector &diag, const bool add)
+{
+   if (!ElasticityPASupported(fes))
+   {
+      BilinearFormIntegrator::AssembleElementDiagonals(fes, diag, add);
+      return;
+   }
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &GetRule(el, *mesh->GetElementTransformation(0));
+   const int d = mesh->Dimension(), NE = mesh->GetNE();
+   const int NQ = ir->GetNPoints(), ND = el.GetDof();
+   MFEM_VERIFY(diag.Size() == ND*d*NE, "invalid diagonal size");
+   if (pa_fes == &fes && ne == NE && nq == NQ && nd == ND)
+   {
+      // Reuse the quadrature data of AssemblePA()
+      ElasticityPADiagonal(d, NE, NQ, ND, pa_G, pa_data, diag, add);
+      return;
+   }
+   Vector G, D;
+   ElasticityPASetup(d, fes, *ir, lambda, *mu, lambda ? 1.0 : q_lambda,
+                     lambda ? 1.0 : q_mu, G, D);
+   ElasticityPADiagonal(d, NE, NQ, ND, G, D, diag, add);
+}
+
+} // namespace mfem
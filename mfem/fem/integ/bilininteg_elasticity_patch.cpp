@@ -0,0 +1,148 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+#include "../bilininteg.hpp"
+#include "../../mesh/nurbs.hpp"
+#include "../../linalg/dtensor.hpp"
+
+namespace mfem
+{
+
+void ElasticityIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
+{
+   fespace = &fes;
+   Mesh *mesh = fes.GetMesh();
+   MFEM_VERIFY(3 == mesh->Dimension(), "Only 3D so far");
+   MFEM_VERIFY(fes.GetVDim() == 3, "Vector dimension must be 3");
+
+   pbinfo.clear();
+   ppa_data.clear();
+   for (int p=0; p<mesh->NURBSext->GetNP(); ++p)
+   {
+      AssemblePatchPA(p, fes);
+   }
+}
+
+void ElasticityIntegrator::AssemblePatchPA(const int patch,
+                                           const FiniteElementSpace &fes)
+{
+   Mesh *mesh = fes.GetMesh();
+   MFEM_VERIFY((int) pbinfo.size() == patch, "");
+   pbinfo.emplace_back(mesh, patch, patchRules);
+   PatchBasisInfo &pb = pbinfo.back();
+   if (integrationMode == PATCHWISE_REDUCED) { pb.UseReducedRules(true); }
+
+   // For each point, store J^{-1} (column-major), lambda det(J) and
+   // mu det(J). The quadrature weights are included in the test functions of
+   // pb.
+   const Array<int> &Q1D = pb.Q1D;
+   const int NQ = pb.GetNQ();
+   ppa_data.emplace_back(NQ*11);
+   auto D = Reshape(ppa_data.back().HostWrite(), NQ, 11);
+   IntegrationPoint ip;
+   for (int qz=0; qz<Q1D[2]; ++qz)
+   {
+      for (int qy=0; qy<Q1D[1]; ++qy)
+      {
+         for (int qx=0; qx<Q1D[0]; ++qx)
+         {
+            const int q = qx + Q1D[0]*(qy + Q1D[1]*qz);
+            const int e = pb.GetPoint(patchRules, patch, qx, qy, qz, ip);
+            ElementTransformation *tr = mesh->GetElementTransformation(e);
+            tr->SetIntPoint(&ip);
+            const double detJ = tr->Weight();
+            const DenseMatrix &Jinv = tr->InverseJacobian();
+            for (int i = 0; i < 9; i++) { D(q,i) = Jinv.GetData()[i]; }
+            const double M = mu->Eval(*tr, ip);
+            const double L = lambda ? lambda->Eval(*tr, ip) : q_lambda * M;
+            D(q,9) = detJ * L;
+            D(q,10) = detJ * (lambda ? M : q_mu * M);
+         }
+      }
+   }
+}
+
+void ElasticityIntegrator::AddMultPatchPA(const int patch, const Vector &x,
+                                          Vector &y) const
+{
+   const PatchBasisInfo &pb = pbinfo[patch];
+   const int NQ = pb.GetNQ();
+   const int ND = pb.GetND();
+   const auto D = Reshape(ppa_data[patch].HostRead(), NQ, 11);
+
+   // Reference gradients of the three components, G(q,k,c) = d_k u_c.
+   Vector grad(NQ*9);
+   for (int c = 0; c < 3; c++)
+   {
+      pb.Grad(x.HostRead() + c*ND, grad.HostWrite() + c*3*NQ);
+   }
+   auto G = Reshape(grad.HostReadWrite(), NQ, 3, 3);
+   for (int q = 0; q < NQ; q++)
+   {
+      double Jinv[3][3], du[3][3], S[3][3];
+      for (int k = 0; k < 3; k++)
+      {
+         for (int j = 0; j < 3; j++) { Jinv[k][j] = D(q,k+3*j); }
+      }
+      // Physical gradient du[c][j] = d_j u_c
+      for (int c = 0; c < 3; c++)
+      {
+         for (int j = 0; j < 3; j++)
+         {
+            du[c][j] = 0.0;
+            for (int k = 0; k < 3; k++) { du[c][j] += G(q,k,c) * Jinv[k][j]; }
+         }
+      }
+      const double L = D(q,9), M = D(q,10);
+      const double div = du[0][0] + du[1][1] + du[2][2];
+      for (int c = 0; c < 3; c++)
+      {
+         for (int j = 0; j < 3; j++)
+         {
+            S[c][j] = M * (du[c][j] + du[j][c]) + (c == j ? L * div : 0.0);
+         }
+      }
+      // Pull the stress back to the reference gradients of the test functions
+      for (int c = 0; c < 3; c++)
+      {
+         for (int k = 0; k < 3; k++)
+         {
+            G(q,k,c) = Jinv[k][0]*S[c][0] + Jinv[k][1]*S[c][1] +
+                       Jinv[k][2]*S[c][2];
+         }
+      }
+   }
+   for (int c = 0; c < 3; c++)
+   {
+      pb.AddGradTranspose(grad.HostRead() + c*3*NQ,
+                          y.HostReadWrite() + c*ND);
+   }
+}
+
+void ElasticityIntegrator::AddMultNURBSPA(const Vector &x, Vector &y) const
+{
+   Vector xp, yp;
+
+   for (int p=0; p<(int) pbinfo.size(); ++p)
+   {
+      Array<int> vdofs;
+      fespace->GetPatchVDofs(p, vdofs);
+
+      x.GetSubVector(vdofs, xp);
+      yp.SetSize(vdofs.Size());
+      yp = 0.0;
+
+      AddMultPatchPA(p, xp, yp);
+
+      y.AddElementVector(vdofs, yp);
+   }
+}
+
+}
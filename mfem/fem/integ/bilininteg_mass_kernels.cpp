@@ -226,7 +226,8 @@ static void PAMassApply1D(const int NE,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
-                          const int q1d = 0)
+                          const int q1d = 0,
+                          const Array<int> *elems = nullptr)
 {
    MFEM_VERIFY(d1d <= DeviceDofQuadLimits::Get().MAX_D1D, "");
    MFEM_VERIFY(q1d <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
@@ -236,9 +237,12 @@ static void PAMassApply1D(const int NE,
    const auto D = d_.Read();
    const auto X = x_.Read();
    auto Y = y_.ReadWrite();
+   const int n = elems ? elems->Size() : NE;
+   const auto E = elems ? elems->Read() : nullptr;
 
-   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
    {
+      const int e = E ? E[i] : i;
       internal::PAMassApply1D_Element(e, NE, B, Bt, D, X, Y, d1d, q1d);
    });
 }
@@ -267,61 +271,215 @@ void PAMassApply(const int dim,
       MFEM_ABORT("OCCA PA Mass Apply unknown kernel!");
    }
 #endif // MFEM_USE_OCCA
-   const int id = (D1D << 4) | Q1D;
-
    if (dim == 1)
    {
       return PAMassApply1D(NE,B,Bt,D,X,Y,D1D,Q1D);
    }
-   else if (dim == 2)
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension: " << dim);
+   const auto &kernels = PAMassApplyKernels(dim);
+   kernels.Get(D1D, Q1D)(NE,B,Bt,D,X,Y,D1D,Q1D);
+}
+
+void PAMassApplyElements(const int dim,
+                         const int D1D,
+                         const int Q1D,
+                         const int NE,
+                         const Array<int> &elems,
+                         const Array<double> &B,
+                         const Array<double> &Bt,
+                         const Vector &D,
+                         const Vector &X,
+                         Vector &Y)
+{
+   if (elems.Size() == 0) { return; }
+   switch (dim)
+   {
+      case 1: return PAMassApply1D(NE,B,Bt,D,X,Y,D1D,Q1D,&elems);
+      case 2: return PAMassApply2D(NE,B,Bt,D,X,Y,D1D,Q1D,&elems);
+      case 3: return PAMassApply3D(NE,B,Bt,D,X,Y,D1D,Q1D,&elems);
+   }
+   MFEM_ABORT("Unsupported dimension: " << dim);
+}
+
+// Generic PA Mass Apply kernels, used for non-specialized sizes
+static void PAMassApply2DFallback(const int NE,
+                                  const Array<double> &B,
+                                  const Array<double> &Bt,
+                                  const Vector &D,
+                                  const Vector &X,
+                                  Vector &Y,
+                                  const int D1D,
+                                  const int Q1D)
+{
+   PAMassApply2D(NE,B,Bt,D,X,Y,D1D,Q1D);
+}
+
+static void PAMassApply3DFallback(const int NE,
+                                  const Array<double> &B,
+                                  const Array<double> &Bt,
+                                  const Vector &D,
+                                  const Vector &X,
+                                  Vector &Y,
+                                  const int D1D,
+                                  const int Q1D)
+{
+   PAMassApply3D(NE,B,Bt,D,X,Y,D1D,Q1D);
+}
+
+KernelDispatchTable<PAMassApplyKernel> &PAMassApplyKernels(const int dim)
+{
+   static KernelDispatchTable<PAMassApplyKernel> kernels_2d = []()
+   {
+      KernelDispatchTable<PAMassApplyKernel> k(PAMassApply2DFallback);
+      k.Add(2,2,PAMassApply2DKernel<2,2,16>);
+      k.Add(2,4,PAMassApply2DKernel<2,4,16>);
+      k.Add(3,3,PAMassApply2DKernel<3,3,16>);
+      k.Add(3,4,PAMassApply2DKernel<3,4,16>);
+      k.Add(3,5,PAMassApply2DKernel<3,5,16>);
+      k.Add(3,6,PAMassApply2DKernel<3,6,16>);
+      k.Add(4,4,PAMassApply2DKernel<4,4,8>);
+      k.Add(4,6,PAMassApply2DKernel<4,6,8>);
+      k.Add(4,8,PAMassApply2DKernel<4,8,4>);
+      k.Add(5,5,PAMassApply2DKernel<5,5,8>);
+      k.Add(5,7,PAMassApply2DKernel<5,7,8>);
+      k.Add(5,8,PAMassApply2DKernel<5,8,2>);
+      k.Add(6,6,PAMassApply2DKernel<6,6,4>);
+      k.Add(7,7,PAMassApply2DKernel<7,7,4>);
+      k.Add(8,8,PAMassApply2DKernel<8,8,2>);
+      k.Add(9,9,PAMassApply2DKernel<9,9,2>);
+#ifdef MFEM_PA_KERNELS
+#define MFEM_PA_KERNEL(D1D,Q1D) \
+      if (!k.Has(D1D,Q1D)) { k.Add(D1D,Q1D,PAMassApply2DKernel<D1D,Q1D>); }
+      MFEM_PA_KERNELS
+#undef MFEM_PA_KERNEL
+#endif
+      return k;
+   }();
+   static KernelDispatchTable<PAMassApplyKernel> kernels_3d = []()
    {
-      switch (id)
+      KernelDispatchTable<PAMassApplyKernel> k(PAMassApply3DFallback);
+      k.Add(2,2,PAMassApply3DKernel<2,2>);
+      k.Add(2,3,PAMassApply3DKernel<2,3>);
+      k.Add(2,4,PAMassApply3DKernel<2,4>);
+      k.Add(2,6,PAMassApply3DKernel<2,6>);
+      k.Add(3,4,PAMassApply3DKernel<3,4>);
+      k.Add(3,5,PAMassApply3DKernel<3,5>);
+      k.Add(3,6,PAMassApply3DKernel<3,6>);
+      k.Add(3,7,PAMassApply3DKernel<3,7>);
+      k.Add(4,5,PAMassApply3DKernel<4,5>);
+      k.Add(4,6,PAMassApply3DKernel<4,6>);
+      k.Add(4,8,PAMassApply3DKernel<4,8>);
+      k.Add(5,6,PAMassApply3DKernel<5,6>);
+      k.Add(5,8,PAMassApply3DKernel<5,8>);
+      k.Add(6,7,PAMassApply3DKernel<6,7>);
+      k.Add(7,8,PAMassApply3DKernel<7,8>);
+      k.Add(8,9,PAMassApply3DKernel<8,9>);
+      k.Add(9,10,PAMassApply3DKernel<9,10>);
+#ifdef MFEM_PA_KERNELS
+#define MFEM_PA_KERNEL(D1D,Q1D) \
+      if (!k.Has(D1D,Q1D)) { k.Add(D1D,Q1D,PAMassApply3DKernel<D1D,Q1D>); }
+      MFEM_PA_KERNELS
+#undef MFEM_PA_KERNEL
+#endif
+      return k;
+   }();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension: " << dim);
+   return dim == 2 ? kernels_2d : kernels_3d;
+}
+
+template<int T_ND = 0, int T_NQ = 0>
+static void PAMassApplyDense(const int vdim,
+                             const int NE,
+                             const Array<int> *elems,
+                             const Array<double> &b,
+                             const Array<double> &bt,
+                             const Vector &d,
+                             const Vector &x,
+                             Vector &y,
+                             const int nd = 0,
+                             const int nq = 0)
+{
+   const int ND = T_ND ? T_ND : nd;
+   const int NQ = T_NQ ? T_NQ : nq;
+   const int VDIM = vdim;
+   const auto B = Reshape(b.Read(), NQ, ND);
+   const auto Bt = Reshape(bt.Read(), ND, NQ);
+   const auto D = Reshape(d.Read(), NQ, NE);
+   const auto X = Reshape(x.Read(), ND, VDIM, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, VDIM, NE);
+   const int n = elems ? elems->Size() : NE;
+   const auto E = elems ? elems->Read() : nullptr;
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int e = E ? E[i] : i;
+      const int ND = T_ND ? T_ND : nd;
+      const int NQ = T_NQ ? T_NQ : nq;
+      for (int c = 0; c < VDIM; ++c)
       {
-         case 0x22: return SmemPAMassApply2D<2,2,16>(NE,B,Bt,D,X,Y);
-         case 0x24: return SmemPAMassApply2D<2,4,16>(NE,B,Bt,D,X,Y);
-         case 0x33: return SmemPAMassApply2D<3,3,16>(NE,B,Bt,D,X,Y);
-         case 0x34: return SmemPAMassApply2D<3,4,16>(NE,B,Bt,D,X,Y);
-         case 0x35: return SmemPAMassApply2D<3,5,16>(NE,B,Bt,D,X,Y);
-         case 0x36: return SmemPAMassApply2D<3,6,16>(NE,B,Bt,D,X,Y);
-         case 0x44: return SmemPAMassApply2D<4,4,8>(NE,B,Bt,D,X,Y);
-         case 0x46: return SmemPAMassApply2D<4,6,8>(NE,B,Bt,D,X,Y);
-         case 0x48: return SmemPAMassApply2D<4,8,4>(NE,B,Bt,D,X,Y);
-         case 0x55: return SmemPAMassApply2D<5,5,8>(NE,B,Bt,D,X,Y);
-         case 0x57: return SmemPAMassApply2D<5,7,8>(NE,B,Bt,D,X,Y);
-         case 0x58: return SmemPAMassApply2D<5,8,2>(NE,B,Bt,D,X,Y);
-         case 0x66: return SmemPAMassApply2D<6,6,4>(NE,B,Bt,D,X,Y);
-         case 0x77: return SmemPAMassApply2D<7,7,4>(NE,B,Bt,D,X,Y);
-         case 0x88: return SmemPAMassApply2D<8,8,2>(NE,B,Bt,D,X,Y);
-         case 0x99: return SmemPAMassApply2D<9,9,2>(NE,B,Bt,D,X,Y);
-         default:   return PAMassApply2D(NE,B,Bt,D,X,Y,D1D,Q1D);
+         // Interpolate to one quadrature point at a time and immediately
+         // apply the transpose, so no quadrature-sized scratch is needed.
+         for (int q = 0; q < NQ; ++q)
+         {
+            double u = 0.0;
+            for (int dof = 0; dof < ND; ++dof) { u += B(q,dof) * X(dof,c,e); }
+            u *= D(q,e);
+            for (int dof = 0; dof < ND; ++dof) { Y(dof,c,e) += Bt(dof,q) * u; }
+         }
       }
+   });
+}
+
+void PAMassApplyDense(const int vdim,
+                      const int ND,
+                      const int NQ,
+                      const int NE,
+                      const Array<double> &B,
+                      const Array<double> &Bt,
+                      const Vector &D,
+                      const Vector &X,
+                      Vector &Y,
+                      const Array<int> *elems)
+{
+   // Specializations for the default mass integration rules of affine H1
+   // triangles and tetrahedra of orders 1-4.
+   switch ((ND << 8) | NQ)
+   {
+      case 0x0303: return PAMassApplyDense<3,3>(vdim,NE,elems,B,Bt,D,X,Y);
+      case 0x0606: return PAMassApplyDense<6,6>(vdim,NE,elems,B,Bt,D,X,Y);
+      case 0x0A0C: return PAMassApplyDense<10,12>(vdim,NE,elems,B,Bt,D,X,Y);
+      case 0x0F10: return PAMassApplyDense<15,16>(vdim,NE,elems,B,Bt,D,X,Y);
+      case 0x0404: return PAMassApplyDense<4,4>(vdim,NE,elems,B,Bt,D,X,Y);
+      case 0x0A0B: return PAMassApplyDense<10,11>(vdim,NE,elems,B,Bt,D,X,Y);
+      case 0x1418: return PAMassApplyDense<20,24>(vdim,NE,elems,B,Bt,D,X,Y);
+      case 0x232B: return PAMassApplyDense<35,43>(vdim,NE,elems,B,Bt,D,X,Y);
+      default: return PAMassApplyDense(vdim,NE,elems,B,Bt,D,X,Y,ND,NQ);
    }
-   else if (dim == 3)
+}
+
+void PAMassAssembleDiagonalDense(const int vdim,
+                                 const int ND,
+                                 const int NQ,
+                                 const int NE,
+                                 const Array<double> &b,
+                                 const Vector &d,
+                                 Vector &y)
+{
+   const int VDIM = vdim;
+   const auto B = Reshape(b.Read(), NQ, ND);
+   const auto D = Reshape(d.Read(), NQ, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, VDIM, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
    {
-      switch (id)
+      for (int dof = 0; dof < ND; ++dof)
       {
-         case 0x22: return SmemPAMassApply3D<2,2>(NE,B,Bt,D,X,Y);
-         case 0x23: return SmemPAMassApply3D<2,3>(NE,B,Bt,D,X,Y);
-         case 0x24: return SmemPAMassApply3D<2,4>(NE,B,Bt,D,X,Y);
-         case 0x26: return SmemPAMassApply3D<2,6>(NE,B,Bt,D,X,Y);
-         case 0x34: return SmemPAMassApply3D<3,4>(NE,B,Bt,D,X,Y);
-         case 0x35: return SmemPAMassApply3D<3,5>(NE,B,Bt,D,X,Y);
-         case 0x36: return SmemPAMassApply3D<3,6>(NE,B,Bt,D,X,Y);
-         case 0x37: return SmemPAMassApply3D<3,7>(NE,B,Bt,D,X,Y);
-         case 0x45: return SmemPAMassApply3D<4,5>(NE,B,Bt,D,X,Y);
-         case 0x46: return SmemPAMassApply3D<4,6>(NE,B,Bt,D,X,Y);
-         case 0x48: return SmemPAMassApply3D<4,8>(NE,B,Bt,D,X,Y);
-         case 0x56: return SmemPAMassApply3D<5,6>(NE,B,Bt,D,X,Y);
-         case 0x58: return SmemPAMassApply3D<5,8>(NE,B,Bt,D,X,Y);
-         case 0x67: return SmemPAMassApply3D<6,7>(NE,B,Bt,D,X,Y);
-         case 0x78: return SmemPAMassApply3D<7,8>(NE,B,Bt,D,X,Y);
-         case 0x89: return SmemPAMassApply3D<8,9>(NE,B,Bt,D,X,Y);
-         case 0x9A: return SmemPAMassApply3D<9,10>(NE,B,Bt,D,X,Y);
-         default:   return PAMassApply3D(NE,B,Bt,D,X,Y,D1D,Q1D);
+         double s = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            s += B(q,dof) * B(q,dof) * D(q,e);
+         }
+         for (int c = 0; c < VDIM; ++c) { Y(dof,c,e) += s; }
       }
-   }
-   mfem::out << "Unknown kernel 0x" << std::hex << id << std::endl;
-   MFEM_ABORT("Unknown kernel.");
+   });
 }
 
 } // namespace internal
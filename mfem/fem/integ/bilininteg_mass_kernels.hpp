@@ -15,6 +15,7 @@
 #include "../../config/config.hpp"
 #include "../../general/array.hpp"
 #include "../../general/forall.hpp"
+#include "../../general/kernel_dispatch.hpp"
 #include "../../linalg/dtensor.hpp"
 #include "../../linalg/vector.hpp"
 #include "../bilininteg.hpp"
@@ -312,6 +313,46 @@ void PAMassApply(const int dim,
                  const Vector &X,
                  Vector &Y);
 
+// PA Mass Apply kernel restricted to the elements listed in elems, using the
+// generic tensor kernels. X, Y and D are the full E-vectors and quadrature
+// data of the NE elements; only the blocks of the listed elements are used.
+void PAMassApplyElements(const int dim,
+                         const int D1D,
+                         const int Q1D,
+                         const int NE,
+                         const Array<int> &elems,
+                         const Array<double> &B,
+                         const Array<double> &Bt,
+                         const Vector &D,
+                         const Vector &X,
+                         Vector &Y);
+
+// Dense PA Mass Apply kernel for non-tensor elements (e.g. simplices and
+// wedges), using the DofToQuad::FULL basis. The E-vectors X and Y have layout
+// (ND, VDIM, NE) and the same quadrature data D is used for all components.
+// There is no sum factorization: the cost is O(ND*NQ) per element and
+// component, see PADiffusionApplyDense. If elems is given, only the listed
+// elements are applied.
+void PAMassApplyDense(const int vdim,
+                      const int ND,
+                      const int NQ,
+                      const int NE,
+                      const Array<double> &B,
+                      const Array<double> &Bt,
+                      const Vector &D,
+                      const Vector &X,
+                      Vector &Y,
+                      const Array<int> *elems = nullptr);
+
+// Dense PA Mass Diagonal kernel, see PAMassApplyDense.
+void PAMassAssembleDiagonalDense(const int vdim,
+                                 const int ND,
+                                 const int NQ,
+                                 const int NE,
+                                 const Array<double> &B,
+                                 const Vector &D,
+                                 Vector &Y);
+
 #ifdef MFEM_USE_OCCA
 // OCCA PA Mass Apply 2D kernel
 void OccaPAMassApply2D(const int D1D,
@@ -946,7 +987,8 @@ inline void PAMassApply2D(const int NE,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
-                          const int q1d = 0)
+                          const int q1d = 0,
+                          const Array<int> *elems = nullptr)
 {
    MFEM_VERIFY(T_D1D ? T_D1D : d1d <= DeviceDofQuadLimits::Get().MAX_D1D, "");
    MFEM_VERIFY(T_Q1D ? T_Q1D : q1d <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
@@ -956,9 +998,12 @@ inline void PAMassApply2D(const int NE,
    const auto D = d_.Read();
    const auto X = x_.Read();
    auto Y = y_.ReadWrite();
+   const int n = elems ? elems->Size() : NE;
+   const auto E = elems ? elems->Read() : nullptr;
 
-   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
    {
+      const int e = E ? E[i] : i;
       internal::PAMassApply2D_Element(e, NE, B, Bt, D, X, Y, d1d, q1d);
    });
 }
@@ -1002,7 +1047,8 @@ inline void PAMassApply3D(const int NE,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
-                          const int q1d = 0)
+                          const int q1d = 0,
+                          const Array<int> *elems = nullptr)
 {
    MFEM_VERIFY(T_D1D ? T_D1D : d1d <= DeviceDofQuadLimits::Get().MAX_D1D, "");
    MFEM_VERIFY(T_Q1D ? T_Q1D : q1d <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
@@ -1012,9 +1058,12 @@ inline void PAMassApply3D(const int NE,
    const auto D = d_.Read();
    const auto X = x_.Read();
    auto Y = y_.ReadWrite();
+   const int n = elems ? elems->Size() : NE;
+   const auto E = elems ? elems->Read() : nullptr;
 
-   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
    {
+      const int e = E ? E[i] : i;
       internal::PAMassApply3D_Element(e, NE, B, Bt, D, X, Y, d1d, q1d);
    });
 }
@@ -1047,6 +1096,59 @@ inline void SmemPAMassApply3D(const int NE,
    });
 }
 
+/// Signature of the tensor-product PA mass apply kernels.
+using PAMassApplyKernel = void (*)(const int NE,
+                                   const Array<double> &B,
+                                   const Array<double> &Bt,
+                                   const Vector &D,
+                                   const Vector &X,
+                                   Vector &Y,
+                                   const int d1d,
+                                   const int q1d);
+
+// Specialized PA Mass Apply 2D kernel, with the PAMassApplyKernel signature.
+template<int T_D1D, int T_Q1D, int T_NBZ = KernelNBZ2D(T_Q1D)>
+void PAMassApply2DKernel(const int NE,
+                         const Array<double> &B,
+                         const Array<double> &Bt,
+                         const Vector &D,
+                         const Vector &X,
+                         Vector &Y,
+                         const int,
+                         const int)
+{
+   SmemPAMassApply2D<T_D1D,T_Q1D,T_NBZ>(NE,B,Bt,D,X,Y);
+}
+
+// Specialized PA Mass Apply 3D kernel, with the PAMassApplyKernel signature.
+template<int T_D1D, int T_Q1D>
+void PAMassApply3DKernel(const int NE,
+                         const Array<double> &B,
+                         const Array<double> &Bt,
+                         const Vector &D,
+                         const Vector &X,
+                         Vector &Y,
+                         const int,
+                         const int)
+{
+   SmemPAMassApply3D<T_D1D,T_Q1D>(NE,B,Bt,D,X,Y);
+}
+
+/// Dispatch table of the PA mass apply kernels in dimension @a dim (2 or 3),
+/// used by PAMassApply.
+KernelDispatchTable<PAMassApplyKernel> &PAMassApplyKernels(const int dim);
+
+/// Register the (D1D,Q1D) specialization of the DIM-dimensional PA mass apply
+/// kernel, e.g. for high orders or over-integration.
+template<int DIM, int T_D1D, int T_Q1D>
+void AddPAMassApplySpecialization()
+{
+   static_assert(DIM == 2 || DIM == 3, "Unsupported dimension");
+   PAMassApplyKernels(DIM).Add(T_D1D, T_Q1D,
+                               DIM == 2 ? &PAMassApply2DKernel<T_D1D,T_Q1D> :
+                               &PAMassApply3DKernel<T_D1D,T_Q1D>);
+}
+
 } // namespace internal
 
 } // namespace mfem
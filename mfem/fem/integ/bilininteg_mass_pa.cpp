@@ -51,7 +51,8 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    ne = fes.GetMesh()->GetNE();
    nq = ir->GetNPoints();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::DETERMINANTS, mt);
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   const bool tensor = UsesTensorBasis(fes);
+   maps = &el.GetDofToQuad(*ir, tensor ? DofToQuad::TENSOR : DofToQuad::FULL);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
    pa_data.SetSize(ne*nq, mt);
@@ -59,6 +60,29 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    QuadratureSpace qs(*mesh, *ir);
    CoefficientVector coeff(Q, qs, CoefficientStorage::COMPRESSED);
 
+   if (!tensor)
+   {
+      // Simplices and wedges: the quadrature data only depends on the
+      // (flat) quadrature point index.
+      const int NE = ne;
+      const int NQ = nq;
+      const bool const_c = coeff.Size() == 1;
+      const bool by_val = map_type == FiniteElement::VALUE;
+      const auto W = Reshape(ir->GetWeights().Read(), NQ);
+      const auto J = Reshape(geom->detJ.Read(), NQ, NE);
+      const auto C = const_c ? Reshape(coeff.Read(), 1, 1) :
+                     Reshape(coeff.Read(), NQ, NE);
+      auto v = Reshape(pa_data.Write(), NQ, NE);
+      mfem::forall(NE*NQ, [=] MFEM_HOST_DEVICE (int i)
+      {
+         const int q = i % NQ;
+         const int e = i / NQ;
+         const double detJ = J(q,e);
+         const double coeff = const_c ? C(0,0) : C(q,e);
+         v(q,e) = W(q) * coeff * (by_val ? detJ : 1.0/detJ);
+      });
+      return;
+   }
    if (dim==1) { MFEM_ABORT("Not supported yet... stay tuned!"); }
    if (dim==2)
    {
@@ -113,6 +137,58 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    }
 }
 
+void MassIntegrator::AssemblePAUpdate(const FiniteElementSpace &fes,
+                                      const Array<int> &old_elem)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int old_ne = ne;
+   if (DeviceCanUseCeed() || mesh->GetNE() == 0 || old_ne == 0 ||
+       pa_data.Size() != old_ne*nq ||
+       mesh->GetNumGeometries(mesh->Dimension()) > 1 || fes.IsVariableOrder())
+   {
+      AssemblePA(fes);
+      return;
+   }
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation *T0 = mesh->GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, *T0);
+   if (ir->GetNPoints() != nq)
+   {
+      AssemblePA(fes);
+      return;
+   }
+   MFEM_VERIFY(old_elem.Size() == mesh->GetNE(), "invalid element map");
+
+   fespace = &fes;
+   ne = mesh->GetNE();
+   geom = nullptr;
+
+   Array<int> changed;
+   for (int e = 0; e < ne; e++)
+   {
+      if (old_elem[e] < 0) { changed.Append(e); }
+   }
+
+   // The quadrature data of the new elements is evaluated on the host, with
+   // the point ordering of the IntegrationRule used by AssemblePA().
+   const bool by_val = el.GetMapType() == FiniteElement::VALUE;
+   Vector changed_data(nq*changed.Size());
+   for (int k = 0; k < changed.Size(); k++)
+   {
+      ElementTransformation &T = *mesh->GetElementTransformation(changed[k]);
+      for (int q = 0; q < nq; q++)
+      {
+         const IntegrationPoint &ip = ir->IntPoint(q);
+         T.SetIntPoint(&ip);
+         const double detJ = T.Weight();
+         const double coeff = Q ? Q->Eval(T, ip) : 1.0;
+         changed_data(q + nq*k) = ip.weight * coeff *
+                                  (by_val ? detJ : 1.0/detJ);
+      }
+   }
+   RemapPAData(old_elem, changed, changed_data, nq, pa_data);
+}
+
 void MassIntegrator::AssemblePABoundary(const FiniteElementSpace &fes)
 {
    const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
@@ -195,6 +271,12 @@ void MassIntegrator::AssembleDiagonalPA(Vector &diag)
    }
    else
    {
+      if (maps->mode == DofToQuad::FULL)
+      {
+         internal::PAMassAssembleDiagonalDense(1, dofs1D, quad1D, ne, maps->B,
+                                               pa_data, diag);
+         return;
+      }
       internal::PAMassAssembleDiagonal(dim, dofs1D, quad1D, ne, maps->B, pa_data,
                                        diag);
    }
@@ -208,6 +290,12 @@ void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
    else
    {
+      if (maps->mode == DofToQuad::FULL)
+      {
+         internal::PAMassApplyDense(1, dofs1D, quad1D, ne, maps->B, maps->Bt,
+                                    pa_data, x, y);
+         return;
+      }
       internal::PAMassApply(dim, dofs1D, quad1D, ne, maps->B, maps->Bt, pa_data, x,
                             y);
    }
@@ -219,4 +307,25 @@ void MassIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
    AddMultPA(x, y);
 }
 
+void MassIntegrator::AddMultPAElements(const Array<int> &elems,
+                                       const Vector &x, Vector &y) const
+{
+   if (maps->mode == DofToQuad::FULL)
+   {
+      internal::PAMassApplyDense(1, dofs1D, quad1D, ne, maps->B, maps->Bt,
+                                 pa_data, x, y, &elems);
+      return;
+   }
+   internal::PAMassApplyElements(dim, dofs1D, quad1D, ne, elems, maps->B,
+                                 maps->Bt, pa_data, x, y);
+}
+
+void MassIntegrator::AddMultTransposePAElements(const Array<int> &elems,
+                                                const Vector &x,
+                                                Vector &y) const
+{
+   // Mass integrator is symmetric
+   AddMultPAElements(elems, x, y);
+}
+
 } // namespace mfem
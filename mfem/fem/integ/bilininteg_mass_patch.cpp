@@ -0,0 +1,94 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+#include "../bilininteg.hpp"
+#include "../../mesh/nurbs.hpp"
+#include "../../linalg/dtensor.hpp"
+
+namespace mfem
+{
+
+void MassIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
+{
+   fespace = &fes;
+   Mesh *mesh = fes.GetMesh();
+   dim = mesh->Dimension();
+   MFEM_VERIFY(3 == dim, "Only 3D so far");
+
+   pbinfo.clear();
+   ppa_data.clear();
+   for (int p=0; p<mesh->NURBSext->GetNP(); ++p)
+   {
+      AssemblePatchPA(p, fes);
+   }
+}
+
+void MassIntegrator::AssemblePatchPA(const int patch,
+                                     const FiniteElementSpace &fes)
+{
+   Mesh *mesh = fes.GetMesh();
+   MFEM_VERIFY((int) pbinfo.size() == patch, "");
+   pbinfo.emplace_back(mesh, patch, patchRules);
+   PatchBasisInfo &pb = pbinfo.back();
+   if (integrationMode == PATCHWISE_REDUCED) { pb.UseReducedRules(false); }
+
+   // The quadrature weights are included in the test functions of pb.
+   const Array<int> &Q1D = pb.Q1D;
+   ppa_data.emplace_back(pb.GetNQ());
+   auto D = Reshape(ppa_data.back().HostWrite(), Q1D[0], Q1D[1], Q1D[2]);
+   IntegrationPoint ip;
+   for (int qz=0; qz<Q1D[2]; ++qz)
+   {
+      for (int qy=0; qy<Q1D[1]; ++qy)
+      {
+         for (int qx=0; qx<Q1D[0]; ++qx)
+         {
+            const int e = pb.GetPoint(patchRules, patch, qx, qy, qz, ip);
+            ElementTransformation *tr = mesh->GetElementTransformation(e);
+            tr->SetIntPoint(&ip);
+            D(qx,qy,qz) = tr->Weight() * (Q ? Q->Eval(*tr, ip) : 1.0);
+         }
+      }
+   }
+}
+
+void MassIntegrator::AddMultPatchPA(const int patch, const Vector &x,
+                                    Vector &y) const
+{
+   const PatchBasisInfo &pb = pbinfo[patch];
+   const int NQ = pb.GetNQ();
+   const double *D = ppa_data[patch].HostRead();
+
+   Vector u(NQ);
+   pb.Interp(x.HostRead(), u.HostWrite());
+   for (int q = 0; q < NQ; q++) { u[q] *= D[q]; }
+   pb.AddInterpTranspose(u.HostRead(), y.HostReadWrite());
+}
+
+void MassIntegrator::AddMultNURBSPA(const Vector &x, Vector &y) const
+{
+   Vector xp, yp;
+
+   for (int p=0; p<(int) pbinfo.size(); ++p)
+   {
+      Array<int> vdofs;
+      fespace->GetPatchVDofs(p, vdofs);
+
+      x.GetSubVector(vdofs, xp);
+      yp.SetSize(vdofs.Size());
+      yp = 0.0;
+
+      AddMultPatchPA(p, xp, yp);
+
+      y.AddElementVector(vdofs, yp);
+   }
+}
+
+}
@@ -0,0 +1,353 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../fem.hpp"
+#include "../../mesh/nurbs.hpp"
+
+using namespace std;
+
+namespace mfem
+{
+
+PatchBasisInfo::PatchBasisInfo(Mesh *mesh, int patch,
+                               NURBSMeshRules *patchRules)
+{
+   MFEM_VERIFY(patchRules, "patchRules must be defined");
+   dim = mesh->Dimension();
+   MFEM_VERIFY(3 == dim, "Only 3D so far");
+
+   // Set basis functions and gradients for this patch
+   Array<const KnotVector*> pkv;
+   mesh->NURBSext->GetPatchKnotVectors(patch, pkv);
+   MFEM_VERIFY(pkv.Size() == dim, "");
+
+   Q1D.SetSize(dim);
+   D1D.SetSize(dim);
+   ir1d.SetSize(dim);
+   B.resize(dim);
+   G.resize(dim);
+   Bt.resize(dim);
+   Gt.resize(dim);
+   X1D.resize(dim);
+
+   minD.resize(dim);
+   maxD.resize(dim);
+   minQ.resize(dim);
+   maxQ.resize(dim);
+   minDD.resize(dim);
+   maxDD.resize(dim);
+
+   for (int d=0; d<dim; ++d)
+   {
+      ir1d[d] = patchRules->GetPatchRule1D(patch, d);
+
+      Q1D[d] = ir1d[d]->GetNPoints();
+
+      const int order = pkv[d]->GetOrder();
+      D1D[d] = pkv[d]->GetNCP();
+
+      Vector shapeKV(order+1);
+      Vector dshapeKV(order+1);
+
+      B[d].SetSize(Q1D[d], D1D[d]);
+      G[d].SetSize(Q1D[d], D1D[d]);
+      X1D[d].SetSize(Q1D[d]);
+
+      minD[d].assign(D1D[d], Q1D[d]);
+      maxD[d].assign(D1D[d], 0);
+
+      minQ[d].assign(Q1D[d], D1D[d]);
+      maxQ[d].assign(Q1D[d], 0);
+
+      B[d] = 0.0;
+      G[d] = 0.0;
+
+      const Array<int>& knotSpan1D = patchRules->GetPatchRule1D_KnotSpan(patch, d);
+      MFEM_VERIFY(knotSpan1D.Size() == Q1D[d], "");
+
+      for (int i = 0; i < Q1D[d]; i++)
+      {
+         const IntegrationPoint &ip = ir1d[d]->IntPoint(i);
+         const int ijk = knotSpan1D[i];
+         const double kv0 = (*pkv[d])[order + ijk];
+         double kv1 = (*pkv[d])[0];
+         for (int j = order + ijk + 1; j < pkv[d]->Size(); ++j)
+         {
+            if ((*pkv[d])[j] > kv0)
+            {
+               kv1 = (*pkv[d])[j];
+               break;
+            }
+         }
+
+         MFEM_VERIFY(kv1 > kv0, "");
+
+         X1D[d][i] = (ip.x - kv0) / (kv1 - kv0);
+         pkv[d]->CalcShape(shapeKV, ijk, X1D[d][i]);
+         pkv[d]->CalcDShape(dshapeKV, ijk, X1D[d][i]);
+
+         // Put shapeKV into array B storing shapes for all points.
+         // TODO: This should be based on NURBS3DFiniteElement::CalcShape and CalcDShape.
+         // For now, it works under the assumption that all NURBS weights are 1.
+         for (int j=0; j<order+1; ++j)
+         {
+            B[d](i,ijk + j) = shapeKV[j];
+            G[d](i,ijk + j) = dshapeKV[j];
+
+            minD[d][ijk + j] = std::min(minD[d][ijk + j], i);
+            maxD[d][ijk + j] = std::max(maxD[d][ijk + j], i);
+         }
+
+         minQ[d][i] = std::min(minQ[d][i], ijk);
+         maxQ[d][i] = std::max(maxQ[d][i], ijk + order);
+      }
+
+      // Determine which DOFs each DOF interacts with, in 1D.
+      minDD[d].resize(D1D[d]);
+      maxDD[d].resize(D1D[d]);
+      for (int i=0; i<D1D[d]; ++i)
+      {
+         const int qmin = minD[d][i];
+         minDD[d][i] = minQ[d][qmin];
+
+         const int qmax = maxD[d][i];
+         maxDD[d][i] = maxQ[d][qmax];
+      }
+
+      // Test functions, weighted by the full 1D rule.
+      Bt[d].SetSize(D1D[d], Q1D[d]);
+      Gt[d].SetSize(D1D[d], Q1D[d]);
+      for (int i = 0; i < Q1D[d]; i++)
+      {
+         const double w = ir1d[d]->IntPoint(i).weight;
+         for (int j = 0; j < D1D[d]; j++)
+         {
+            Bt[d](j,i) = w * B[d](i,j);
+            Gt[d](j,i) = w * G[d](i,j);
+         }
+      }
+   }
+}
+
+int PatchBasisInfo::GetPoint(NURBSMeshRules *patchRules, int patch,
+                             int qx, int qy, int qz,
+                             IntegrationPoint &ip) const
+{
+   ip.Set(X1D[0][qx], X1D[1][qy], X1D[2][qz],
+          ir1d[0]->IntPoint(qx).weight * ir1d[1]->IntPoint(qy).weight *
+          ir1d[2]->IntPoint(qz).weight);
+   return patchRules->GetPointElement(patch, qx, qy, qz);
+}
+
+void PatchBasisInfo::UseReducedRules(bool grad)
+{
+   for (int d=0; d<dim; ++d)
+   {
+      for (int type = 0; type < (grad ? 2 : 1); type++)
+      {
+         std::vector<Vector> rw;
+         IntArrayVar2D rid;
+         GetReducedRule(Q1D[d], D1D[d], B[d], G[d],
+                        minQ[d], maxQ[d],
+                        minD[d], maxD[d],
+                        minDD[d], maxDD[d], ir1d[d], type == 0, rw, rid);
+
+         const Array2D<double> &A = (type == 0) ? B[d] : G[d];
+         Array2D<double> &At = (type == 0) ? Bt[d] : Gt[d];
+         At = 0.0;
+         for (int j = 0; j < D1D[d]; j++)
+         {
+            for (int r = 0; r < (int) rid[j].size(); r++)
+            {
+               const int i = rid[j][r] + minD[d][j];
+               At(j,i) = rw[j][r] * A(i,j);
+            }
+         }
+      }
+   }
+}
+
+// Contract the tensor x, with sizes (n0,n,n1) in column-major order, with the
+// matrix A of size m x n along its middle index, adding the result to y, of
+// sizes (n0,m,n1). Only the entries A(i,j) with lo[i] <= j <= hi[i] are used.
+static void PatchContract(const int n0, const int n, const int n1,
+                          const Array2D<double> &A,
+                          const std::vector<int> &lo,
+                          const std::vector<int> &hi,
+                          const double *x, double *y)
+{
+   const int m = A.NumRows();
+   for (int k = 0; k < n1; k++)
+   {
+      for (int i = 0; i < m; i++)
+      {
+         double *yi = y + n0*(i + m*k);
+         for (int j = lo[i]; j <= hi[i]; j++)
+         {
+            const double a = A(i,j);
+            const double *xj = x + n0*(j + n*k);
+            for (int l = 0; l < n0; l++) { yi[l] += a * xj[l]; }
+         }
+      }
+   }
+}
+
+// Apply the tensor product of the matrices A[0], A[1] and A[2] to x (which has
+// sizes n[0] x n[1] x n[2]) and add the result to y.
+static void PatchApply3D(const Array2D<double> *A[3],
+                         const PatchBasisInfo::IntArrayVar2D &lo,
+                         const PatchBasisInfo::IntArrayVar2D &hi,
+                         const int n[3],
+                         const double *x, double *y)
+{
+   const int m0 = A[0]->NumRows(), m1 = A[1]->NumRows();
+   Vector t0(m0*n[1]*n[2]), t1(m0*m1*n[2]);
+   t0 = 0.0;
+   t1 = 0.0;
+   PatchContract(1, n[0], n[1]*n[2], *A[0], lo[0], hi[0], x, t0.GetData());
+   PatchContract(m0, n[1], n[2], *A[1], lo[1], hi[1], t0.GetData(),
+                 t1.GetData());
+   PatchContract(m0*m1, n[2], 1, *A[2], lo[2], hi[2], t1.GetData(), y);
+}
+
+void PatchBasisInfo::Interp(const double *x, double *u) const
+{
+   const Array2D<double> *A[3] = { &B[0], &B[1], &B[2] };
+   for (int q = 0; q < GetNQ(); q++) { u[q] = 0.0; }
+   PatchApply3D(A, minQ, maxQ, D1D.GetData(), x, u);
+}
+
+void PatchBasisInfo::Grad(const double *x, double *du) const
+{
+   const int nq = GetNQ();
+   for (int c = 0; c < dim; c++)
+   {
+      const Array2D<double> *A[3];
+      for (int d = 0; d < dim; d++) { A[d] = (d == c) ? &G[d] : &B[d]; }
+      double *duc = du + c*nq;
+      for (int q = 0; q < nq; q++) { duc[q] = 0.0; }
+      PatchApply3D(A, minQ, maxQ, D1D.GetData(), x, duc);
+   }
+}
+
+void PatchBasisInfo::AddInterpTranspose(const double *u, double *y) const
+{
+   const Array2D<double> *A[3] = { &Bt[0], &Bt[1], &Bt[2] };
+   PatchApply3D(A, minD, maxD, Q1D.GetData(), u, y);
+}
+
+void PatchBasisInfo::AddGradTranspose(const double *du, double *y) const
+{
+   const int nq = GetNQ();
+   for (int c = 0; c < dim; c++)
+   {
+      const Array2D<double> *A[3];
+      for (int d = 0; d < dim; d++) { A[d] = (d == c) ? &Gt[d] : &Bt[d]; }
+      PatchApply3D(A, minD, maxD, Q1D.GetData(), du + c*nq, y);
+   }
+}
+
+// Compute a reduced integration rule, using NNLSSolver, for an integrator on a
+// NURBS patch with partial assembly.
+void GetReducedRule(const int nq, const int nd,
+                    Array2D<double> const& B,
+                    Array2D<double> const& G,
+                    std::vector<int> minQ,
+                    std::vector<int> maxQ,
+                    std::vector<int> minD,
+                    std::vector<int> maxD,
+                    std::vector<int> minDD,
+                    std::vector<int> maxDD,
+                    const IntegrationRule *ir,
+                    const bool zeroOrder,
+                    std::vector<Vector> & reducedWeights,
+                    std::vector<std::vector<int>> & reducedIDs)
+{
+   MFEM_VERIFY(B.NumRows() == nq, "");
+   MFEM_VERIFY(B.NumCols() == nd, "");
+   MFEM_VERIFY(G.NumRows() == nq, "");
+   MFEM_VERIFY(G.NumCols() == nd, "");
+   MFEM_VERIFY(ir->GetNPoints() == nq, "");
+
+   for (int dof=0; dof<nd; ++dof)
+   {
+      // Integrate diffusion for B(:,dof) against all other B(:,i)
+
+      const int nc_dof = maxDD[dof] - minDD[dof] + 1;
+      const int nw_dof = maxD[dof] - minD[dof] + 1;
+
+      // G is of size nc_dof x nw_dof
+      MFEM_VERIFY(nc_dof <= nw_dof, "The NNLS system for the reduced "
+                  "integration rule requires more full integration points. Try"
+                  " increasing the order of the full integration rule.");
+      DenseMatrix Gmat(nc_dof, nw_dof);
+      Gmat = 0.0;
+
+      Vector w(nw_dof);
+      w = 0.0;
+
+      for (int qx = minD[dof]; qx <= maxD[dof]; ++qx)
+      {
+         const double Bq = zeroOrder ? B(qx,dof) : G(qx,dof);
+
+         const IntegrationPoint &ip = ir->IntPoint(qx);
+         const double w_qx = ip.weight;
+         w[qx - minD[dof]] = w_qx;
+
+         for (int dx = minQ[qx]; dx <= maxQ[qx]; ++dx)
+         {
+            const double Bd = zeroOrder ? B(qx,dx) : G(qx,dx);
+
+            Gmat(dx - minDD[dof], qx - minD[dof]) = Bq * Bd;
+         }
+      }
+
+      Vector sol(Gmat.NumCols());
+
+#ifdef MFEM_USE_LAPACK
+      NNLSSolver nnls;
+      nnls.SetOperator(Gmat);
+
+      nnls.Mult(w, sol);
+#else
+      MFEM_ABORT("NNLSSolver requires building with LAPACK");
+#endif
+
+      int nnz = 0;
+      for (int i=0; i<sol.Size(); ++i)
+      {
+         if (sol(i) != 0.0)
+         {
+            nnz++;
+         }
+      }
+
+      MFEM_VERIFY(nnz > 0, "");
+
+      Vector wred(nnz);
+      std::vector<int> idnnz(nnz);
+      nnz = 0;
+      for (int i=0; i<sol.Size(); ++i)
+      {
+         if (sol(i) != 0.0)
+         {
+            wred[nnz] = sol[i];
+            idnnz[nnz] = i;
+            nnz++;
+         }
+      }
+
+      reducedWeights.push_back(wred);
+      reducedIDs.push_back(idnnz);
+   }
+}
+
+}
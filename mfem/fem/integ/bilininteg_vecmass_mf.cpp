@@ -28,12 +28,21 @@ void VectorMassIntegrator::AssembleMF(const FiniteElementSpace &fes)
    if (DeviceCanUseCeed())
    {
       delete ceedOp;
+      MFEM_VERIFY(!MQ, "Matrix coefficients are not supported with libCEED.");
       const bool mixed = mesh->GetNumGeometries(mesh->Dimension()) > 1 ||
                          fes.IsVariableOrder();
-      if (mixed)
+      if (mixed && VQ)
+      {
+         ceedOp = new ceed::MixedMFMassIntegrator(*this, fes, VQ);
+      }
+      else if (mixed)
       {
          ceedOp = new ceed::MixedMFMassIntegrator(*this, fes, Q);
       }
+      else if (VQ)
+      {
+         ceedOp = new ceed::MFMassIntegrator(fes, *ir, VQ);
+      }
       else
       {
          ceedOp = new ceed::MFMassIntegrator(fes, *ir, Q);
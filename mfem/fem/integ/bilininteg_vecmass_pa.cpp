@@ -13,6 +13,7 @@
 #include "../bilininteg.hpp"
 #include "../gridfunc.hpp"
 #include "../ceed/integrators/mass/mass.hpp"
+#include "bilininteg_mass_kernels.hpp"
 
 namespace mfem
 {
@@ -29,12 +30,21 @@ void VectorMassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    if (DeviceCanUseCeed())
    {
       delete ceedOp;
+      MFEM_VERIFY(!MQ, "Matrix coefficients are not supported with libCEED.");
       const bool mixed = mesh->GetNumGeometries(mesh->Dimension()) > 1 ||
                          fes.IsVariableOrder();
-      if (mixed)
+      if (mixed && VQ)
+      {
+         ceedOp = new ceed::MixedPAMassIntegrator(*this, fes, VQ);
+      }
+      else if (mixed)
       {
          ceedOp = new ceed::MixedPAMassIntegrator(*this, fes, Q);
       }
+      else if (VQ)
+      {
+         ceedOp = new ceed::PAMassIntegrator(fes, *ir, VQ);
+      }
       else
       {
          ceedOp = new ceed::PAMassIntegrator(fes, *ir, Q);
@@ -46,7 +56,8 @@ void VectorMassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    nq = ir->GetNPoints();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::COORDINATES |
                                     GeometricFactors::JACOBIANS);
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   maps = &el.GetDofToQuad(*ir, UsesTensorBasis(fes) ? DofToQuad::TENSOR :
+                           DofToQuad::FULL);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
    pa_data.SetSize(ne*nq, Device::GetDeviceMemoryType());
@@ -262,6 +273,12 @@ void VectorMassIntegrator::AssembleDiagonalPA(Vector &diag)
    }
    else
    {
+      if (maps->mode == DofToQuad::FULL)
+      {
+         internal::PAMassAssembleDiagonalDense(dim, dofs1D, quad1D, ne,
+                                               maps->B, pa_data, diag);
+         return;
+      }
       PAVectorMassAssembleDiagonal(dim, dofs1D, quad1D, ne,
                                    maps->B, maps->Bt,
                                    pa_data, diag);
@@ -538,6 +555,12 @@ void VectorMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
    else
    {
+      if (maps->mode == DofToQuad::FULL)
+      {
+         internal::PAMassApplyDense(dim, dofs1D, quad1D, ne, maps->B, maps->Bt,
+                                    pa_data, x, y);
+         return;
+      }
       PAVectorMassApply(dim, dofs1D, quad1D, ne, maps->B, maps->Bt, pa_data, x, y);
    }
 }
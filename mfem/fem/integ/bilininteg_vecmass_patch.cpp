@@ -0,0 +1,148 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+#include "../bilininteg.hpp"
+#include "../../mesh/nurbs.hpp"
+#include "../../linalg/dtensor.hpp"
+
+namespace mfem
+{
+
+void VectorMassIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
+{
+   fespace = &fes;
+   Mesh *mesh = fes.GetMesh();
+   dim = mesh->Dimension();
+   MFEM_VERIFY(3 == dim, "Only 3D so far");
+
+   pbinfo.clear();
+   ppa_data.clear();
+   for (int p=0; p<mesh->NURBSext->GetNP(); ++p)
+   {
+      AssemblePatchPA(p, fes);
+   }
+}
+
+void VectorMassIntegrator::AssemblePatchPA(const int patch,
+                                           const FiniteElementSpace &fes)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int vd = fes.GetVDim();
+   if (VQ) { MFEM_VERIFY(VQ->GetVDim() == vd, ""); }
+   if (MQ) { MFEM_VERIFY(MQ->GetVDim() == vd, ""); }
+   coeff_dim = MQ ? vd*vd : (VQ ? vd : 1);
+
+   MFEM_VERIFY((int) pbinfo.size() == patch, "");
+   pbinfo.emplace_back(mesh, patch, patchRules);
+   PatchBasisInfo &pb = pbinfo.back();
+   if (integrationMode == PATCHWISE_REDUCED) { pb.UseReducedRules(false); }
+
+   // The quadrature weights are included in the test functions of pb.
+   const Array<int> &Q1D = pb.Q1D;
+   const int NQ = pb.GetNQ();
+   ppa_data.emplace_back(NQ*coeff_dim);
+   auto D = Reshape(ppa_data.back().HostWrite(), NQ, coeff_dim);
+   Vector vcoeff(VQ ? vd : 0);
+   DenseMatrix mcoeff_q(MQ ? vd : 0);
+   IntegrationPoint ip;
+   for (int qz=0; qz<Q1D[2]; ++qz)
+   {
+      for (int qy=0; qy<Q1D[1]; ++qy)
+      {
+         for (int qx=0; qx<Q1D[0]; ++qx)
+         {
+            const int q = qx + Q1D[0]*(qy + Q1D[1]*qz);
+            const int e = pb.GetPoint(patchRules, patch, qx, qy, qz, ip);
+            ElementTransformation *tr = mesh->GetElementTransformation(e);
+            tr->SetIntPoint(&ip);
+            const double detJ = tr->Weight();
+            if (MQ)
+            {
+               MQ->Eval(mcoeff_q, *tr, ip);
+               for (int i = 0; i < coeff_dim; i++)
+               {
+                  D(q,i) = detJ * mcoeff_q.GetData()[i];
+               }
+            }
+            else if (VQ)
+            {
+               VQ->Eval(vcoeff, *tr, ip);
+               for (int i = 0; i < coeff_dim; i++)
+               {
+                  D(q,i) = detJ * vcoeff(i);
+               }
+            }
+            else
+            {
+               D(q,0) = detJ * (Q ? Q->Eval(*tr, ip) : 1.0);
+            }
+         }
+      }
+   }
+}
+
+void VectorMassIntegrator::AddMultPatchPA(const int patch, const Vector &x,
+                                          Vector &y) const
+{
+   const PatchBasisInfo &pb = pbinfo[patch];
+   const int NQ = pb.GetNQ();
+   const int ND = pb.GetND();
+   const int VD = x.Size() / ND;
+   const auto D = Reshape(ppa_data[patch].HostRead(), NQ, coeff_dim);
+
+   Vector u(NQ*VD), v(NQ*VD);
+   for (int c = 0; c < VD; c++)
+   {
+      pb.Interp(x.HostRead() + c*ND, u.HostWrite() + c*NQ);
+   }
+   const auto U = Reshape(u.HostRead(), NQ, VD);
+   auto V = Reshape(v.HostWrite(), NQ, VD);
+   for (int q = 0; q < NQ; q++)
+   {
+      for (int i = 0; i < VD; i++)
+      {
+         if (MQ)
+         {
+            double vi = 0.0;
+            for (int j = 0; j < VD; j++) { vi += D(q,i+VD*j) * U(q,j); }
+            V(q,i) = vi;
+         }
+         else
+         {
+            V(q,i) = D(q,(coeff_dim == 1) ? 0 : i) * U(q,i);
+         }
+      }
+   }
+   for (int c = 0; c < VD; c++)
+   {
+      pb.AddInterpTranspose(v.HostRead() + c*NQ, y.HostReadWrite() + c*ND);
+   }
+}
+
+void VectorMassIntegrator::AddMultNURBSPA(const Vector &x, Vector &y) const
+{
+   Vector xp, yp;
+
+   for (int p=0; p<(int) pbinfo.size(); ++p)
+   {
+      Array<int> vdofs;
+      fespace->GetPatchVDofs(p, vdofs);
+
+      x.GetSubVector(vdofs, xp);
+      yp.SetSize(vdofs.Size());
+      yp = 0.0;
+
+      AddMultPatchPA(p, xp, yp);
+
+      y.AddElementVector(vdofs, yp);
+   }
+}
+
+}
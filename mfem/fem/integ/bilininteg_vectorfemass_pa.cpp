@@ -16,6 +16,7 @@
 #include "bilininteg_hcurl_kernels.hpp"
 #include "bilininteg_hdiv_kernels.hpp"
 #include "bilininteg_hcurlhdiv_kernels.hpp"
+#include "../ceed/integrators/vecfemass/vecfemass.hpp"
 
 namespace mfem
 {
@@ -28,10 +29,34 @@ void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &fes)
 void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
                                         const FiniteElementSpace &test_fes)
 {
-   // Assumes tensor-product elements
    Mesh *mesh = trial_fes.GetMesh();
+   if (mesh->GetNE() == 0) { return; }
 
    const FiniteElement *trial_fel = trial_fes.GetFE(0);
+   if (DeviceCanUseCeed())
+   {
+      MFEM_VERIFY(&trial_fes == &test_fes, "Different trial and test spaces"
+                  " are not supported with libCEED.");
+      MFEM_VERIFY(!DQ && !MQ, "Only scalar coefficients are supported with"
+                  " libCEED.");
+      const IntegrationRule *ir
+         = IntRule ? IntRule : &MassIntegrator::GetRule(*trial_fel, *trial_fel,
+                                                        *mesh->GetElementTransformation(0));
+      delete ceedOp;
+      const bool mixed = mesh->GetNumGeometries(mesh->Dimension()) > 1 ||
+                         trial_fes.IsVariableOrder();
+      if (mixed)
+      {
+         ceedOp = new ceed::MixedPAVectorFEMassIntegrator(*this, trial_fes, Q);
+      }
+      else
+      {
+         ceedOp = new ceed::PAVectorFEMassIntegrator(trial_fes, *ir, Q);
+      }
+      return;
+   }
+
+   // Assumes tensor-product elements
    const VectorTensorFiniteElement *trial_el =
       dynamic_cast<const VectorTensorFiniteElement*>(trial_fel);
    MFEM_VERIFY(trial_el != NULL, "Only VectorTensorFiniteElement is supported!");
@@ -145,6 +170,12 @@ void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
 
 void VectorFEMassIntegrator::AssembleDiagonalPA(Vector& diag)
 {
+   if (DeviceCanUseCeed())
+   {
+      ceedOp->GetDiagonal(diag);
+      return;
+   }
+
    if (dim == 3)
    {
       if (trial_fetype == mfem::FiniteElement::CURL && test_fetype == trial_fetype)
@@ -215,6 +246,14 @@ void VectorFEMassIntegrator::AssembleDiagonalPA(Vector& diag)
 
 void VectorFEMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
+   if (DeviceCanUseCeed())
+   {
+      // The libCEED operator is only built for identical, hence symmetric,
+      // trial and test spaces
+      ceedOp->AddMult(x, y);
+      return;
+   }
+
    const bool trial_curl = (trial_fetype == mfem::FiniteElement::CURL);
    const bool trial_div = (trial_fetype == mfem::FiniteElement::DIV);
    const bool test_curl = (test_fetype == mfem::FiniteElement::CURL);
@@ -316,6 +355,14 @@ void VectorFEMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 void VectorFEMassIntegrator::AddMultTransposePA(const Vector &x,
                                                 Vector &y) const
 {
+   if (DeviceCanUseCeed())
+   {
+      // The libCEED operator is only built for identical, hence symmetric,
+      // trial and test spaces
+      ceedOp->AddMult(x, y);
+      return;
+   }
+
    const bool trial_curl = (trial_fetype == mfem::FiniteElement::CURL);
    const bool trial_div = (trial_fetype == mfem::FiniteElement::DIV);
    const bool test_curl = (test_fetype == mfem::FiniteElement::CURL);
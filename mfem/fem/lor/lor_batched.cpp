@@ -17,6 +17,7 @@
 
 // Specializations
 #include "lor_h1.hpp"
+#include "lor_h1_vector.hpp"
 #include "lor_nd.hpp"
 #include "lor_rt.hpp"
 
@@ -46,6 +47,23 @@ bool HasIntegrators(BilinearForm &a)
    return false;
 }
 
+// Return true if all the vector-valued H1 integrators of @a a are defined with
+// scalar coefficients (or no coefficient at all).
+static bool HasScalarVectorCoefficients(BilinearForm &a)
+{
+   auto *vm = GetIntegrator<VectorMassIntegrator>(a);
+   if (vm && (vm->GetVectorCoefficient() || vm->GetMatrixCoefficient()))
+   {
+      return false;
+   }
+   auto *vd = GetIntegrator<VectorDiffusionIntegrator>(a);
+   if (vd && (vd->GetVectorCoefficient() || vd->GetMatrixCoefficient()))
+   {
+      return false;
+   }
+   return true;
+}
+
 bool BatchedLORAssembly::FormIsSupported(BilinearForm &a)
 {
    const FiniteElementCollection *fec = a.FESpace()->FEColl();
@@ -56,7 +74,20 @@ bool BatchedLORAssembly::FormIsSupported(BilinearForm &a)
 
    if (dynamic_cast<const H1_FECollection*>(fec))
    {
-      if (HasIntegrators<DiffusionIntegrator, MassIntegrator>(a)) { return true; }
+      const int vdim = a.FESpace()->GetVDim();
+      if (vdim == 1)
+      {
+         if (HasIntegrators<DiffusionIntegrator, MassIntegrator>(a)) { return true; }
+      }
+      else if (vdim == a.FESpace()->GetMesh()->Dimension() &&
+               HasScalarVectorCoefficients(a))
+      {
+         if (HasIntegrators<ElasticityIntegrator, VectorMassIntegrator>(a) ||
+             HasIntegrators<VectorDiffusionIntegrator, VectorMassIntegrator>(a))
+         {
+            return true;
+         }
+      }
    }
    else if (dynamic_cast<const ND_FECollection*>(fec))
    {
@@ -141,7 +172,11 @@ int BatchedLORAssembly::FillI(SparseMatrix &A) const
 
    const int ndof_per_el = fes_ho.GetFE(0)->GetDof();
    const int nel_ho = fes_ho.GetNE();
-   const int nnz_per_row = sparse_mapping.Size()/ndof_per_el;
+   const int vdim = fes_ho.GetVDim();
+   const int ndofs = fes_ho.GetNDofs();
+   const bool byvdim = fes_ho.GetOrdering() == Ordering::byVDIM;
+   const int nvdof_per_el = vdim*ndof_per_el;
+   const int nnz_per_row = sparse_mapping.Size()/nvdof_per_el;
 
    const ElementDofOrdering ordering = ElementDofOrdering::LEXICOGRAPHIC;
    const Operator *op = fes_ho.GetElementRestriction(ordering);
@@ -156,17 +191,21 @@ int BatchedLORAssembly::FillI(SparseMatrix &A) const
    const auto el_dof_lex = Reshape(el_dof_lex_.Read(), ndof_per_el, nel_ho);
    const auto dof_glob2loc = dof_glob2loc_.Read();
    const auto K = dof_glob2loc_offsets_.Read();
-   const auto map = Reshape(sparse_mapping.Read(), nnz_per_row, ndof_per_el);
+   const auto map = Reshape(sparse_mapping.Read(), nnz_per_row, nvdof_per_el);
 
    auto I = A.WriteI();
 
    mfem::forall(nvdof + 1, [=] MFEM_HOST_DEVICE (int ii) { I[ii] = 0; });
-   mfem::forall(ndof_per_el*nel_ho, [=] MFEM_HOST_DEVICE (int i)
+   mfem::forall(nvdof_per_el*nel_ho, [=] MFEM_HOST_DEVICE (int i)
    {
-      const int ii_el = i%ndof_per_el;
-      const int iel_ho = i/ndof_per_el;
+      const int iv_el = i%nvdof_per_el;
+      const int iel_ho = i/nvdof_per_el;
+      const int ii_el = iv_el%ndof_per_el;
+      const int ic = iv_el/ndof_per_el;
       const int sii = el_dof_lex(ii_el, iel_ho);
       const int ii = (sii >= 0) ? sii : -1 -sii;
+      // Vector LDOF index of current row
+      const int iiv = byvdim ? ii*vdim + ic : ii + ic*ndofs;
       // Get number and list of elements containing this DOF
       int i_elts[Max];
       const int i_offset = K[ii];
@@ -180,8 +219,9 @@ int BatchedLORAssembly::FillI(SparseMatrix &A) const
       }
       for (int j = 0; j < nnz_per_row; ++j)
       {
-         int jj_el = map(j, ii_el);
-         if (jj_el < 0) { continue; }
+         const int jv_el = map(j, iv_el);
+         if (jv_el < 0) { continue; }
+         const int jj_el = jv_el%ndof_per_el;
          // LDOF index of column
          const int sjj = el_dof_lex(jj_el, iel_ho); // signed
          const int jj = (sjj >= 0) ? sjj : -1 - sjj;
@@ -190,7 +230,7 @@ int BatchedLORAssembly::FillI(SparseMatrix &A) const
          const int j_ne = j_next_offset - j_offset;
          if (i_ne == 1 || j_ne == 1) // no assembly required
          {
-            AtomicAdd(I[ii], 1);
+            AtomicAdd(I[iiv], 1);
          }
          else // assembly required
          {
@@ -205,7 +245,7 @@ int BatchedLORAssembly::FillI(SparseMatrix &A) const
             const int min_e = GetMinElt(i_elts, i_ne, j_elts, j_ne);
             if (iel_ho == min_e) // add the nnz only once
             {
-               AtomicAdd(I[ii], 1);
+               AtomicAdd(I[iiv], 1);
             }
          }
       }
@@ -231,7 +271,11 @@ void BatchedLORAssembly::FillJAndData(SparseMatrix &A) const
    const int nvdof = fes_ho.GetVSize();
    const int ndof_per_el = fes_ho.GetFE(0)->GetDof();
    const int nel_ho = fes_ho.GetNE();
-   const int nnz_per_row = sparse_mapping.Size()/ndof_per_el;
+   const int vdim = fes_ho.GetVDim();
+   const int ndofs = fes_ho.GetNDofs();
+   const bool byvdim = fes_ho.GetOrdering() == Ordering::byVDIM;
+   const int nvdof_per_el = vdim*ndof_per_el;
+   const int nnz_per_row = sparse_mapping.Size()/nvdof_per_el;
 
    const ElementDofOrdering ordering = ElementDofOrdering::LEXICOGRAPHIC;
    const Operator *op = fes_ho.GetElementRestriction(ordering);
@@ -247,8 +291,8 @@ void BatchedLORAssembly::FillJAndData(SparseMatrix &A) const
    const auto dof_glob2loc = dof_glob2loc_.Read();
    const auto K = dof_glob2loc_offsets_.Read();
 
-   const auto V = Reshape(sparse_ij.Read(), nnz_per_row, ndof_per_el, nel_ho);
-   const auto map = Reshape(sparse_mapping.Read(), nnz_per_row, ndof_per_el);
+   const auto V = Reshape(sparse_ij.Read(), nnz_per_row, nvdof_per_el, nel_ho);
+   const auto map = Reshape(sparse_mapping.Read(), nnz_per_row, nvdof_per_el);
 
    Array<int> I_(nvdof + 1);
    const auto I = I_.Write();
@@ -263,13 +307,16 @@ void BatchedLORAssembly::FillJAndData(SparseMatrix &A) const
 
    static constexpr int Max = 16;
 
-   mfem::forall(ndof_per_el*nel_ho, [=] MFEM_HOST_DEVICE (int i)
+   mfem::forall(nvdof_per_el*nel_ho, [=] MFEM_HOST_DEVICE (int i)
    {
-      const int ii_el = i%ndof_per_el;
-      const int iel_ho = i/ndof_per_el;
+      const int iv_el = i%nvdof_per_el;
+      const int iel_ho = i/nvdof_per_el;
+      const int ii_el = iv_el%ndof_per_el;
+      const int ic = iv_el/ndof_per_el;
       // LDOF index of current row
       const int sii = el_dof_lex(ii_el, iel_ho); // signed
       const int ii = (sii >= 0) ? sii : -1 - sii;
+      const int iiv = byvdim ? ii*vdim + ic : ii + ic*ndofs;
       // Get number and list of elements containing this DOF
       int i_elts[Max];
       int i_B[Max];
@@ -287,20 +334,23 @@ void BatchedLORAssembly::FillJAndData(SparseMatrix &A) const
       }
       for (int j=0; j<nnz_per_row; ++j)
       {
-         int jj_el = map(j, ii_el);
-         if (jj_el < 0) { continue; }
+         const int jv_el = map(j, iv_el);
+         if (jv_el < 0) { continue; }
+         const int jj_el = jv_el%ndof_per_el;
+         const int jc = jv_el/ndof_per_el;
          // LDOF index of column
          const int sjj = el_dof_lex(jj_el, iel_ho); // signed
          const int jj = (sjj >= 0) ? sjj : -1 - sjj;
+         const int jjv = byvdim ? jj*vdim + jc : jj + jc*ndofs;
          const int sgn = ((sjj >=0 && sii >= 0) || (sjj < 0 && sii <0)) ? 1 : -1;
          const int j_offset = K[jj];
          const int j_next_offset = K[jj+1];
          const int j_ne = j_next_offset - j_offset;
          if (i_ne == 1 || j_ne == 1) // no assembly required
          {
-            const int nnz = GetAndIncrementNnzIndex(ii, I);
-            J[nnz] = jj;
-            AV[nnz] = sgn*V(j, ii_el, iel_ho);
+            const int nnz = GetAndIncrementNnzIndex(iiv, I);
+            J[nnz] = jjv;
+            AV[nnz] = sgn*V(j, iv_el, iel_ho);
          }
          else // assembly required
          {
@@ -333,23 +383,25 @@ void BatchedLORAssembly::FillJAndData(SparseMatrix &A) const
                         const int jj_el_2 = (sjj_el_2 >= 0) ? sjj_el_2 : -1 -sjj_el_2;
                         const int sgn_2 = ((sjj_el_2 >=0 && sii_el_2 >= 0)
                                            || (sjj_el_2 < 0 && sii_el_2 <0)) ? 1 : -1;
+                        const int iv_el_2 = ii_el_2 + ic*ndof_per_el;
+                        const int jv_el_2 = jj_el_2 + jc*ndof_per_el;
                         int j2 = -1;
                         // find nonzero in matrix of other element
                         for (int m = 0; m < nnz_per_row; ++m)
                         {
-                           if (map(m, ii_el_2) == jj_el_2)
+                           if (map(m, iv_el_2) == jv_el_2)
                            {
                               j2 = m;
                               break;
                            }
                         }
                         MFEM_ASSERT_KERNEL(j >= 0, "Can't find nonzero");
-                        val += sgn_2*V(j2, ii_el_2, iel_ho_2);
+                        val += sgn_2*V(j2, iv_el_2, iel_ho_2);
                      }
                   }
                }
-               const int nnz = GetAndIncrementNnzIndex(ii, I);
-               J[nnz] = jj;
+               const int nnz = GetAndIncrementNnzIndex(iiv, I);
+               J[nnz] = jjv;
                AV[nnz] = val;
             }
          }
@@ -427,9 +479,16 @@ void BatchedLORAssembly::AssembleWithoutBC(BilinearForm &a, OperatorHandle &A)
    const FiniteElementCollection *fec = fes_ho.FEColl();
    if (dynamic_cast<const H1_FECollection*>(fec))
    {
-      if (HasIntegrators<DiffusionIntegrator, MassIntegrator>(a))
+      if (fes_ho.GetVDim() == 1)
+      {
+         if (HasIntegrators<DiffusionIntegrator, MassIntegrator>(a))
+         {
+            AssemblyKernel<BatchedLOR_H1>(a);
+         }
+      }
+      else
       {
-         AssemblyKernel<BatchedLOR_H1>(a);
+         AssemblyKernel<BatchedLOR_H1Vector>(a);
       }
    }
    else if (dynamic_cast<const ND_FECollection*>(fec))
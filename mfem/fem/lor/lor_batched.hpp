@@ -25,6 +25,7 @@ namespace mfem
 /// supported, currently:
 ///
 ///  - H1 diffusion + mass
+///  - Vector H1 elasticity (or vector diffusion) + vector mass
 ///  - ND curl-curl + mass
 ///  - RT div-div + mass
 ///
@@ -39,15 +40,17 @@ protected:
 
    /// @brief The elementwise LOR matrices in a sparse "ij" format.
    ///
-   /// This is interpreted to have shape (nnz_per_row, ndof_per_el, nel_ho). For
-   /// index (i, j, k), this represents row @a j of the @a kth element matrix.
-   /// The column index is given by sparse_mapping(i, j).
+   /// This is interpreted to have shape (nnz_per_row, vdim*ndof_per_el,
+   /// nel_ho). For index (i, j, k), this represents row @a j of the @a kth
+   /// element matrix. The column index is given by sparse_mapping(i, j). For
+   /// vector-valued spaces, the local row index is j = ldof + c*ndof_per_el,
+   /// where @a c is the vector component.
    Vector sparse_ij;
 
    /// @brief The sparsity pattern of the element matrices.
    ///
    /// This array should be interpreted as having shape (nnz_per_row,
-   /// ndof_per_el). For local DOF index @a j, sparse_mapping(i, j) is the
+   /// vdim*ndof_per_el). For local DOF index @a j, sparse_mapping(i, j) is the
    /// column index of the @a ith nonzero in the @a jth row. If the index is
    /// negative, that entry should be skipped (there is no corresponding
    /// nonzero).
@@ -83,7 +86,8 @@ protected:
    /// @brief Fill in @a sparse_ij and @a sparse_mapping using one of the
    /// specialized LOR assembly kernel classes.
    ///
-   /// @sa Specialization classes: BatchedLOR_H1, BatchedLOR_ND, BatchedLOR_RT
+   /// @sa Specialization classes: BatchedLOR_H1, BatchedLOR_H1Vector,
+   /// BatchedLOR_ND, BatchedLOR_RT
    template <typename LOR_KERNEL> void AssemblyKernel(BilinearForm &a);
 
 public:
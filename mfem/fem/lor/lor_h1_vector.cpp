@@ -0,0 +1,470 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "lor_h1_vector.hpp"
+#include "lor_util.hpp"
+#include "../../linalg/dtensor.hpp"
+#include "../../general/forall.hpp"
+
+namespace mfem
+{
+
+// The local element matrix of the vector form is ordered by components, i.e.
+// the local row index is ldof + c*ndof_per_el. The entries of the (i,a; j,b)
+// block (basis functions i and j, components a and b) are given by
+//
+//    lambda g_i[a] g_j[b] + mu g_i[b] g_j[a] + mu delta_ab (g_i . g_j)
+//    + m delta_ab phi_i phi_j
+//
+// where g_i is the physical gradient of the ith basis function. When assembling
+// the vector diffusion form, the second term is omitted (and lambda is zero).
+// As in the scalar case, the LOR matrices are integrated using the vertices of
+// each low-order element as quadrature points, so phi_i(x_q) = delta_iq.
+
+template <int ORDER>
+void BatchedLOR_H1Vector::Assemble2D()
+{
+   const int nel_ho = fes_ho.GetNE();
+
+   static constexpr int nv = 4;
+   static constexpr int dim = 2;
+   static constexpr int nd1d = ORDER + 1;
+   static constexpr int ndof_per_el = nd1d*nd1d;
+   static constexpr int nnz_per_comp = 9;
+   static constexpr int nnz_per_row = dim*nnz_per_comp;
+
+   const bool const_mq = c1.Size() == 1;
+   const auto MQ = const_mq
+                   ? Reshape(c1.Read(), 1, 1, 1)
+                   : Reshape(c1.Read(), nd1d, nd1d, nel_ho);
+   const bool const_lq = c2.Size() == 1;
+   const auto LQ = const_lq
+                   ? Reshape(c2.Read(), 1, 1, 1)
+                   : Reshape(c2.Read(), nd1d, nd1d, nel_ho);
+   const bool const_uq = c3.Size() == 1;
+   const auto UQ = const_uq
+                   ? Reshape(c3.Read(), 1, 1, 1)
+                   : Reshape(c3.Read(), nd1d, nd1d, nel_ho);
+   const bool elast = elasticity;
+
+   sparse_ij.SetSize(nnz_per_row*dim*ndof_per_el*nel_ho);
+   auto V = Reshape(sparse_ij.Write(), nnz_per_row, nd1d, nd1d, dim, nel_ho);
+
+   auto X = X_vert.Read();
+
+   mfem::forall_2D(nel_ho, ORDER, ORDER, [=] MFEM_HOST_DEVICE (int iel_ho)
+   {
+      // V(j,ix,iy,c) stores the jth nonzero in the row of the sparse matrix
+      // corresponding to component c of local DOF (ix, iy).
+      MFEM_FOREACH_THREAD(iy,y,nd1d)
+      {
+         MFEM_FOREACH_THREAD(ix,x,nd1d)
+         {
+            for (int c=0; c<dim; ++c)
+            {
+               for (int j=0; j<nnz_per_row; ++j)
+               {
+                  V(j,ix,iy,c,iel_ho) = 0.0;
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      MFEM_FOREACH_THREAD(ky,y,ORDER)
+      {
+         MFEM_FOREACH_THREAD(kx,x,ORDER)
+         {
+            double G_[dim*nv*nv];
+            DeviceTensor<3> G(G_, dim, nv, nv);
+            double W[nv], mq[nv], lq[nv], uq[nv];
+
+            double vx[4], vy[4];
+            LORVertexCoordinates2D<ORDER>(X, iel_ho, kx, ky, vx, vy);
+
+            // Physical gradients of the bilinear basis functions and weights
+            // at the quadrature points (vertices of the LOR element).
+            for (int q=0; q<nv; ++q)
+            {
+               const int qx = q%2;
+               const int qy = q/2;
+
+               double J_[2*2];
+               DeviceTensor<2> J(J_, 2, 2);
+               Jacobian2D(qx, qy, vx, vy, J);
+               const double detJ = Det2D(J);
+
+               // adj(J)/det(J)
+               const double A00 = J(1,1)/detJ, A01 = -J(0,1)/detJ;
+               const double A10 = -J(1,0)/detJ, A11 = J(0,0)/detJ;
+
+               W[q] = detJ/nv;
+               mq[q] = const_mq ? MQ(0,0,0) : MQ(kx+qx, ky+qy, iel_ho);
+               lq[q] = const_lq ? LQ(0,0,0) : LQ(kx+qx, ky+qy, iel_ho);
+               uq[q] = const_uq ? UQ(0,0,0) : UQ(kx+qx, ky+qy, iel_ho);
+
+               for (int i=0; i<nv; ++i)
+               {
+                  const int ix = i%2;
+                  const int iy = i/2;
+                  const double bix = (ix == qx) ? 1.0 : 0.0;
+                  const double gix = (ix == 0) ? -1.0 : 1.0;
+                  const double biy = (iy == qy) ? 1.0 : 0.0;
+                  const double giy = (iy == 0) ? -1.0 : 1.0;
+                  const double dx = gix*biy;
+                  const double dy = bix*giy;
+                  G(0,i,q) = A00*dx + A10*dy;
+                  G(1,i,q) = A01*dx + A11*dy;
+               }
+            }
+
+            for (int ii_loc=0; ii_loc<nv; ++ii_loc)
+            {
+               const int ix = ii_loc%2;
+               const int iy = ii_loc/2;
+               for (int jj_loc=0; jj_loc<nv; ++jj_loc)
+               {
+                  const int jx = jj_loc%2;
+                  const int jy = jj_loc/2;
+                  const int jj_off = (jx-ix+1) + 3*(jy-iy+1);
+
+                  double B[dim][dim];
+                  for (int a=0; a<dim; ++a)
+                  {
+                     for (int b=0; b<dim; ++b) { B[a][b] = 0.0; }
+                  }
+                  for (int q=0; q<nv; ++q)
+                  {
+                     double gg = 0.0;
+                     for (int a=0; a<dim; ++a) { gg += G(a,ii_loc,q)*G(a,jj_loc,q); }
+                     double mass = 0.0;
+                     if (ii_loc == q && jj_loc == q) { mass = mq[q]; }
+                     for (int a=0; a<dim; ++a)
+                     {
+                        for (int b=0; b<dim; ++b)
+                        {
+                           double val = lq[q]*G(a,ii_loc,q)*G(b,jj_loc,q);
+                           if (elast) { val += uq[q]*G(b,ii_loc,q)*G(a,jj_loc,q); }
+                           if (a == b) { val += uq[q]*gg + mass; }
+                           B[a][b] += W[q]*val;
+                        }
+                     }
+                  }
+                  for (int a=0; a<dim; ++a)
+                  {
+                     for (int b=0; b<dim; ++b)
+                     {
+                        if (!elast && a != b) { continue; }
+                        AtomicAdd(V(jj_off + nnz_per_comp*b, ix+kx, iy+ky, a, iel_ho),
+                                  B[a][b]);
+                     }
+                  }
+               }
+            }
+         }
+      }
+   });
+
+   sparse_mapping.SetSize(nnz_per_row*dim*ndof_per_el);
+   sparse_mapping = -1;
+   auto map = Reshape(sparse_mapping.HostReadWrite(), nnz_per_row,
+                      dim*ndof_per_el);
+   for (int ic=0; ic<dim; ++ic)
+   {
+      for (int iy=0; iy<nd1d; ++iy)
+      {
+         const int jy_begin = (iy > 0) ? iy - 1 : 0;
+         const int jy_end = (iy < ORDER) ? iy + 1 : ORDER;
+         for (int ix=0; ix<nd1d; ++ix)
+         {
+            const int jx_begin = (ix > 0) ? ix - 1 : 0;
+            const int jx_end = (ix < ORDER) ? ix + 1 : ORDER;
+            const int ii_el = ix + nd1d*iy + ndof_per_el*ic;
+            for (int jc=0; jc<dim; ++jc)
+            {
+               if (!elasticity && jc != ic) { continue; }
+               for (int jy=jy_begin; jy<=jy_end; ++jy)
+               {
+                  for (int jx=jx_begin; jx<=jx_end; ++jx)
+                  {
+                     const int jj_off = (jx-ix+1) + 3*(jy-iy+1);
+                     const int jj_el = jx + nd1d*jy + ndof_per_el*jc;
+                     map(jj_off + nnz_per_comp*jc, ii_el) = jj_el;
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+template <int ORDER>
+void BatchedLOR_H1Vector::Assemble3D()
+{
+   const int nel_ho = fes_ho.GetNE();
+
+   static constexpr int nv = 8;
+   static constexpr int dim = 3;
+   static constexpr int nd1d = ORDER + 1;
+   static constexpr int ndof_per_el = nd1d*nd1d*nd1d;
+   static constexpr int nnz_per_comp = 27;
+   static constexpr int nnz_per_row = dim*nnz_per_comp;
+
+   const bool const_mq = c1.Size() == 1;
+   const auto MQ = const_mq
+                   ? Reshape(c1.Read(), 1, 1, 1, 1)
+                   : Reshape(c1.Read(), nd1d, nd1d, nd1d, nel_ho);
+   const bool const_lq = c2.Size() == 1;
+   const auto LQ = const_lq
+                   ? Reshape(c2.Read(), 1, 1, 1, 1)
+                   : Reshape(c2.Read(), nd1d, nd1d, nd1d, nel_ho);
+   const bool const_uq = c3.Size() == 1;
+   const auto UQ = const_uq
+                   ? Reshape(c3.Read(), 1, 1, 1, 1)
+                   : Reshape(c3.Read(), nd1d, nd1d, nd1d, nel_ho);
+   const bool elast = elasticity;
+
+   sparse_ij.SetSize(nnz_per_row*dim*ndof_per_el*nel_ho);
+   auto V = Reshape(sparse_ij.Write(), nnz_per_row, nd1d, nd1d, nd1d, dim,
+                    nel_ho);
+
+   auto X = X_vert.Read();
+
+   // Last thread dimension is lowered to avoid "too many resources" error
+   mfem::forall_3D(nel_ho, ORDER, ORDER, (ORDER>6)?4:ORDER,
+                   [=] MFEM_HOST_DEVICE (int iel_ho)
+   {
+      MFEM_FOREACH_THREAD(iz,z,nd1d)
+      {
+         MFEM_FOREACH_THREAD(iy,y,nd1d)
+         {
+            MFEM_FOREACH_THREAD(ix,x,nd1d)
+            {
+               for (int c=0; c<dim; ++c)
+               {
+                  for (int j=0; j<nnz_per_row; ++j)
+                  {
+                     V(j,ix,iy,iz,c,iel_ho) = 0.0;
+                  }
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      MFEM_FOREACH_THREAD(kz,z,ORDER)
+      {
+         MFEM_FOREACH_THREAD(ky,y,ORDER)
+         {
+            MFEM_FOREACH_THREAD(kx,x,ORDER)
+            {
+               double G_[dim*nv*nv];
+               DeviceTensor<3> G(G_, dim, nv, nv);
+               double W[nv], mq[nv], lq[nv], uq[nv];
+
+               double vx[8], vy[8], vz[8];
+               LORVertexCoordinates3D<ORDER>(X, iel_ho, kx, ky, kz, vx, vy, vz);
+
+               // Physical gradients of the trilinear basis functions and
+               // weights at the quadrature points (vertices of the LOR element).
+               for (int q=0; q<nv; ++q)
+               {
+                  const int qx = q%2;
+                  const int qy = (q/2)%2;
+                  const int qz = q/4;
+
+                  double J_[3*3];
+                  DeviceTensor<2> J(J_, 3, 3);
+                  Jacobian3D(qx, qy, qz, vx, vy, vz, J);
+                  const double detJ = Det3D(J);
+
+                  // adj(J)
+                  double A_[3*3];
+                  DeviceTensor<2> A(A_, 3, 3);
+                  Adjugate3D(J, A);
+
+                  W[q] = detJ/nv;
+                  mq[q] = const_mq ? MQ(0,0,0,0) : MQ(kx+qx, ky+qy, kz+qz, iel_ho);
+                  lq[q] = const_lq ? LQ(0,0,0,0) : LQ(kx+qx, ky+qy, kz+qz, iel_ho);
+                  uq[q] = const_uq ? UQ(0,0,0,0) : UQ(kx+qx, ky+qy, kz+qz, iel_ho);
+
+                  for (int i=0; i<nv; ++i)
+                  {
+                     const int ix = i%2;
+                     const int iy = (i/2)%2;
+                     const int iz = i/4;
+                     const double bix = (ix == qx) ? 1.0 : 0.0;
+                     const double gix = (ix == 0) ? -1.0 : 1.0;
+                     const double biy = (iy == qy) ? 1.0 : 0.0;
+                     const double giy = (iy == 0) ? -1.0 : 1.0;
+                     const double biz = (iz == qz) ? 1.0 : 0.0;
+                     const double giz = (iz == 0) ? -1.0 : 1.0;
+                     const double dx = gix*biy*biz;
+                     const double dy = bix*giy*biz;
+                     const double dz = bix*biy*giz;
+                     for (int a=0; a<dim; ++a)
+                     {
+                        G(a,i,q) = (A(0,a)*dx + A(1,a)*dy + A(2,a)*dz)/detJ;
+                     }
+                  }
+               }
+
+               for (int ii_loc=0; ii_loc<nv; ++ii_loc)
+               {
+                  const int ix = ii_loc%2;
+                  const int iy = (ii_loc/2)%2;
+                  const int iz = ii_loc/4;
+                  for (int jj_loc=0; jj_loc<nv; ++jj_loc)
+                  {
+                     const int jx = jj_loc%2;
+                     const int jy = (jj_loc/2)%2;
+                     const int jz = jj_loc/4;
+                     const int jj_off = (jx-ix+1) + 3*(jy-iy+1) + 9*(jz-iz+1);
+
+                     double B[dim][dim];
+                     for (int a=0; a<dim; ++a)
+                     {
+                        for (int b=0; b<dim; ++b) { B[a][b] = 0.0; }
+                     }
+                     for (int q=0; q<nv; ++q)
+                     {
+                        double gg = 0.0;
+                        for (int a=0; a<dim; ++a) { gg += G(a,ii_loc,q)*G(a,jj_loc,q); }
+                        double mass = 0.0;
+                        if (ii_loc == q && jj_loc == q) { mass = mq[q]; }
+                        for (int a=0; a<dim; ++a)
+                        {
+                           for (int b=0; b<dim; ++b)
+                           {
+                              double val = lq[q]*G(a,ii_loc,q)*G(b,jj_loc,q);
+                              if (elast) { val += uq[q]*G(b,ii_loc,q)*G(a,jj_loc,q); }
+                              if (a == b) { val += uq[q]*gg + mass; }
+                              B[a][b] += W[q]*val;
+                           }
+                        }
+                     }
+                     for (int a=0; a<dim; ++a)
+                     {
+                        for (int b=0; b<dim; ++b)
+                        {
+                           if (!elast && a != b) { continue; }
+                           AtomicAdd(V(jj_off + nnz_per_comp*b,
+                                       ix+kx, iy+ky, iz+kz, a, iel_ho), B[a][b]);
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   });
+
+   sparse_mapping.SetSize(nnz_per_row*dim*ndof_per_el);
+   sparse_mapping = -1;
+   auto map = Reshape(sparse_mapping.HostReadWrite(), nnz_per_row,
+                      dim*ndof_per_el);
+   for (int ic=0; ic<dim; ++ic)
+   {
+      for (int iz=0; iz<nd1d; ++iz)
+      {
+         const int jz_begin = (iz > 0) ? iz - 1 : 0;
+         const int jz_end = (iz < ORDER) ? iz + 1 : ORDER;
+         for (int iy=0; iy<nd1d; ++iy)
+         {
+            const int jy_begin = (iy > 0) ? iy - 1 : 0;
+            const int jy_end = (iy < ORDER) ? iy + 1 : ORDER;
+            for (int ix=0; ix<nd1d; ++ix)
+            {
+               const int jx_begin = (ix > 0) ? ix - 1 : 0;
+               const int jx_end = (ix < ORDER) ? ix + 1 : ORDER;
+
+               const int ii_el = ix + nd1d*(iy + nd1d*iz) + ndof_per_el*ic;
+
+               for (int jc=0; jc<dim; ++jc)
+               {
+                  if (!elasticity && jc != ic) { continue; }
+                  for (int jz=jz_begin; jz<=jz_end; ++jz)
+                  {
+                     for (int jy=jy_begin; jy<=jy_end; ++jy)
+                     {
+                        for (int jx=jx_begin; jx<=jx_end; ++jx)
+                        {
+                           const int jj_off = (jx-ix+1) + 3*(jy-iy+1) + 9*(jz-iz+1);
+                           const int jj_el = jx + nd1d*(jy + nd1d*jz) + ndof_per_el*jc;
+                           map(jj_off + nnz_per_comp*jc, ii_el) = jj_el;
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+// Explicit template instantiations
+template void BatchedLOR_H1Vector::Assemble2D<1>();
+template void BatchedLOR_H1Vector::Assemble2D<2>();
+template void BatchedLOR_H1Vector::Assemble2D<3>();
+template void BatchedLOR_H1Vector::Assemble2D<4>();
+template void BatchedLOR_H1Vector::Assemble2D<5>();
+template void BatchedLOR_H1Vector::Assemble2D<6>();
+template void BatchedLOR_H1Vector::Assemble2D<7>();
+template void BatchedLOR_H1Vector::Assemble2D<8>();
+
+template void BatchedLOR_H1Vector::Assemble3D<1>();
+template void BatchedLOR_H1Vector::Assemble3D<2>();
+template void BatchedLOR_H1Vector::Assemble3D<3>();
+template void BatchedLOR_H1Vector::Assemble3D<4>();
+template void BatchedLOR_H1Vector::Assemble3D<5>();
+template void BatchedLOR_H1Vector::Assemble3D<6>();
+template void BatchedLOR_H1Vector::Assemble3D<7>();
+template void BatchedLOR_H1Vector::Assemble3D<8>();
+
+BatchedLOR_H1Vector::BatchedLOR_H1Vector(BilinearForm &a,
+                                         FiniteElementSpace &fes_ho_,
+                                         Vector &X_vert_,
+                                         Vector &sparse_ij_,
+                                         Array<int> &sparse_mapping_)
+   : BatchedLORKernel(fes_ho_, X_vert_, sparse_ij_, sparse_mapping_),
+     c3(qs, CoefficientStorage::COMPRESSED)
+{
+   ProjectLORCoefficient<VectorMassIntegrator>(a, c1);
+
+   ElasticityIntegrator *elast_integ = GetIntegrator<ElasticityIntegrator>(a);
+   elasticity = (elast_integ != nullptr);
+   if (elasticity)
+   {
+      // const_cast since Coefficient::Eval is not const...
+      auto *mu = const_cast<Coefficient*>(elast_integ->GetMuCoefficient());
+      auto *lambda =
+         const_cast<Coefficient*>(elast_integ->GetLambdaCoefficient());
+      c3.Project(*mu);
+      if (lambda)
+      {
+         c2.Project(*lambda);
+      }
+      else
+      {
+         // lambda = q_lambda * m and mu = q_mu * m
+         c2.Project(*mu);
+         c2 *= elast_integ->GetLambdaFactor();
+         c3 *= elast_integ->GetMuFactor();
+      }
+   }
+   else
+   {
+      c2.SetConstant(0.0);
+      ProjectLORCoefficient<VectorDiffusionIntegrator>(a, c3);
+   }
+}
+
+} // namespace mfem
@@ -3364,6 +3364,12 @@ void ParFiniteElementSpace::Update(bool want_transform)
 
    BuildElementToDofTable();
 
+   // The elem_dof Table is built from the serial element dofs
+   if (Conforming() && !NURBSext)
+   {
+      ApplyLDofSigns(*elem_dof);
+   }
+
    if (want_transform)
    {
       // calculate appropriate GridFunction transformation
@@ -3506,6 +3512,13 @@ ConformingProlongationOperator::ConformingProlongationOperator(
 }
 
 void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
+void ConformingProlongationOperator::MultBegin(const Vector &x,
+                                               Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Width(), "");
    MFEM_ASSERT(y.Size() == Height(), "");
@@ -3532,16 +3545,35 @@ void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
       j = end+1;
    }
    std::copy(xdata+j-m, xdata+Width(), ydata+j);
+}
 
+void ConformingProlongationOperator::MultEnd(Vector &y) const
+{
    const int out_layout = 0; // 0 - output is ldofs array
    if (!local)
    {
-      gc.BcastEnd(ydata, out_layout);
+      gc.BcastEnd(y.HostReadWrite(), out_layout);
    }
 }
 
 void ConformingProlongationOperator::MultTranspose(
    const Vector &x, Vector &y) const
+{
+   MultTransposeBegin(x);
+   MultTransposeEnd(x, y);
+}
+
+void ConformingProlongationOperator::MultTransposeBegin(const Vector &x) const
+{
+   MFEM_ASSERT(x.Size() == Height(), "");
+   if (!local)
+   {
+      gc.ReduceBegin(x.HostRead());
+   }
+}
+
+void ConformingProlongationOperator::MultTransposeEnd(const Vector &x,
+                                                      Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Height(), "");
    MFEM_ASSERT(y.Size() == Width(), "");
@@ -3550,11 +3582,6 @@ void ConformingProlongationOperator::MultTranspose(
    double *ydata = y.HostWrite();
    const int m = external_ldofs.Size();
 
-   if (!local)
-   {
-      gc.ReduceBegin(xdata);
-   }
-
    int j = 0;
    for (int i = 0; i < m; i++)
    {
@@ -3574,7 +3601,8 @@ void ConformingProlongationOperator::MultTranspose(
 DeviceConformingProlongationOperator::DeviceConformingProlongationOperator(
    const GroupCommunicator &gc_, const SparseMatrix *R, bool local_)
    : ConformingProlongationOperator(R->Width(), gc_, local_),
-     mpi_gpu_aware(Device::GetGPUAwareMPI())
+     mpi_gpu_aware(Device::GetGPUAwareMPI()),
+     num_requests(0)
 {
    MFEM_ASSERT(R->Finalized(), "");
    const int tdofs = R->Height();
@@ -3703,9 +3731,16 @@ void DeviceConformingProlongationOperator::BcastEndCopy(
 
 void DeviceConformingProlongationOperator::Mult(const Vector &x,
                                                 Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
+void DeviceConformingProlongationOperator::MultBegin(const Vector &x,
+                                                     Vector &y) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
-   int req_counter = 0;
+   num_requests = 0;
    // Make sure 'y' is marked as valid on device and for use on device.
    // This ensures that there is no unnecessary host to device copy when the
    // input 'y' is valid on host (in 'y.SetSubVector(ext_ldof, 0.0)' when local
@@ -3728,7 +3763,7 @@ void DeviceConformingProlongationOperator::Mult(const Vector &x,
             auto send_buf = mpi_gpu_aware ? shr_buf.Read() : shr_buf.HostRead();
             MPI_Isend(send_buf + send_offset, send_size, MPI_DOUBLE,
                       gtopo.GetNeighborRank(nbr), 41822,
-                      gtopo.GetComm(), &requests[req_counter++]);
+                      gtopo.GetComm(), &requests[num_requests++]);
          }
          const int recv_offset = ext_buf_offsets[nbr];
          const int recv_size = ext_buf_offsets[nbr+1] - recv_offset;
@@ -3737,14 +3772,18 @@ void DeviceConformingProlongationOperator::Mult(const Vector &x,
             auto recv_buf = mpi_gpu_aware ? ext_buf.Write() : ext_buf.HostWrite();
             MPI_Irecv(recv_buf + recv_offset, recv_size, MPI_DOUBLE,
                       gtopo.GetNeighborRank(nbr), 41822,
-                      gtopo.GetComm(), &requests[req_counter++]);
+                      gtopo.GetComm(), &requests[num_requests++]);
          }
       }
    }
    BcastLocalCopy(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultEnd(Vector &y) const
+{
    if (!local)
    {
-      MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
+      MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
       BcastEndCopy(y); // copy from 'ext_buf'
    }
 }
@@ -3805,9 +3844,16 @@ void DeviceConformingProlongationOperator::ReduceEndAssemble(Vector &y) const
 
 void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
                                                          Vector &y) const
+{
+   MultTransposeBegin(x);
+   MultTransposeEnd(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultTransposeBegin(
+   const Vector &x) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
-   int req_counter = 0;
+   num_requests = 0;
    if (!local)
    {
       ReduceBeginCopy(x); // copy to 'ext_buf'
@@ -3820,7 +3866,7 @@ void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
             auto send_buf = mpi_gpu_aware ? ext_buf.Read() : ext_buf.HostRead();
             MPI_Isend(send_buf + send_offset, send_size, MPI_DOUBLE,
                       gtopo.GetNeighborRank(nbr), 41823,
-                      gtopo.GetComm(), &requests[req_counter++]);
+                      gtopo.GetComm(), &requests[num_requests++]);
          }
          const int recv_offset = shr_buf_offsets[nbr];
          const int recv_size = shr_buf_offsets[nbr+1] - recv_offset;
@@ -3829,14 +3875,19 @@ void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
             auto recv_buf = mpi_gpu_aware ? shr_buf.Write() : shr_buf.HostWrite();
             MPI_Irecv(recv_buf + recv_offset, recv_size, MPI_DOUBLE,
                       gtopo.GetNeighborRank(nbr), 41823,
-                      gtopo.GetComm(), &requests[req_counter++]);
+                      gtopo.GetComm(), &requests[num_requests++]);
          }
       }
    }
+}
+
+void DeviceConformingProlongationOperator::MultTransposeEnd(const Vector &x,
+                                                            Vector &y) const
+{
    ReduceLocalCopy(x, y);
    if (!local)
    {
-      MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
+      MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
       ReduceEndAssemble(y); // assemble from 'shr_buf'
    }
 }
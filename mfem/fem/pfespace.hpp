@@ -442,9 +442,30 @@ public:
 
    const GroupCommunicator &GetGroupCommunicator() const;
 
+   /// Return the sorted list of the ldofs owned by other ranks.
+   const Array<int> &GetExternalLDofs() const { return external_ldofs; }
+
    virtual void Mult(const Vector &x, Vector &y) const;
 
    virtual void MultTranspose(const Vector &x, Vector &y) const;
+
+   /** @brief Split-phase Mult(): start the exchange of the shared dofs and
+       copy the owned dofs of @a x to @a y. */
+   /** Until MultEnd() is called, only the entries of @a y that are not in
+       GetExternalLDofs() are valid, and @a x must not be modified. */
+   virtual void MultBegin(const Vector &x, Vector &y) const;
+
+   /// Complete the Mult() started with MultBegin().
+   virtual void MultEnd(Vector &y) const;
+
+   /** @brief Split-phase MultTranspose(): start the exchange of the entries of
+       @a x in GetExternalLDofs(). */
+   /** These entries of @a x must be final; the other entries may be set
+       before MultTransposeEnd() is called. */
+   virtual void MultTransposeBegin(const Vector &x) const;
+
+   /// Complete the MultTranspose() started with MultTransposeBegin().
+   virtual void MultTransposeEnd(const Vector &x, Vector &y) const;
 };
 
 /// Auxiliary device class used by ParFiniteElementSpace.
@@ -459,6 +480,7 @@ protected:
    Array<int> ltdof_ldof, unq_ltdof;
    Array<int> unq_shr_i, unq_shr_j;
    MPI_Request *requests;
+   mutable int num_requests; // requests posted by the current split-phase op
 
    // Kernel: copy ltdofs from 'src' to 'shr_buf' - prepare for send.
    //         shr_buf[i] = src[shr_ltdof[i]]
@@ -496,6 +518,14 @@ public:
    virtual void Mult(const Vector &x, Vector &y) const;
 
    virtual void MultTranspose(const Vector &x, Vector &y) const;
+
+   virtual void MultBegin(const Vector &x, Vector &y) const;
+
+   virtual void MultEnd(Vector &y) const;
+
+   virtual void MultTransposeBegin(const Vector &x) const;
+
+   virtual void MultTransposeEnd(const Vector &x, Vector &y) const;
 };
 
 }
@@ -48,6 +48,36 @@ void TensorPhysDerivatives(const int NE,
                            const Vector &e_vec,
                            Vector &q_der);
 
+// Transpose of TensorValues: e_vec = B^T q_val, or e_vec += B^T q_val when
+// 'add' is true. Dispatch function.
+template<QVectorLayout VL>
+void TensorValuesTranspose(const int NE,
+                           const int vdim,
+                           const DofToQuad &maps,
+                           const Vector &q_val,
+                           Vector &e_vec,
+                           const bool add);
+
+// Transpose of TensorDerivatives: e_vec = G^T q_der, or e_vec += G^T q_der
+// when 'add' is true. Dispatch function.
+template<QVectorLayout VL>
+void TensorDerivativesTranspose(const int NE,
+                                const int vdim,
+                                const DofToQuad &maps,
+                                const Vector &q_der,
+                                Vector &e_vec,
+                                const bool add);
+
+// Transpose of TensorPhysDerivatives: dispatch function.
+template<QVectorLayout VL>
+void TensorPhysDerivativesTranspose(const int NE,
+                                    const int vdim,
+                                    const DofToQuad &maps,
+                                    const GeometricFactors &geom,
+                                    const Vector &q_der,
+                                    Vector &e_vec,
+                                    const bool add);
+
 // Tensor-product evaluation of quadrature point determinants: dispatch
 // function.
 void TensorDeterminants(const int NE,
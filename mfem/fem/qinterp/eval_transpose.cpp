@@ -0,0 +1,134 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../quadinterpolator.hpp"
+#include "dispatch.hpp"
+#include "eval_transpose.hpp"
+
+namespace mfem
+{
+
+namespace internal
+{
+
+namespace quadrature_interpolator
+{
+
+// Transpose of the tensor-product evaluation of quadrature point values:
+// dispatch function, instantiated below for both QVectorLayout values.
+template<QVectorLayout L>
+void TensorValuesTranspose(const int NE,
+                           const int vdim,
+                           const DofToQuad &maps,
+                           const Vector &q_val,
+                           Vector &e_vec,
+                           const bool add)
+{
+   if (NE == 0) { return; }
+   const int dim = maps.FE->GetDim();
+   const int D1D = maps.ndof;
+   const int Q1D = maps.nqpt;
+   const double *B = maps.B.Read();
+   const double *Y = q_val.Read();
+   double *X = add ? e_vec.ReadWrite() : e_vec.Write();
+
+   const int id = (vdim<<8) | (D1D<<4) | Q1D;
+
+   if (dim == 1)
+   {
+      MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D,
+                  "Orders higher than " << DeviceDofQuadLimits::Get().MAX_D1D-1
+                  << " are not supported!");
+      MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D,
+                  "Quadrature rules with more than "
+                  << DeviceDofQuadLimits::Get().MAX_Q1D
+                  << " 1D points are not supported!");
+      ValuesTranspose1D<L>(NE, B, Y, X, add, vdim, D1D, Q1D);
+      return;
+   }
+   if (dim == 2)
+   {
+      switch (id)
+      {
+         case 0x123: return ValuesTranspose2D<L,1,2,3,8>(NE,B,Y,X,add);
+         case 0x124: return ValuesTranspose2D<L,1,2,4,8>(NE,B,Y,X,add);
+         case 0x134: return ValuesTranspose2D<L,1,3,4,4>(NE,B,Y,X,add);
+         case 0x135: return ValuesTranspose2D<L,1,3,5,4>(NE,B,Y,X,add);
+         case 0x145: return ValuesTranspose2D<L,1,4,5,2>(NE,B,Y,X,add);
+         case 0x146: return ValuesTranspose2D<L,1,4,6,2>(NE,B,Y,X,add);
+
+         case 0x223: return ValuesTranspose2D<L,2,2,3,8>(NE,B,Y,X,add);
+         case 0x224: return ValuesTranspose2D<L,2,2,4,8>(NE,B,Y,X,add);
+         case 0x234: return ValuesTranspose2D<L,2,3,4,4>(NE,B,Y,X,add);
+         case 0x235: return ValuesTranspose2D<L,2,3,5,4>(NE,B,Y,X,add);
+         case 0x245: return ValuesTranspose2D<L,2,4,5,2>(NE,B,Y,X,add);
+         case 0x246: return ValuesTranspose2D<L,2,4,6,2>(NE,B,Y,X,add);
+
+         default:
+         {
+            const int MD = DeviceDofQuadLimits::Get().MAX_D1D;
+            const int MQ = DeviceDofQuadLimits::Get().MAX_Q1D;
+            MFEM_VERIFY(D1D <= MD, "Orders higher than " << MD-1
+                        << " are not supported!");
+            MFEM_VERIFY(Q1D <= MQ, "Quadrature rules with more than "
+                        << MQ << " 1D points are not supported!");
+            ValuesTranspose2D<L>(NE,B,Y,X,add,vdim,D1D,Q1D);
+            return;
+         }
+      }
+   }
+   if (dim == 3)
+   {
+      switch (id)
+      {
+         case 0x123: return ValuesTranspose3D<L,1,2,3>(NE,B,Y,X,add);
+         case 0x124: return ValuesTranspose3D<L,1,2,4>(NE,B,Y,X,add);
+         case 0x134: return ValuesTranspose3D<L,1,3,4>(NE,B,Y,X,add);
+         case 0x135: return ValuesTranspose3D<L,1,3,5>(NE,B,Y,X,add);
+         case 0x145: return ValuesTranspose3D<L,1,4,5>(NE,B,Y,X,add);
+         case 0x146: return ValuesTranspose3D<L,1,4,6>(NE,B,Y,X,add);
+
+         case 0x323: return ValuesTranspose3D<L,3,2,3>(NE,B,Y,X,add);
+         case 0x324: return ValuesTranspose3D<L,3,2,4>(NE,B,Y,X,add);
+         case 0x334: return ValuesTranspose3D<L,3,3,4>(NE,B,Y,X,add);
+         case 0x335: return ValuesTranspose3D<L,3,3,5>(NE,B,Y,X,add);
+         case 0x345: return ValuesTranspose3D<L,3,4,5>(NE,B,Y,X,add);
+         case 0x346: return ValuesTranspose3D<L,3,4,6>(NE,B,Y,X,add);
+
+         default:
+         {
+            const int MD = DeviceDofQuadLimits::Get().MAX_INTERP_1D;
+            const int MQ = DeviceDofQuadLimits::Get().MAX_INTERP_1D;
+            MFEM_VERIFY(D1D <= MD, "Orders higher than " << MD-1
+                        << " are not supported!");
+            MFEM_VERIFY(Q1D <= MQ, "Quadrature rules with more than "
+                        << MQ << " 1D points are not supported!");
+            ValuesTranspose3D<L>(NE,B,Y,X,add,vdim,D1D,Q1D);
+            return;
+         }
+      }
+   }
+   mfem::out << "Unknown kernel 0x" << std::hex << id << std::endl;
+   MFEM_ABORT("Kernel not supported yet");
+}
+
+template void TensorValuesTranspose<QVectorLayout::byNODES>(
+   const int, const int, const DofToQuad &, const Vector &, Vector &,
+   const bool);
+template void TensorValuesTranspose<QVectorLayout::byVDIM>(
+   const int, const int, const DofToQuad &, const Vector &, Vector &,
+   const bool);
+
+} // namespace quadrature_interpolator
+
+} // namespace internal
+
+} // namespace mfem
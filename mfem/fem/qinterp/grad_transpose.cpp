@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../quadinterpolator.hpp"
+#include "dispatch.hpp"
+#include "grad_transpose.hpp"
+
+namespace mfem
+{
+
+namespace internal
+{
+
+namespace quadrature_interpolator
+{
+
+// Transpose of the tensor-product evaluation of quadrature point derivatives:
+// dispatch function, instantiated below for both QVectorLayout values.
+template<QVectorLayout L>
+void TensorDerivativesTranspose(const int NE,
+                                const int vdim,
+                                const DofToQuad &maps,
+                                const Vector &q_der,
+                                Vector &e_vec,
+                                const bool add)
+{
+   if (NE == 0) { return; }
+   const int dim = maps.FE->GetDim();
+   const int D1D = maps.ndof;
+   const int Q1D = maps.nqpt;
+   const double *B = maps.B.Read();
+   const double *G = maps.G.Read();
+   const double *J = nullptr; // not used without GRAD_PHYS
+   const double *Y = q_der.Read();
+   double *X = add ? e_vec.ReadWrite() : e_vec.Write();
+
+   constexpr bool P = false; // GRAD_PHYS
+
+   const int id = (vdim<<8) | (D1D<<4) | Q1D;
+
+   if (dim == 1)
+   {
+      return DerivativesTranspose1D<L,P>(NE,G,J,Y,X,add,dim,vdim,D1D,Q1D);
+   }
+   if (dim == 2)
+   {
+      switch (id)
+      {
+         case 0x123:
+            return DerivativesTranspose2D<L,P,1,2,3,16>(NE,B,G,J,Y,X,add);
+         case 0x134:
+            return DerivativesTranspose2D<L,P,1,3,4,8>(NE,B,G,J,Y,X,add);
+         case 0x135:
+            return DerivativesTranspose2D<L,P,1,3,5,8>(NE,B,G,J,Y,X,add);
+         case 0x145:
+            return DerivativesTranspose2D<L,P,1,4,5,4>(NE,B,G,J,Y,X,add);
+         case 0x146:
+            return DerivativesTranspose2D<L,P,1,4,6,4>(NE,B,G,J,Y,X,add);
+         case 0x158:
+            return DerivativesTranspose2D<L,P,1,5,8,2>(NE,B,G,J,Y,X,add);
+
+         case 0x223:
+            return DerivativesTranspose2D<L,P,2,2,3,8>(NE,B,G,J,Y,X,add);
+         case 0x234:
+            return DerivativesTranspose2D<L,P,2,3,4,4>(NE,B,G,J,Y,X,add);
+         case 0x235:
+            return DerivativesTranspose2D<L,P,2,3,5,4>(NE,B,G,J,Y,X,add);
+         case 0x245:
+            return DerivativesTranspose2D<L,P,2,4,5,2>(NE,B,G,J,Y,X,add);
+         case 0x246:
+            return DerivativesTranspose2D<L,P,2,4,6,2>(NE,B,G,J,Y,X,add);
+         case 0x258:
+            return DerivativesTranspose2D<L,P,2,5,8,2>(NE,B,G,J,Y,X,add);
+         default:
+         {
+            const int MD = DeviceDofQuadLimits::Get().MAX_D1D;
+            const int MQ = DeviceDofQuadLimits::Get().MAX_Q1D;
+            MFEM_VERIFY(D1D <= MD, "Orders higher than " << MD-1
+                        << " are not supported!");
+            MFEM_VERIFY(Q1D <= MQ, "Quadrature rules with more than "
+                        << MQ << " 1D points are not supported!");
+            DerivativesTranspose2D<L,P>(NE,B,G,J,Y,X,add,2,vdim,D1D,Q1D);
+            return;
+         }
+      }
+   }
+   if (dim == 3)
+   {
+      switch (id)
+      {
+         case 0x123:
+            return DerivativesTranspose3D<L,P,1,2,3>(NE,B,G,J,Y,X,add);
+         case 0x134:
+            return DerivativesTranspose3D<L,P,1,3,4>(NE,B,G,J,Y,X,add);
+         case 0x135:
+            return DerivativesTranspose3D<L,P,1,3,5>(NE,B,G,J,Y,X,add);
+         case 0x145:
+            return DerivativesTranspose3D<L,P,1,4,5>(NE,B,G,J,Y,X,add);
+         case 0x146:
+            return DerivativesTranspose3D<L,P,1,4,6>(NE,B,G,J,Y,X,add);
+         case 0x158:
+            return DerivativesTranspose3D<L,P,1,5,8>(NE,B,G,J,Y,X,add);
+
+         case 0x323:
+            return DerivativesTranspose3D<L,P,3,2,3>(NE,B,G,J,Y,X,add);
+         case 0x334:
+            return DerivativesTranspose3D<L,P,3,3,4>(NE,B,G,J,Y,X,add);
+         case 0x335:
+            return DerivativesTranspose3D<L,P,3,3,5>(NE,B,G,J,Y,X,add);
+         case 0x345:
+            return DerivativesTranspose3D<L,P,3,4,5>(NE,B,G,J,Y,X,add);
+         case 0x346:
+            return DerivativesTranspose3D<L,P,3,4,6>(NE,B,G,J,Y,X,add);
+         case 0x358:
+            return DerivativesTranspose3D<L,P,3,5,8>(NE,B,G,J,Y,X,add);
+         default:
+         {
+            const int MD = DeviceDofQuadLimits::Get().MAX_INTERP_1D;
+            const int MQ = DeviceDofQuadLimits::Get().MAX_INTERP_1D;
+            MFEM_VERIFY(D1D <= MD, "Orders higher than " << MD-1
+                        << " are not supported!");
+            MFEM_VERIFY(Q1D <= MQ, "Quadrature rules with more than "
+                        << MQ << " 1D points are not supported!");
+            DerivativesTranspose3D<L,P>(NE,B,G,J,Y,X,add,vdim,D1D,Q1D);
+            return;
+         }
+      }
+   }
+   mfem::out << "Unknown kernel 0x" << std::hex << id << std::endl;
+   MFEM_ABORT("Kernel not supported yet");
+}
+
+template void TensorDerivativesTranspose<QVectorLayout::byNODES>(
+   const int, const int, const DofToQuad &, const Vector &,
+   Vector &, const bool);
+template void TensorDerivativesTranspose<QVectorLayout::byVDIM>(
+   const int, const int, const DofToQuad &, const Vector &,
+   Vector &, const bool);
+
+} // namespace quadrature_interpolator
+
+} // namespace internal
+
+} // namespace mfem
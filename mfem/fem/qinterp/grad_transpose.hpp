@@ -0,0 +1,398 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+// Internal header, included only by .cpp files.
+// Template function implementations.
+
+#include "../quadinterpolator.hpp"
+#include "../../general/forall.hpp"
+#include "../../linalg/dtensor.hpp"
+#include "../../fem/kernels.hpp"
+#include "../../linalg/kernels.hpp"
+
+namespace mfem
+{
+
+namespace internal
+{
+
+namespace quadrature_interpolator
+{
+
+// Transpose of Derivatives1D: x = G^T y, or x += G^T y when 'add' is true.
+// With GRAD_PHYS, the physical derivatives y are first pulled back to the
+// reference element with the transpose of the (left) inverse Jacobian.
+template<QVectorLayout Q_LAYOUT, bool GRAD_PHYS>
+static void DerivativesTranspose1D(const int NE,
+                                   const double *g_,
+                                   const double *j_,
+                                   const double *y_,
+                                   double *x_,
+                                   const bool add,
+                                   const int sdim,
+                                   const int vdim,
+                                   const int d1d,
+                                   const int q1d)
+{
+   const auto g = Reshape(g_, q1d, d1d);
+   const auto j = Reshape(j_, q1d, sdim, NE);
+   const auto y = Q_LAYOUT == QVectorLayout::byNODES ?
+                  Reshape(y_, q1d, vdim, sdim, NE):
+                  Reshape(y_, vdim, sdim, q1d, NE);
+   auto x = Reshape(x_, d1d, vdim, NE);
+
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int c = 0; c < vdim; c++)
+      {
+         if (!add)
+         {
+            for (int d = 0; d < d1d; d++) { x(d, c, e) = 0.0; }
+         }
+         for (int q = 0; q < q1d; q++)
+         {
+            double du[3] = {0.0, 0.0, 0.0};
+            for (int d = 0; d < sdim; ++d)
+            {
+               du[d] = Q_LAYOUT == QVectorLayout::byVDIM ?
+                       y(c, d, q, e) : y(q, c, d, e);
+            }
+            if (GRAD_PHYS)
+            {
+               if (sdim == 1) { du[0] /= j(q, 0, e); }
+               else if (sdim == 2)
+               {
+                  const double Jloc[2] = {j(q,0,e), j(q,1,e)};
+                  double Jinv[3];
+                  kernels::CalcLeftInverse<2,1>(Jloc, Jinv);
+                  du[0] = Jinv[0]*du[0] + Jinv[1]*du[1];
+               }
+               else // sdim == 3
+               {
+                  const double Jloc[3] = {j(q,0,e), j(q,1,e), j(q,2,e)};
+                  double Jinv[3];
+                  kernels::CalcLeftInverse<3,1>(Jloc, Jinv);
+                  du[0] = Jinv[0]*du[0] + Jinv[1]*du[1] + Jinv[2]*du[2];
+               }
+            }
+            for (int d = 0; d < d1d; d++)
+            {
+               x(d, c, e) += g(q, d) * du[0];
+            }
+         }
+      }
+   });
+}
+
+// Template compute kernel for the transpose of derivatives in 2D: tensor
+// product version.
+template<QVectorLayout Q_LAYOUT, bool GRAD_PHYS,
+         int T_VDIM = 0, int T_D1D = 0, int T_Q1D = 0,
+         int T_NBZ = 1>
+static void DerivativesTranspose2D(const int NE,
+                                   const double *b_,
+                                   const double *g_,
+                                   const double *j_,
+                                   const double *y_,
+                                   double *x_,
+                                   const bool add,
+                                   const int sdim = 2,
+                                   const int vdim = 0,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int VDIM = T_VDIM ? T_VDIM : vdim;
+   const int SDIM = GRAD_PHYS ? sdim : 2;
+   static constexpr int NBZ = T_NBZ ? T_NBZ : 1;
+
+   const auto b = Reshape(b_, Q1D, D1D);
+   const auto g = Reshape(g_, Q1D, D1D);
+   const auto j = Reshape(j_, Q1D, Q1D, SDIM, 2, NE);
+   const auto y = Q_LAYOUT == QVectorLayout::byNODES ?
+                  Reshape(y_, Q1D, Q1D, VDIM, SDIM, NE):
+                  Reshape(y_, VDIM, SDIM, Q1D, Q1D, NE);
+   auto x = Reshape(x_, D1D, D1D, VDIM, NE);
+
+   mfem::forall_2D_batch(NE, Q1D, Q1D, NBZ, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      const int VDIM = T_VDIM ? T_VDIM : vdim;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+
+      const int tidz = MFEM_THREAD_ID(z);
+      MFEM_SHARED double BG[2][MQ1*MD1];
+      kernels::internal::LoadBG<MD1,MQ1>(D1D,Q1D,b,g,BG);
+      DeviceMatrix B(BG[0], D1D, Q1D);
+      DeviceMatrix G(BG[1], D1D, Q1D);
+
+      MFEM_SHARED double s_QQ[2][NBZ][MQ1*MQ1];
+      DeviceTensor<2> QQ0(s_QQ[0][tidz], Q1D, Q1D);
+      DeviceTensor<2> QQ1(s_QQ[1][tidz], Q1D, Q1D);
+
+      MFEM_SHARED double s_DQ[2][NBZ][MD1*MQ1];
+      DeviceTensor<2> DQ0(s_DQ[0][tidz], D1D, Q1D);
+      DeviceTensor<2> DQ1(s_DQ[1][tidz], D1D, Q1D);
+
+      for (int c = 0; c < VDIM; ++c)
+      {
+         MFEM_FOREACH_THREAD(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD(qx,x,Q1D)
+            {
+               double du[3] = {0.0, 0.0, 0.0};
+               for (int d = 0; d < SDIM; ++d)
+               {
+                  if (Q_LAYOUT == QVectorLayout::byVDIM)
+                  {
+                     du[d] = y(c,d,qx,qy,e);
+                  }
+                  else // Q_LAYOUT == QVectorLayout::byNODES
+                  {
+                     du[d] = y(qx,qy,c,d,e);
+                  }
+               }
+               if (GRAD_PHYS)
+               {
+                  if (SDIM == 2)
+                  {
+                     double Jloc[4], Jinv[4];
+                     Jloc[0] = j(qx,qy,0,0,e);
+                     Jloc[1] = j(qx,qy,1,0,e);
+                     Jloc[2] = j(qx,qy,0,1,e);
+                     Jloc[3] = j(qx,qy,1,1,e);
+                     kernels::CalcInverse<2>(Jloc, Jinv);
+                     const double U = Jinv[0]*du[0] + Jinv[2]*du[1];
+                     const double V = Jinv[1]*du[0] + Jinv[3]*du[1];
+                     du[0] = U;
+                     du[1] = V;
+                  }
+                  else
+                  {
+                     double Jloc[6], Jinv[6];
+                     Jloc[0] = j(qx,qy,0,0,e);
+                     Jloc[1] = j(qx,qy,1,0,e);
+                     Jloc[2] = j(qx,qy,2,0,e);
+                     Jloc[3] = j(qx,qy,0,1,e);
+                     Jloc[4] = j(qx,qy,1,1,e);
+                     Jloc[5] = j(qx,qy,2,1,e);
+                     kernels::CalcLeftInverse<3,2>(Jloc, Jinv);
+                     const double U = Jinv[0]*du[0] + Jinv[2]*du[1] +
+                                      Jinv[4]*du[2];
+                     const double V = Jinv[1]*du[0] + Jinv[3]*du[1] +
+                                      Jinv[5]*du[2];
+                     du[0] = U;
+                     du[1] = V;
+                  }
+               }
+               QQ0(qx,qy) = du[0];
+               QQ1(qx,qy) = du[1];
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D)
+            {
+               double u = 0.0;
+               double v = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  u += G(dx,qx) * QQ0(qx,qy);
+                  v += B(dx,qx) * QQ1(qx,qy);
+               }
+               DQ0(dx,qy) = u;
+               DQ1(dx,qy) = v;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D)
+            {
+               double u = 0.0;
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  u += B(dy,qy) * DQ0(dx,qy) + G(dy,qy) * DQ1(dx,qy);
+               }
+               x(dx,dy,c,e) = add ? x(dx,dy,c,e) + u : u;
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// Template compute kernel for the transpose of derivatives in 3D: tensor
+// product version.
+template<QVectorLayout Q_LAYOUT, bool GRAD_PHYS,
+         int T_VDIM = 0, int T_D1D = 0, int T_Q1D = 0>
+static void DerivativesTranspose3D(const int NE,
+                                   const double *b_,
+                                   const double *g_,
+                                   const double *j_,
+                                   const double *y_,
+                                   double *x_,
+                                   const bool add,
+                                   const int vdim = 0,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int VDIM = T_VDIM ? T_VDIM : vdim;
+
+   const auto b = Reshape(b_, Q1D, D1D);
+   const auto g = Reshape(g_, Q1D, D1D);
+   const auto j = Reshape(j_, Q1D, Q1D, Q1D, 3, 3, NE);
+   const auto y = Q_LAYOUT == QVectorLayout::byNODES ?
+                  Reshape(y_, Q1D, Q1D, Q1D, VDIM, 3, NE):
+                  Reshape(y_, VDIM, 3, Q1D, Q1D, Q1D, NE);
+   auto x = Reshape(x_, D1D, D1D, D1D, VDIM, NE);
+
+   mfem::forall_3D(NE, Q1D, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      const int VDIM = T_VDIM ? T_VDIM : vdim;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_INTERP_1D;
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_INTERP_1D;
+      constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
+
+      MFEM_SHARED double BG[2][MQ1*MD1];
+      kernels::internal::LoadBG<MD1,MQ1>(D1D,Q1D,b,g,BG);
+      DeviceMatrix B(BG[0], D1D, Q1D);
+      DeviceMatrix G(BG[1], D1D, Q1D);
+
+      MFEM_SHARED double sm0[3][MDQ*MDQ*MDQ];
+      MFEM_SHARED double sm1[3][MDQ*MDQ*MDQ];
+      DeviceTensor<3> QQQ0(sm0[0], Q1D, Q1D, Q1D);
+      DeviceTensor<3> QQQ1(sm0[1], Q1D, Q1D, Q1D);
+      DeviceTensor<3> QQQ2(sm0[2], Q1D, Q1D, Q1D);
+      DeviceTensor<3> DQQ0(sm1[0], D1D, Q1D, Q1D);
+      DeviceTensor<3> DQQ1(sm1[1], D1D, Q1D, Q1D);
+      DeviceTensor<3> DQQ2(sm1[2], D1D, Q1D, Q1D);
+      DeviceTensor<3> DDQ0(sm0[0], D1D, D1D, Q1D);
+      DeviceTensor<3> DDQ1(sm0[1], D1D, D1D, Q1D);
+
+      for (int c = 0; c < VDIM; ++c)
+      {
+         MFEM_FOREACH_THREAD(qz,z,Q1D)
+         {
+            MFEM_FOREACH_THREAD(qy,y,Q1D)
+            {
+               MFEM_FOREACH_THREAD(qx,x,Q1D)
+               {
+                  double u, v, w;
+                  if (Q_LAYOUT == QVectorLayout::byVDIM)
+                  {
+                     u = y(c,0,qx,qy,qz,e);
+                     v = y(c,1,qx,qy,qz,e);
+                     w = y(c,2,qx,qy,qz,e);
+                  }
+                  else // Q_LAYOUT == QVectorLayout::byNODES
+                  {
+                     u = y(qx,qy,qz,c,0,e);
+                     v = y(qx,qy,qz,c,1,e);
+                     w = y(qx,qy,qz,c,2,e);
+                  }
+                  if (GRAD_PHYS)
+                  {
+                     double Jloc[9], Jinv[9];
+                     for (int col = 0; col < 3; col++)
+                     {
+                        for (int row = 0; row < 3; row++)
+                        {
+                           Jloc[row+3*col] = j(qx,qy,qz,row,col,e);
+                        }
+                     }
+                     kernels::CalcInverse<3>(Jloc, Jinv);
+                     const double U = Jinv[0]*u + Jinv[3]*v + Jinv[6]*w;
+                     const double V = Jinv[1]*u + Jinv[4]*v + Jinv[7]*w;
+                     const double W = Jinv[2]*u + Jinv[5]*v + Jinv[8]*w;
+                     u = U; v = V; w = W;
+                  }
+                  QQQ0(qx,qy,qz) = u;
+                  QQQ1(qx,qy,qz) = v;
+                  QQQ2(qx,qy,qz) = w;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(qz,z,Q1D)
+         {
+            MFEM_FOREACH_THREAD(qy,y,Q1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  double u = 0.0;
+                  double v = 0.0;
+                  double w = 0.0;
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     u += G(dx,qx) * QQQ0(qx,qy,qz);
+                     v += B(dx,qx) * QQQ1(qx,qy,qz);
+                     w += B(dx,qx) * QQQ2(qx,qy,qz);
+                  }
+                  DQQ0(dx,qy,qz) = u;
+                  DQQ1(dx,qy,qz) = v;
+                  DQQ2(dx,qy,qz) = w;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(qz,z,Q1D)
+         {
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  double u = 0.0;
+                  double v = 0.0;
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     u += B(dy,qy) * DQQ0(dx,qy,qz) + G(dy,qy) * DQQ1(dx,qy,qz);
+                     v += B(dy,qy) * DQQ2(dx,qy,qz);
+                  }
+                  DDQ0(dx,dy,qz) = u;
+                  DDQ1(dx,dy,qz) = v;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dz,z,D1D)
+         {
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  double u = 0.0;
+                  for (int qz = 0; qz < Q1D; ++qz)
+                  {
+                     u += B(dz,qz) * DDQ0(dx,dy,qz) + G(dz,qz) * DDQ1(dx,dy,qz);
+                  }
+                  x(dx,dy,dz,c,e) = add ? x(dx,dy,dz,c,e) + u : u;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+} // namespace quadrature_interpolator
+
+} // namespace internal
+
+} // namespace mfem
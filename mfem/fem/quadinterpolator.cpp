@@ -447,6 +447,107 @@ static void Eval3D(const int NE,
    });
 }
 
+// Compute kernel for the transpose of the quadrature interpolation:
+// * non-tensor product version, all dimensions,
+// * assumes 'e_vec' is using ElementDofOrdering::NATIVE,
+// * assumes 'maps.mode == FULL'.
+static void EvalTranspose(const int NE,
+                          const int vdim,
+                          const QVectorLayout q_layout,
+                          const GeometricFactors *geom,
+                          const DofToQuad &maps,
+                          const Vector &q_val,
+                          const Vector &q_der,
+                          Vector &e_vec,
+                          const int eval_flags)
+{
+   using QI = QuadratureInterpolator;
+
+   const int nd = maps.ndof;
+   const int nq = maps.nqpt;
+   const int dim = maps.FE->GetDim();
+   MFEM_ASSERT(maps.mode == DofToQuad::FULL, "internal error");
+   MFEM_VERIFY(!geom || geom->mesh->SpaceDimension() == dim,
+               "physical derivatives require a square element Jacobian");
+   MFEM_VERIFY(bool(geom) == bool(eval_flags & QI::PHYSICAL_DERIVATIVES),
+               "'geom' must be given (non-null) only when evaluating physical"
+               " derivatives");
+   const bool use_val = eval_flags & QI::VALUES;
+   const bool use_der = eval_flags & (QI::DERIVATIVES |
+                                      QI::PHYSICAL_DERIVATIVES);
+   const bool phys = eval_flags & QI::PHYSICAL_DERIVATIVES;
+   const auto B = Reshape(maps.B.Read(), nq, nd);
+   const auto G = Reshape(maps.G.Read(), nq, dim, nd);
+   const auto J = Reshape(geom ? geom->J.Read() : nullptr, nq, dim, dim, NE);
+   const double *q_val_ptr = use_val ? q_val.Read() : nullptr;
+   const double *q_der_ptr = use_der ? q_der.Read() : nullptr;
+   const auto val = q_layout == QVectorLayout::byNODES ?
+                    Reshape(q_val_ptr, nq, vdim, NE):
+                    Reshape(q_val_ptr, vdim, nq, NE);
+   const auto der = q_layout == QVectorLayout::byNODES ?
+                    Reshape(q_der_ptr, nq, vdim, dim, NE):
+                    Reshape(q_der_ptr, vdim, dim, nq, NE);
+   auto E = Reshape(e_vec.Write(), nd, vdim, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int c = 0; c < vdim; c++)
+      {
+         for (int d = 0; d < nd; d++) { E(d,c,e) = 0.0; }
+      }
+      for (int q = 0; q < nq; q++)
+      {
+         double Jinv[9];
+         if (phys)
+         {
+            double Jloc[9];
+            for (int col = 0; col < dim; col++)
+            {
+               for (int row = 0; row < dim; row++)
+               {
+                  Jloc[row+dim*col] = J(q,row,col,e);
+               }
+            }
+            if (dim == 1) { Jinv[0] = 1.0/Jloc[0]; }
+            if (dim == 2) { kernels::CalcInverse<2>(Jloc, Jinv); }
+            if (dim == 3) { kernels::CalcInverse<3>(Jloc, Jinv); }
+         }
+         for (int c = 0; c < vdim; c++)
+         {
+            double u = 0.0;
+            if (use_val)
+            {
+               u = q_layout == QVectorLayout::byNODES ? val(q,c,e) : val(c,q,e);
+            }
+            double du[3] = {0.0, 0.0, 0.0};
+            if (use_der)
+            {
+               double D[3];
+               for (int i = 0; i < dim; i++)
+               {
+                  D[i] = q_layout == QVectorLayout::byNODES ?
+                         der(q,c,i,e) : der(c,i,q,e);
+               }
+               // the transpose of the physical derivatives is (J^{-1} D)
+               for (int i = 0; i < dim; i++)
+               {
+                  if (!phys) { du[i] = D[i]; continue; }
+                  for (int k = 0; k < dim; k++)
+                  {
+                     du[i] += Jinv[i+dim*k]*D[k];
+                  }
+               }
+            }
+            for (int d = 0; d < nd; d++)
+            {
+               double ed = B(q,d)*u;
+               for (int i = 0; i < dim; i++) { ed += G(q,i,d)*du[i]; }
+               E(d,c,e) += ed;
+            }
+         }
+      }
+   });
+}
+
 } // namespace quadrature_interpolator
 
 } // namespace internal
@@ -522,7 +623,18 @@ void QuadratureInterpolator::Mult(const Vector &e_vec,
       }
       if (eval_flags & DETERMINANTS)
       {
-         TensorDeterminants(ne, vdim, maps, e_vec, q_det, d_buffer);
+         const int dim = maps.FE->GetDim();
+         if (q_layout == QVectorLayout::byNODES &&
+             (eval_flags & DERIVATIVES) && vdim == dim && dim > 1)
+         {
+            // The Jacobians are already in q_der with the interleaved layout
+            // of BatchDet(): reuse them instead of interpolating again.
+            BatchDet(dim, ir->GetNPoints(), q_der, q_det);
+         }
+         else
+         {
+            TensorDeterminants(ne, vdim, maps, e_vec, q_det, d_buffer);
+         }
       }
    }
    else // use_tensor_eval == false
@@ -689,11 +801,93 @@ void QuadratureInterpolator::MultTranspose(unsigned eval_flags,
                                            const Vector &q_der,
                                            Vector &e_vec) const
 {
-   MFEM_CONTRACT_VAR(eval_flags);
-   MFEM_CONTRACT_VAR(q_val);
-   MFEM_CONTRACT_VAR(q_der);
-   MFEM_CONTRACT_VAR(e_vec);
-   MFEM_ABORT("this method is not implemented yet");
+   using namespace internal::quadrature_interpolator;
+
+   MFEM_VERIFY(!(eval_flags & DETERMINANTS),
+               "the transpose of DETERMINANTS is not supported");
+   MFEM_VERIFY(!((eval_flags & DERIVATIVES) &&
+                 (eval_flags & PHYSICAL_DERIVATIVES)),
+               "DERIVATIVES and PHYSICAL_DERIVATIVES share 'q_der'");
+
+   const int ne = fespace->GetNE();
+   if (ne == 0) { return; }
+   const int vdim = fespace->GetVDim();
+   const FiniteElement *fe = fespace->GetFE(0);
+   const bool use_tensor_eval =
+      use_tensor_products &&
+      dynamic_cast<const TensorBasisElement*>(fe) != nullptr;
+   const IntegrationRule *ir =
+      IntRule ? IntRule : &qspace->GetElementIntRule(0);
+   const DofToQuad::Mode mode =
+      use_tensor_eval ? DofToQuad::TENSOR : DofToQuad::FULL;
+   const DofToQuad &maps = fe->GetDofToQuad(*ir, mode);
+   const GeometricFactors *geom = nullptr;
+   if (eval_flags & PHYSICAL_DERIVATIVES)
+   {
+      const int jacobians = GeometricFactors::JACOBIANS;
+      geom = fespace->GetMesh()->GetGeometricFactors(*ir, jacobians);
+   }
+
+   MFEM_ASSERT(fespace->GetMesh()->GetNumGeometries(
+                  fespace->GetMesh()->Dimension()) == 1,
+               "mixed meshes are not supported");
+
+   if (!(eval_flags & (VALUES | DERIVATIVES | PHYSICAL_DERIVATIVES)))
+   {
+      e_vec = 0.0;
+      return;
+   }
+
+   if (use_tensor_eval)
+   {
+      // The first contribution sets e_vec, the second one is added to it.
+      const bool by_nodes = q_layout == QVectorLayout::byNODES;
+      constexpr QVectorLayout NODES = QVectorLayout::byNODES;
+      constexpr QVectorLayout VDIM = QVectorLayout::byVDIM;
+      const bool add = eval_flags & VALUES;
+      if (eval_flags & VALUES)
+      {
+         if (by_nodes)
+         {
+            TensorValuesTranspose<NODES>(ne, vdim, maps, q_val, e_vec, false);
+         }
+         else
+         {
+            TensorValuesTranspose<VDIM>(ne, vdim, maps, q_val, e_vec, false);
+         }
+      }
+      if (eval_flags & DERIVATIVES)
+      {
+         if (by_nodes)
+         {
+            TensorDerivativesTranspose<NODES>(
+               ne, vdim, maps, q_der, e_vec, add);
+         }
+         else
+         {
+            TensorDerivativesTranspose<VDIM>(
+               ne, vdim, maps, q_der, e_vec, add);
+         }
+      }
+      if (eval_flags & PHYSICAL_DERIVATIVES)
+      {
+         if (by_nodes)
+         {
+            TensorPhysDerivativesTranspose<NODES>(
+               ne, vdim, maps, *geom, q_der, e_vec, add);
+         }
+         else
+         {
+            TensorPhysDerivativesTranspose<VDIM>(
+               ne, vdim, maps, *geom, q_der, e_vec, add);
+         }
+      }
+   }
+   else // use_tensor_eval == false
+   {
+      EvalTranspose(ne, vdim, q_layout, geom, maps, q_val, q_der, e_vec,
+                    eval_flags);
+   }
 }
 
 void QuadratureInterpolator::Values(const Vector &e_vec,
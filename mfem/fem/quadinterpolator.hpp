@@ -127,7 +127,14 @@ public:
        reference coordinates) of the E-vector @a e_vec at quadrature points. */
    void Determinants(const Vector &e_vec, Vector &q_det) const;
 
-   /// Perform the transpose operation of Mult(). (TODO)
+   /** @brief Perform the transpose operation of Mult().
+
+       The E-vector @a e_vec is set to the sum of the transposes of the
+       evaluations selected by @a eval_flags, applied to @a q_val (VALUES) and
+       @a q_der (DERIVATIVES or PHYSICAL_DERIVATIVES), using the same layouts
+       as Mult(). DETERMINANTS is not supported, and at most one of
+       DERIVATIVES and PHYSICAL_DERIVATIVES can be given. The result uses the
+       E-vector ordering expected by Mult(). */
    void MultTranspose(unsigned eval_flags, const Vector &q_val,
                       const Vector &q_der, Vector &e_vec) const;
 };
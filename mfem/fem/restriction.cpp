@@ -12,6 +12,7 @@
 #include "restriction.hpp"
 #include "gridfunc.hpp"
 #include "fespace.hpp"
+#include "fe/face_map_utils.hpp"
 #include "../general/forall.hpp"
 #include <climits>
 
@@ -126,6 +127,60 @@ void ElementRestriction::Mult(const Vector& x, Vector& y) const
    });
 }
 
+void ElementRestriction::MultElements(const Array<int> &elems,
+                                      const Vector& x, Vector& y) const
+{
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_x = Reshape(x.Read(), t?vd:ndofs, t?ndofs:vd);
+   auto d_y = Reshape(y.ReadWrite(), nd, vd, ne);
+   auto d_gather_map = gather_map.Read();
+   auto d_elems = elems.Read();
+   mfem::forall(nd*elems.Size(), [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int e = d_elems[i / nd];
+      const int gid = d_gather_map[i % nd + nd*e];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int c = 0; c < vd; ++c)
+      {
+         const double dof_value = d_x(t?c:j, t?j:c);
+         d_y(i % nd, c, e) = plus ? dof_value : -dof_value;
+      }
+   });
+}
+
+void ElementRestriction::MultTransposeDofs(const Array<int> &dofs,
+                                           const Vector& x, Vector& y) const
+{
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_offsets = offsets.Read();
+   auto d_indices = indices.Read();
+   auto d_dofs = dofs.Read();
+   auto d_x = Reshape(x.Read(), nd, vd, ne);
+   auto d_y = Reshape(y.ReadWrite(), t?vd:ndofs, t?ndofs:vd);
+   mfem::forall(dofs.Size(), [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = d_dofs[k];
+      const int offset = d_offsets[i];
+      const int next_offset = d_offsets[i + 1];
+      for (int c = 0; c < vd; ++c)
+      {
+         double dof_value = 0;
+         for (int j = offset; j < next_offset; ++j)
+         {
+            const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 - d_indices[j];
+            dof_value += ((d_indices[j] >= 0) ? d_x(idx_j % nd, c, idx_j / nd) :
+                          -d_x(idx_j % nd, c, idx_j / nd));
+         }
+         d_y(t?c:i,t?i:c) = dof_value;
+      }
+   });
+}
+
 void ElementRestriction::MultUnsigned(const Vector& x, Vector& y) const
 {
    // Assumes all elements have the same number of dofs
@@ -2064,6 +2119,173 @@ const
    MFEM_ABORT("Not yet implemented.");
 }
 
+L2NormalDerivativeFaceRestriction::L2NormalDerivativeFaceRestriction(
+   const FiniteElementSpace &fes_, const FaceType type_)
+   : fes(fes_),
+     type(type_),
+     nf(fes_.GetNFbyType(type_)),
+     dim(fes_.GetMesh()->Dimension()),
+     dof1d(fes_.GetMaxElementOrder()+1),
+     face_dofs(static_cast<int>(std::pow(dof1d, dim-1)))
+{
+   height = 2*face_dofs*nf;
+   width = fes.GetVSize();
+
+   MFEM_VERIFY(fes.GetVDim() == 1, "Only scalar spaces are supported.");
+   const FiniteElement *fe0 = fes.GetNE() > 0 ? fes.GetFE(0) : NULL;
+   const TensorBasisElement *tfe = dynamic_cast<const TensorBasisElement*>(fe0);
+   if (nf == 0 || tfe == NULL) { return; }
+   MFEM_VERIFY(tfe->GetBasisType() == BasisType::GaussLobatto ||
+               tfe->GetBasisType() == BasisType::Positive,
+               "Only Gauss-Lobatto and Bernstein basis are supported in "
+               "L2NormalDerivativeFaceRestriction.");
+
+   // Outward derivatives of the 1D basis at both ends of the reference segment
+   end_dshape.SetSize(2*dof1d);
+   Vector shape1d(dof1d), dshape1d(dof1d);
+   for (int end = 0; end < 2; end++)
+   {
+      tfe->GetBasis1D().Eval(end, shape1d, dshape1d);
+      for (int m = 0; m < dof1d; m++)
+      {
+         end_dshape[m + dof1d*end] = end ? dshape1d(m) : -dshape1d(m);
+      }
+   }
+
+   Mesh &mesh = *fes.GetMesh();
+   const Table &e2dTable = fes.GetElementToDofTable();
+   const int *elem_map = e2dTable.GetJ();
+   const int elem_dofs = fe0->GetDof();
+   const int ndofs = fes.GetNDofs();
+   line_indices.SetSize(dof1d*face_dofs*2*nf);
+   face_ends.SetSize(2*nf);
+   gather_offsets.SetSize(ndofs+1);
+   gather_offsets = 0;
+   Array<int> face_map(face_dofs);
+
+   int f_ind = 0;
+   for (int f = 0; f < fes.GetNF(); ++f)
+   {
+      Mesh::FaceInformation face = mesh.GetFaceInformation(f);
+      MFEM_VERIFY(!face.IsShared(), "Shared faces are not supported in "
+                  "L2NormalDerivativeFaceRestriction.");
+      if (!face.IsOfFaceType(type)) { continue; }
+      MFEM_VERIFY(face.IsConforming() || face.IsBoundary(),
+                  "Nonconforming faces are not supported in "
+                  "L2NormalDerivativeFaceRestriction.");
+      const int face_id1 = face.element[0].local_face_id;
+      for (int s = 0; s < 2; s++)
+      {
+         int *lines = line_indices.HostWrite() + dof1d*face_dofs*(s + 2*f_ind);
+         if (s == 1 && !face.IsInterior())
+         {
+            face_ends[s + 2*f_ind] = -1;
+            for (int i = 0; i < dof1d*face_dofs; i++) { lines[i] = -1; }
+            continue;
+         }
+         const int elem = face.element[s].index;
+         const int face_id = face.element[s].local_face_id;
+         const std::pair<int,int> normal = internal::GetFaceNormal(dim, face_id);
+         const int stride = static_cast<int>(std::pow(dof1d, normal.first));
+         face_ends[s + 2*f_ind] = normal.second;
+         fes.GetFE(elem)->GetFaceMap(face_id, face_map);
+         for (int d = 0; d < face_dofs; d++)
+         {
+            // Face dofs of the second element are permuted to match the
+            // ordering of the first one, as in L2FaceRestriction.
+            const int pd = (s == 0) ? d :
+                           PermuteFaceL2(dim, face_id1, face_id,
+                                         face.element[1].orientation, dof1d, d);
+            const int v = face_map[pd];
+            const int base = v - ((v / stride) % dof1d)*stride;
+            for (int m = 0; m < dof1d; m++)
+            {
+               const int dof = elem_map[elem*elem_dofs + base + m*stride];
+               lines[m + dof1d*d] = dof;
+               ++gather_offsets[dof + 1];
+            }
+         }
+      }
+      f_ind++;
+   }
+   MFEM_VERIFY(f_ind == nf, "Unexpected number of faces.");
+
+   for (int i = 1; i <= ndofs; ++i)
+   {
+      gather_offsets[i] += gather_offsets[i - 1];
+   }
+   gather_indices.SetSize(gather_offsets[ndofs]);
+   for (int k = 0; k < line_indices.Size(); k++)
+   {
+      const int dof = line_indices[k];
+      if (dof >= 0) { gather_indices[gather_offsets[dof]++] = k; }
+   }
+   for (int i = ndofs; i > 0; --i)
+   {
+      gather_offsets[i] = gather_offsets[i - 1];
+   }
+   gather_offsets[0] = 0;
+}
+
+void L2NormalDerivativeFaceRestriction::Mult(const Vector &x, Vector &y) const
+{
+   if (nf == 0) { return; }
+   const int D1D = dof1d;
+   const int FD = face_dofs;
+   auto d_lines = Reshape(line_indices.Read(), D1D, FD, 2, nf);
+   auto d_ends = Reshape(face_ends.Read(), 2, nf);
+   auto d_dshape = Reshape(end_dshape.Read(), D1D, 2);
+   auto d_x = x.Read();
+   auto d_y = Reshape(y.Write(), FD, 2, nf);
+   mfem::forall(FD*2*nf, [=] MFEM_HOST_DEVICE (int tid)
+   {
+      const int d = tid % FD;
+      const int s = (tid / FD) % 2;
+      const int f = tid / (2*FD);
+      const int end = d_ends(s, f);
+      double dudn = 0.0;
+      if (end >= 0)
+      {
+         for (int m = 0; m < D1D; m++)
+         {
+            dudn += d_dshape(m, end) * d_x[d_lines(m, d, s, f)];
+         }
+      }
+      d_y(d, s, f) = dudn;
+   });
+}
+
+void L2NormalDerivativeFaceRestriction::AddMultTranspose(const Vector &x,
+                                                         Vector &y,
+                                                         const double a) const
+{
+   if (nf == 0) { return; }
+   const int D1D = dof1d;
+   const int FD = face_dofs;
+   const int ndofs = fes.GetNDofs();
+   auto d_offsets = gather_offsets.Read();
+   auto d_indices = gather_indices.Read();
+   auto d_ends = Reshape(face_ends.Read(), 2, nf);
+   auto d_dshape = Reshape(end_dshape.Read(), D1D, 2);
+   auto d_x = x.Read();
+   auto d_y = y.ReadWrite();
+   mfem::forall(ndofs, [=] MFEM_HOST_DEVICE (int i)
+   {
+      double dof_value = 0.0;
+      for (int j = d_offsets[i]; j < d_offsets[i + 1]; ++j)
+      {
+         // The line entry k = m + D1D*(d + FD*(s + 2*f)) holds the
+         // contribution of the L-dof i to the face value d + FD*(s + 2*f).
+         const int k = d_indices[j];
+         const int m = k % D1D;
+         const int fdof = k / D1D;
+         const int sf = fdof / FD;
+         dof_value += d_dshape(m, d_ends(sf % 2, sf / 2)) * d_x[fdof];
+      }
+      d_y[i] += a*dof_value;
+   });
+}
+
 int ToLexOrdering(const int dim, const int face_id, const int size1d,
                   const int index)
 {
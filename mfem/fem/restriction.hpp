@@ -69,6 +69,17 @@ public:
    /// contributions; this is a left inverse of the Mult() operation
    void MultLeftInverse(const Vector &x, Vector &y) const;
 
+   /// Compute Mult() for the elements in the list @a elems only.
+   /** The entries of @a y of the other elements are not modified. */
+   void MultElements(const Array<int> &elems, const Vector &x,
+                     Vector &y) const;
+
+   /// Compute MultTranspose() for the dofs in the list @a dofs only.
+   /** The list contains scalar dof indices: the entries of all components of
+       these dofs are set in @a y and the other entries are not modified. */
+   void MultTransposeDofs(const Array<int> &dofs, const Vector &x,
+                          Vector &y) const;
+
    /// @brief Fills the E-vector y with `boolean` values 0.0 and 1.0 such that each
    /// each entry of the L-vector is uniquely represented in `y`.
    /** This means, the sum of the E-vector `y` is equal to the sum of the
@@ -1015,6 +1026,61 @@ public:
    void DoubleValuedNonconformingTransposeInterpolationInPlace(Vector& x) const;
 };
 
+/** @brief Operator that extracts the reference normal derivatives of an L2
+    field at the face degrees of freedom, for tensor-product elements with a
+    closed (Gauss-Lobatto or Bernstein) basis.
+
+    The face E-vector has the layout of a double-valued L2FaceRestriction with
+    lexicographic ordering, (face_dofs x 2 x nf): on each side of a face, the
+    derivative of the element function along the outward normal axis of the
+    reference element is evaluated at the face dofs, which are ordered as in
+    L2FaceRestriction, i.e. the values of the second element are permuted to
+    match the ordering of the first one. On boundary faces, the values of the
+    second side are zero.
+
+    The derivative at a face dof only involves the element dofs on the line
+    normal to the face through it. Conforming meshes and scalar spaces are
+    supported, and shared faces are not. Objects of this type are used by the
+    partially assembled face integrators that require normal derivatives, see
+    BilinearFormIntegrator::RequiresFaceNormalDerivatives(). */
+class L2NormalDerivativeFaceRestriction : public FaceRestriction
+{
+protected:
+   const FiniteElementSpace &fes;
+   const FaceType type;
+   const int nf; // Number of faces of the requested type
+   const int dim;
+   const int dof1d;
+   const int face_dofs; // Number of dofs on each face
+   /// L-vector dofs on the normal line of each face dof and side,
+   /// (dof1d x face_dofs x 2 x nf).
+   Array<int> line_indices;
+   /// End (0 or 1) of the normal reference axis on each side, (2 x nf), or -1
+   /// for the missing side of boundary faces.
+   Array<int> face_ends;
+   /// Outward derivatives of the 1D basis at both ends, (dof1d x 2).
+   Vector end_dshape;
+   Array<int> gather_offsets; // offsets of the line entries of each L-dof
+   Array<int> gather_indices; // line entries of each L-dof
+
+public:
+   /** @brief Constructs an L2NormalDerivativeFaceRestriction for the faces of
+       type @a type of the L2 space @a fes. */
+   L2NormalDerivativeFaceRestriction(const FiniteElementSpace &fes,
+                                     const FaceType type);
+
+   /** @brief Compute the outward reference normal derivatives of the
+       L-vector @a x at the face dofs, see the class description. */
+   void Mult(const Vector &x, Vector &y) const override;
+
+   using FaceRestriction::AddMultTranspose;
+
+   /** @brief Add @a a times the transpose of Mult() applied to the face
+       E-vector @a x to the L-vector @a y. */
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const double a = 1.0) const override;
+};
+
 
 /** @brief Convert a dof face index from Native ordering to lexicographic
     ordering for quads and hexes.
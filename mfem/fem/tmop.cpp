@@ -13,6 +13,7 @@
 #include "linearform.hpp"
 #include "pgridfunc.hpp"
 #include "tmop_tools.hpp"
+#include "quadinterpolator.hpp"
 #include "../general/forall.hpp"
 
 namespace mfem
@@ -4315,15 +4316,50 @@ void TMOP_Integrator::ComputeMinJac(const Vector &x,
    const int NE = fes.GetMesh()->GetNE(), dim = fe->GetDim(),
              dof = fe->GetDof(), nsp = ir.GetNPoints();
 
+   dx = std::numeric_limits<float>::max();
+
+   double detv_sum;
+   double detv_avg_min = std::numeric_limits<float>::max();
+
+   const bool batched = fes.GetMesh()->GetNumGeometries(dim) == 1 &&
+                        !fes.IsVariableOrder() && !fes.GetNURBSext();
+   if (batched)
+   {
+      // Compute the determinants at all points with a single batched call.
+      const ElementDofOrdering ordering = UsesTensorBasis(fes) ?
+                                          ElementDofOrdering::LEXICOGRAPHIC :
+                                          ElementDofOrdering::NATIVE;
+      const Operator *R = fes.GetElementRestriction(ordering);
+      Vector xe(R->Height(), Device::GetDeviceMemoryType());
+      xe.UseDevice(true);
+      R->Mult(x, xe);
+
+      const QuadratureInterpolator *qi = fes.GetQuadratureInterpolator(ir);
+      qi->SetOutputLayout(QVectorLayout::byNODES);
+      Vector detJ(NE*nsp, Device::GetDeviceMemoryType());
+      detJ.UseDevice(true);
+      qi->Determinants(xe, detJ);
+
+      Vector detv_avg(NE, Device::GetDeviceMemoryType());
+      detv_avg.UseDevice(true);
+      const auto D = Reshape(detJ.Read(), nsp, NE);
+      auto A = detv_avg.Write();
+      mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+      {
+         double sum = 0.0;
+         for (int q = 0; q < nsp; q++) { sum += fabs(D(q,e)); }
+         A[e] = pow(sum/nsp, 1./dim);
+      });
+      detv_avg_min = std::min(detv_avg_min, detv_avg.Min());
+      dx = detv_avg_min / dxscale;
+      return;
+   }
+
    Array<int> xdofs(dof * dim);
    DenseMatrix dshape(dof, dim), pos(dof, dim);
    Vector posV(pos.Data(), dof * dim);
    Jpr.SetSize(dim);
 
-   dx = std::numeric_limits<float>::max();
-
-   double detv_sum;
-   double detv_avg_min = std::numeric_limits<float>::max();
    for (int i = 0; i < NE; i++)
    {
       fes.GetElementVDofs(i, xdofs);
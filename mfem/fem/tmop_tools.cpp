@@ -12,6 +12,7 @@
 #include "tmop_tools.hpp"
 #include "nonlinearform.hpp"
 #include "pnonlinearform.hpp"
+#include "quadinterpolator.hpp"
 #include "../general/osockstream.hpp"
 
 namespace mfem
@@ -831,7 +832,8 @@ double TMOPNewtonSolver::ComputeMinDet(const Vector &x_loc,
    Array<int> xdofs;
    DenseMatrix Jpr(dim);
    const bool mixed_mesh = fes.GetMesh()->GetNumGeometries(dim) > 1;
-   if (dim == 1 || mixed_mesh || UsesTensorBasis(fes) == false)
+   // NURBS elements need per-element shape data, so they are not batched.
+   if (mixed_mesh || fes.IsVariableOrder() || fes.GetNURBSext())
    {
       for (int i = 0; i < NE; i++)
       {
@@ -852,11 +854,15 @@ double TMOPNewtonSolver::ComputeMinDet(const Vector &x_loc,
          }
       }
    }
-   else
+   else if (dim > 1 && UsesTensorBasis(fes))
    {
       min_detJ = dim == 2 ? MinDetJpr_2D(&fes, x_loc) :
                  dim == 3 ? MinDetJpr_3D(&fes, x_loc) : 0.0;
    }
+   else
+   {
+      min_detJ = MinDetJpr(&fes, x_loc);
+   }
    double min_detT_all = min_detJ;
 #ifdef MFEM_USE_MPI
    if (parallel)
@@ -873,6 +879,27 @@ double TMOPNewtonSolver::ComputeMinDet(const Vector &x_loc,
    return min_detT_all;
 }
 
+double TMOPNewtonSolver::MinDetJpr(const FiniteElementSpace *fes,
+                                   const Vector &X) const
+{
+   const ElementDofOrdering ordering = UsesTensorBasis(*fes) ?
+                                       ElementDofOrdering::LEXICOGRAPHIC :
+                                       ElementDofOrdering::NATIVE;
+   const Operator *R = fes->GetElementRestriction(ordering);
+   Vector XE(R->Height(), Device::GetDeviceMemoryType());
+   XE.UseDevice(true);
+   R->Mult(X, XE);
+
+   const IntegrationRule &irule = GetIntegrationRule(*fes->GetFE(0));
+   const QuadratureInterpolator *qi = fes->GetQuadratureInterpolator(irule);
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+
+   Vector E(fes->GetNE() * irule.GetNPoints(), Device::GetDeviceMemoryType());
+   E.UseDevice(true);
+   qi->Determinants(XE, E);
+   return E.Min();
+}
+
 #ifdef MFEM_USE_MPI
 // Metric values are visualized by creating an L2 finite element functions and
 // computing the metric values at the nodes.
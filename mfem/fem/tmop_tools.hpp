@@ -175,6 +175,9 @@ protected:
 
    double MinDetJpr_2D(const FiniteElementSpace*, const Vector&) const;
    double MinDetJpr_3D(const FiniteElementSpace*, const Vector&) const;
+   /// Batched version for any single-geometry mesh, based on
+   /// QuadratureInterpolator::Determinants.
+   double MinDetJpr(const FiniteElementSpace*, const Vector&) const;
 
    /** @name Methods for adaptive surface fitting weight. */
    ///@{
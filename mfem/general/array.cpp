@@ -178,6 +178,7 @@ void Array2D<T>::Print(std::ostream &os, int width_)
 template class Array<char>;
 template class Array<int>;
 template class Array<long long>;
+template class Array<float>;
 template class Array<double>;
 template class Array2D<int>;
 template class Array2D<double>;
@@ -244,6 +244,16 @@ public:
    /// @brief Remove all items.
    void DeleteAll();
 
+   /** @brief Enlarge the table of bins so that @a num_items items can be
+       stored without triggering a rehash.
+
+       This is useful before inserting a large batch of items whose number is
+       (approximately) known in advance: the table is resized at most once,
+       instead of being rehashed every time the number of items doubles.
+
+       @param[in] num_items The expected total number of items. */
+   void Reserve(int num_items);
+
    /** @brief Allocate an item at 'id'. Enlarge the underlying BlockArray if
        necessary.
 
@@ -443,6 +453,11 @@ protected:
        the amortized complexity of inserting an item is still O(1). */
    void DoRehash();
 
+   /** @brief Resize the table to @a new_table_size bins and reinsert all items.
+
+       @param[in] new_table_size The new number of bins, a power of two. */
+   void Rehash(int new_table_size);
+
    /** @brief Return the size of the bin "idx".
 
        @param[in] idx The index of the bin.
@@ -746,13 +761,29 @@ inline void HashTable<T>::CheckRehash()
    }
 }
 
+template<typename T>
+void HashTable<T>::Reserve(int num_items)
+{
+   const int fill_factor = 2;
+
+   int new_table_size = mask+1;
+   while (num_items > new_table_size * fill_factor) { new_table_size *= 2; }
+
+   if (new_table_size > mask+1) { Rehash(new_table_size); }
+}
+
 template<typename T>
 void HashTable<T>::DoRehash()
+{
+   // double the table size
+   Rehash(2*(mask+1));
+}
+
+template<typename T>
+void HashTable<T>::Rehash(int new_table_size)
 {
    delete [] table;
 
-   // double the table size
-   int new_table_size = 2*(mask+1);
    table = new int[new_table_size];
    for (int i = 0; i < new_table_size; i++) { table[i] = -1; }
    mask = new_table_size-1;
@@ -0,0 +1,77 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_KERNEL_DISPATCH_HPP
+#define MFEM_KERNEL_DISPATCH_HPP
+
+#include "../config/config.hpp"
+#include <unordered_map>
+
+namespace mfem
+{
+
+/** @brief Table of compile-time specialized kernels, indexed by the number of
+    1D degrees of freedom and 1D quadrature points.
+
+    Sizes without a registered specialization are dispatched to a generic
+    fallback kernel. All kernels in a table share the same signature, where the
+    trailing two arguments are the runtime number of 1D dofs and quadrature
+    points (ignored by the specialized kernels).
+
+    Besides the built-in specializations, additional (D1D,Q1D) pairs can be
+    requested at build time through the MFEM_PA_KERNELS configuration option.
+    It defines the macro MFEM_PA_KERNELS in config.hpp as a sequence of
+    MFEM_PA_KERNEL(D1D,Q1D) entries, which the owners of the tables expand to
+    register the extra instantiations. */
+template <typename Kernel>
+class KernelDispatchTable
+{
+private:
+   std::unordered_map<int, Kernel> table;
+   Kernel fallback;
+
+   static int Key(int D1D, int Q1D) { return (D1D << 16) | Q1D; }
+
+public:
+   /// Create a table using @a fallback_ for non-specialized sizes.
+   explicit KernelDispatchTable(Kernel fallback_) : fallback(fallback_) { }
+
+   /// Register (or replace) the kernel used for the given sizes.
+   void Add(int D1D, int Q1D, Kernel kernel) { table[Key(D1D, Q1D)] = kernel; }
+
+   /// Remove the kernel registered for the given sizes, if any.
+   void Remove(int D1D, int Q1D) { table.erase(Key(D1D, Q1D)); }
+
+   /// Return true if a specialized kernel is registered for the given sizes.
+   bool Has(int D1D, int Q1D) const
+   { return table.find(Key(D1D, Q1D)) != table.end(); }
+
+   /// Return the kernel for the given sizes, or the fallback kernel.
+   Kernel Get(int D1D, int Q1D) const
+   {
+      const auto it = table.find(Key(D1D, Q1D));
+      return it == table.end() ? fallback : it->second;
+   }
+
+   /// Number of registered specializations.
+   int Size() const { return (int) table.size(); }
+};
+
+/** @brief Default number of elements processed together (per thread block) by
+    the specialized 2D kernels with @a Q1D quadrature points per direction. */
+constexpr int KernelNBZ2D(int Q1D)
+{
+   return Q1D <= 3 ? 16 : (Q1D <= 5 ? 8 : (Q1D <= 7 ? 4 : 2));
+}
+
+} // namespace mfem
+
+#endif // MFEM_KERNEL_DISPATCH_HPP
@@ -4392,4 +4392,82 @@ void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, Vector &X)
 
 }
 
+template <int DIM>
+static void BatchDet(const int n, const Vector &A, Vector &det)
+{
+   const int NB = A.Size() / (n*DIM*DIM);
+   det.SetSize(n*NB);
+   const auto a = Reshape(A.Read(), n, DIM*DIM, NB);
+   auto d = Reshape(det.Write(), n, NB);
+   if (Device::Allows(Backend::DEVICE_MASK))
+   {
+      mfem::forall(n*NB, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int k = idx % n, b = idx / n;
+         double m[DIM*DIM];
+         for (int i = 0; i < DIM*DIM; i++) { m[i] = a(k,i,b); }
+         d(k,b) = kernels::Det<DIM>(m);
+      });
+      return;
+   }
+   mfem::forall(NB, [=] MFEM_HOST_DEVICE (int b)
+   {
+      kernels::BatchDet<DIM>(n, &a(0,0,b), &d(0,b));
+   });
+}
+
+void BatchDet(const int dim, const int n, const Vector &A, Vector &det)
+{
+   switch (dim)
+   {
+      case 2: return BatchDet<2>(n, A, det);
+      case 3: return BatchDet<3>(n, A, det);
+   }
+   MFEM_ABORT("Unsupported dimension " << dim);
+}
+
+template <int DIM>
+static void BatchInverse(const int n, const Vector &A, Vector &Ainv)
+{
+   const int NB = A.Size() / (n*DIM*DIM);
+   Ainv.SetSize(A.Size());
+   const auto a = Reshape(A.Read(), n, DIM*DIM, NB);
+   auto ai = Reshape(Ainv.Write(), n, DIM*DIM, NB);
+   if (Device::Allows(Backend::DEVICE_MASK))
+   {
+      mfem::forall(n*NB, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int k = idx % n, b = idx / n;
+         double m[DIM*DIM], mi[DIM*DIM];
+         for (int i = 0; i < DIM*DIM; i++) { m[i] = a(k,i,b); }
+         kernels::CalcInverse<DIM>(m, mi);
+         for (int i = 0; i < DIM*DIM; i++) { ai(k,i,b) = mi[i]; }
+      });
+      return;
+   }
+   mfem::forall(NB, [=] MFEM_HOST_DEVICE (int b)
+   {
+      kernels::BatchCalcInverse<DIM>(n, &a(0,0,b), &ai(0,0,b));
+   });
+}
+
+void BatchInverse(const int dim, const int n, const Vector &A, Vector &Ainv)
+{
+   switch (dim)
+   {
+      case 2: return BatchInverse<2>(n, A, Ainv);
+      case 3: return BatchInverse<3>(n, A, Ainv);
+   }
+   MFEM_VERIFY(dim > 0, "Unsupported dimension " << dim);
+   const int NB = A.Size() / (n*dim*dim);
+   Vector LU(A);
+   Ainv.SetSize(A.Size());
+   auto lu = Reshape(LU.ReadWrite(), n, dim*dim, NB);
+   auto ai = Reshape(Ainv.Write(), n, dim*dim, NB);
+   mfem::forall(NB, [=] MFEM_HOST_DEVICE (int b)
+   {
+      kernels::BatchCalcInverse(n, dim, &lu(0,0,b), &ai(0,0,b));
+   });
+}
+
 } // namespace mfem
@@ -1282,6 +1282,29 @@ void BatchLUFactor(DenseTensor &Mlu, Array<int> &P, const double TOL = 0.0);
     dimension m x n. */
 void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, Vector &X);
 
+/** @brief Compute the determinants of batches of interleaved small matrices.
+
+    The vector @a A holds NB batches of @a n matrices of size dim x dim, with
+    dim = 2 or 3. Within a batch the matrices are interleaved as described in
+    kernels::BatchDet(), e.g. the Jacobians at the quadrature points of each
+    element in GeometricFactors::J. The batches are processed in parallel. On
+    the host, the matrices of a batch are processed in SIMD fashion; on the
+    device, there is one thread per matrix.
+
+    @param [in] dim size of the matrices.
+    @param [in] n number of matrices per batch.
+    @param [in] A batches of matrices - dimension n x dim x dim x NB.
+    @param [out] det determinants - dimension n x NB. */
+void BatchDet(const int dim, const int n, const Vector &A, Vector &det);
+
+/** @brief Compute the inverses of batches of interleaved small matrices, see
+    BatchDet(). The vectors @a A and @a Ainv have dimension n x dim x dim x NB,
+    with NB = A.Size()/(n*dim*dim).
+
+    Any size dim is supported: sizes other than 2 and 3, e.g. the element
+    matrices of low order elements, use Gauss-Jordan elimination with partial
+    pivoting, with one thread per batch. */
+void BatchInverse(const int dim, const int n, const Vector &A, Vector &Ainv);
 
 // Inline methods
 
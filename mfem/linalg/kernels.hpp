@@ -1660,6 +1660,115 @@ inline void LUSolve(const double *data, const int m, const int *ipiv,
    }
 }
 
+// Batched versions of the kernels above, for n small matrices stored
+// interleaved: entry (i,j) of matrix k is at index k + n*(i + height*j). This
+// is the layout of GeometricFactors::J (and of QuadratureInterpolator
+// derivatives with QVectorLayout::byNODES) for the quadrature points of one
+// element. The loops over the matrices are innermost, with unit stride, so
+// that the compiler can vectorize them: each SIMD lane processes one matrix.
+
+/// Compute the determinants of @a n interleaved matrices of size dim.
+template<int dim, typename T>
+MFEM_HOST_DEVICE inline void BatchDet(const int n, const T *data, T *det)
+{
+   for (int k = 0; k < n; k++)
+   {
+      T a[dim*dim];
+      for (int i = 0; i < dim*dim; i++) { a[i] = data[k + n*i]; }
+      det[k] = Det<dim>(a);
+   }
+}
+
+/// Compute the inverses of @a n interleaved matrices of size dim.
+template<int dim, typename T>
+MFEM_HOST_DEVICE inline
+void BatchCalcInverse(const int n, const T *data, T *inv_data)
+{
+   for (int k = 0; k < n; k++)
+   {
+      T a[dim*dim], inv[dim*dim];
+      for (int i = 0; i < dim*dim; i++) { a[i] = data[k + n*i]; }
+      CalcInverse<dim>(a, inv);
+      for (int i = 0; i < dim*dim; i++) { inv_data[k + n*i] = inv[i]; }
+   }
+}
+
+/** @brief Compute the inverses of @a n interleaved matrices of size m x m, for
+    the sizes not covered by the fixed-size version above, e.g. the 27 x 27
+    element matrices of Q2 hexahedra.
+
+    Gauss-Jordan elimination with partial pivoting: the pivot search and the
+    row swaps are done matrix by matrix, the elimination is vectorized across
+    the matrices. The matrices in @a data are overwritten. */
+template<typename T>
+MFEM_HOST_DEVICE inline
+void BatchCalcInverse(const int n, const int m, T *data, T *inv_data)
+{
+   // Entry (i,c) of all the matrices: A(i,c)[k] for matrix k
+   auto A = [=](int i, int c) { return data + n*(i + m*c); };
+   auto B = [=](int i, int c) { return inv_data + n*(i + m*c); };
+   for (int c = 0; c < m; c++)
+   {
+      for (int i = 0; i < m; i++)
+      {
+         T *b = B(i,c);
+         for (int k = 0; k < n; k++) { b[k] = (i == c) ? 1.0 : 0.0; }
+      }
+   }
+   for (int j = 0; j < m; j++)
+   {
+      for (int k = 0; k < n; k++)
+      {
+         int p = j;
+         T a_max = fabs(A(j,j)[k]);
+         for (int i = j + 1; i < m; i++)
+         {
+            const T a = fabs(A(i,j)[k]);
+            if (a > a_max) { a_max = a; p = i; }
+         }
+         MFEM_ASSERT(a_max > 0.0, "singular matrix");
+         if (p == j) { continue; }
+         for (int c = 0; c < m; c++)
+         {
+            if (c >= j) { internal::Swap(A(j,c)[k], A(p,c)[k]); }
+            internal::Swap(B(j,c)[k], B(p,c)[k]);
+         }
+      }
+      // Scale row j, the pivot itself last
+      const T *a_jj = A(j,j);
+      for (int c = j + 1; c < m; c++)
+      {
+         T *a_jc = A(j,c);
+         for (int k = 0; k < n; k++) { a_jc[k] /= a_jj[k]; }
+      }
+      for (int c = 0; c < m; c++)
+      {
+         T *b_jc = B(j,c);
+         for (int k = 0; k < n; k++) { b_jc[k] /= a_jj[k]; }
+      }
+      for (int k = 0; k < n; k++) { A(j,j)[k] = 1.0; }
+      // Eliminate column j from the other rows, the column itself last
+      for (int i = 0; i < m; i++)
+      {
+         if (i == j) { continue; }
+         const T *a_ij = A(i,j);
+         for (int c = j + 1; c < m; c++)
+         {
+            T *a_ic = A(i,c);
+            const T *a_jc = A(j,c);
+            for (int k = 0; k < n; k++) { a_ic[k] -= a_ij[k]*a_jc[k]; }
+         }
+         for (int c = 0; c < m; c++)
+         {
+            T *b_ic = B(i,c);
+            const T *b_jc = B(j,c);
+            for (int k = 0; k < n; k++) { b_ic[k] -= a_ij[k]*b_jc[k]; }
+         }
+         for (int k = 0; k < n; k++) { A(i,j)[k] = 0.0; }
+      }
+   }
+}
+
 } // namespace kernels
 
 } // namespace mfem
@@ -40,7 +40,7 @@ protected:
 
    /** @brief Returns RAP Operator of this, using input/output Prolongation matrices
        @a Pi corresponds to "P", @a Po corresponds to "Rt" */
-   Operator *SetupRAP(const Operator *Pi, const Operator *Po);
+   virtual Operator *SetupRAP(const Operator *Pi, const Operator *Po);
 
 public:
    /// Defines operator diagonal policy upon elimination of rows and/or columns.
@@ -898,6 +898,9 @@ public:
    void SetDiagonalPolicy(const DiagonalPolicy diag_policy_)
    { diag_policy = diag_policy_; }
 
+   /// Return the unconstrained Operator.
+   const Operator &GetUnconstrainedOperator() const { return *A; }
+
    /// Diagonal of A, modified according to the used DiagonalPolicy.
    virtual void AssembleDiagonal(Vector &diag) const;
 
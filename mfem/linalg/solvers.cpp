@@ -14,6 +14,9 @@
 #include "../general/forall.hpp"
 #include "../general/globals.hpp"
 #include "../fem/bilinearform.hpp"
+#ifdef MFEM_USE_MPI
+#include "../fem/pfespace.hpp"
+#endif
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -328,6 +331,155 @@ void OperatorJacobiSmoother::Mult(const Vector &x, Vector &y) const
    });
 }
 
+// Apply the element restriction (or its transpose), without the dof signs
+// of ElementRestriction.
+static void RestrictUnsigned(const Operator &R, const Vector &x, Vector &y,
+                             bool transpose)
+{
+   const ElementRestriction *er = dynamic_cast<const ElementRestriction*>(&R);
+   if (er && transpose) { er->MultTransposeUnsigned(x, y); }
+   else if (er) { er->MultUnsigned(x, y); }
+   else if (transpose) { R.MultTranspose(x, y); }
+   else { R.Mult(x, y); }
+}
+
+EABlockJacobiSmoother::EABlockJacobiSmoother(const BilinearForm &a,
+                                             const Array<int> &ess_tdofs,
+                                             const double dmpng)
+   :
+   Solver(a.FESpace()->GetTrueVSize()),
+   prolong(a.FESpace()->GetProlongationMatrix()),
+   ess_tdof_list(ess_tdofs),
+   damping(dmpng),
+   oper(nullptr),
+   residual(height)
+{
+   const EABilinearFormExtension *ext =
+      dynamic_cast<const EABilinearFormExtension*>(a.GetExtension());
+   MFEM_VERIFY(ext && a.GetAssemblyLevel() == AssemblyLevel::ELEMENT,
+               "EABlockJacobiSmoother requires element assembly");
+#ifdef MFEM_USE_MPI
+   // The multiplicities and the assembled diagonal below are computed from
+   // the local elements only, which is wrong for dofs shared between ranks.
+   MFEM_VERIFY(!dynamic_cast<const ParFiniteElementSpace*>(a.FESpace()),
+               "EABlockJacobiSmoother does not support parallel spaces");
+#endif
+   elem_restr = ext->GetElementRestriction();
+   MFEM_VERIFY(elem_restr, "the element restriction is not available");
+
+   ext->GetElementMatrices(blocks);
+   const int ND = blocks.SizeI();
+   const int NE = blocks.SizeK();
+   const MemoryType mt = Device::GetMemoryType();
+   residual.UseDevice(true);
+   lvec.SetSize(elem_restr->Width(), mt);
+   lvec.UseDevice(true);
+   evec.SetSize(ND*NE, mt);
+   evec.UseDevice(true);
+   weights.SetSize(ND*NE, mt);
+   weights.UseDevice(true);
+   if (prolong) { zvec.SetSize(height, mt); zvec.UseDevice(true); }
+
+   // Multiplicity of the dofs
+   evec = 1.0;
+   RestrictUnsigned(*elem_restr, evec, lvec, true);
+   RestrictUnsigned(*elem_restr, lvec, weights, false);
+
+   // Assembled diagonal
+   Vector diag(ND*NE, mt);
+   diag.UseDevice(true);
+   {
+      const auto B = Reshape(blocks.Read(), ND, ND, NE);
+      auto D = Reshape(evec.Write(), ND, NE);
+      mfem::forall(ND*NE, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int i = idx % ND, e = idx / ND;
+         D(i, e) = B(i, i, e);
+      });
+   }
+   RestrictUnsigned(*elem_restr, evec, lvec, true);
+   RestrictUnsigned(*elem_restr, lvec, diag, false);
+
+   // Marker of the essential dofs
+   evec = 0.0;
+   if (ess_tdof_list.Size() > 0)
+   {
+      residual = 0.0;
+      residual.SetSubVector(ess_tdof_list, 1.0);
+      if (prolong) { prolong->Mult(residual, lvec); }
+      RestrictUnsigned(*elem_restr, prolong ? lvec : residual, evec, false);
+   }
+
+   // Replace the diagonal of the blocks, decouple the essential dofs
+   auto B = Reshape(blocks.ReadWrite(), ND, ND, NE);
+   const auto D = Reshape(diag.Read(), ND, NE);
+   const auto M = Reshape(evec.Read(), ND, NE);
+   auto W = Reshape(weights.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int i = 0; i < ND; i++)
+      {
+         W(i, e) = 1.0 / sqrt(W(i, e));
+         if (M(i, e) != 0.0)
+         {
+            for (int j = 0; j < ND; j++) { B(i, j, e) = B(j, i, e) = 0.0; }
+            B(i, i, e) = 1.0;
+         }
+         else
+         {
+            B(i, i, e) = D(i, e);
+         }
+      }
+   });
+   BatchLUFactor(blocks, piv);
+}
+
+void EABlockJacobiSmoother::Mult(const Vector &x, Vector &y) const
+{
+   MFEM_ASSERT(x.Size() == Width(), "invalid input vector");
+   MFEM_ASSERT(y.Size() == Height(), "invalid output vector");
+
+   if (iterative_mode)
+   {
+      MFEM_VERIFY(oper, "iterative_mode == true requires the forward operator");
+      oper->Mult(y, residual);  // r = A y
+      subtract(x, residual, residual); // r = x - A y
+   }
+   else
+   {
+      residual = x;
+      y.UseDevice(true);
+      y = 0.0;
+   }
+
+   // z = sum_e R_e^T W_e B_e^{-1} W_e R_e r
+   if (prolong) { prolong->Mult(residual, lvec); }
+   elem_restr->Mult(prolong ? lvec : residual, evec);
+   evec *= weights;
+   BatchLUSolve(blocks, piv, evec);
+   evec *= weights;
+   elem_restr->MultTranspose(evec, lvec);
+   if (prolong) { prolong->MultTranspose(lvec, zvec); }
+   Vector &z = prolong ? zvec : lvec;
+
+   const double delta = damping;
+   auto R = residual.Read();
+   auto Z = z.ReadWrite();
+   if (ess_tdof_list.Size() > 0)
+   {
+      auto I = ess_tdof_list.Read();
+      mfem::forall(ess_tdof_list.Size(), [=] MFEM_HOST_DEVICE (int i)
+      {
+         Z[I[i]] = R[I[i]];
+      });
+   }
+   auto Y = y.ReadWrite();
+   mfem::forall(height, [=] MFEM_HOST_DEVICE (int i)
+   {
+      Y[i] += delta * Z[i];
+   });
+}
+
 OperatorChebyshevSmoother::OperatorChebyshevSmoother(const Operator &oper_,
                                                      const Vector &d,
                                                      const Array<int>& ess_tdofs,
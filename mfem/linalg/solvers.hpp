@@ -372,6 +372,53 @@ public:
    void Setup(const Vector &diag);
 };
 
+/// Element block-Jacobi smoother built from the element matrices of a form
+/** The form must use AssemblyLevel::ELEMENT. Each element matrix A_e is turned
+    into the block B_e, obtained by replacing the diagonal of A_e with the
+    diagonal of the assembled operator, i.e. the sum of the diagonals of the
+    elements sharing each dof. The blocks are LU factorized once, in batch, and
+    the smoother is the additive Schwarz operator
+
+        y = sum_e R_e^T W_e B_e^{-1} W_e R_e x,
+
+    where R_e is the element restriction and W_e scales each dof by one over
+    the square root of its multiplicity, so that the operator is symmetric and
+    reduces to Jacobi for diagonal element matrices. For DG spaces this is the
+    exact block-Jacobi method, including the face terms when they are
+    factorized in the element matrices (conforming meshes).
+
+    The smoother acts on true-dof vectors and, as OperatorJacobiSmoother, as
+    the identity on the essential true dofs. Only serial spaces are supported:
+    the multiplicities and the assembled diagonal are not reduced across MPI
+    ranks. */
+class EABlockJacobiSmoother : public Solver
+{
+public:
+   /// Setup the smoother from the (assembled) form @a a.
+   EABlockJacobiSmoother(const BilinearForm &a,
+                         const Array<int> &ess_tdof_list,
+                         const double damping=1.0);
+
+   void Mult(const Vector &x, Vector &y) const;
+   void MultTranspose(const Vector &x, Vector &y) const { Mult(x, y); }
+
+   /// Set the forward operator, used only when #iterative_mode is true.
+   void SetOperator(const Operator &op) { oper = &op; }
+
+private:
+   const Operator *elem_restr; // not owned
+   const Operator *prolong; // not owned; may be NULL
+   const Array<int> &ess_tdof_list; // not owned
+   const double damping;
+   const Operator *oper; // not owned
+   /// LU factors of the element blocks and pivots.
+   DenseTensor blocks;
+   Array<int> piv;
+   /// Scaling of the E-vector entries.
+   Vector weights;
+   mutable Vector residual, lvec, evec, zvec;
+};
+
 /// Chebyshev accelerated smoothing with given vector, no matrix necessary
 /** Potentially useful with tensorized operators, for example. This is just a
     very basic Chebyshev iteration, if you want tolerances, iteration control,
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <limits>
 #include <cstring>
+#include <vector>
 
 #if defined(MFEM_USE_CUDA)
 #define MFEM_cu_or_hip(stub) cu##stub
@@ -3946,6 +3947,173 @@ SparseMatrix *Mult_AtDA (const SparseMatrix &A, const Vector &D,
    return AtDA;
 }
 
+// Symbolic phase of the row-wise (Gustavson) product C = A B: returns a matrix
+// with the pattern of A B and uninitialized values. The columns of each row
+// are stored in the order in which they are first reached.
+static SparseMatrix *SparseMultSymbolic(const SparseMatrix &A,
+                                        const SparseMatrix &B)
+{
+   const int nrows = A.Height();
+   const int ncols = B.Width();
+   MFEM_VERIFY(A.Width() == B.Height(),
+               "number of columns of A (" << A.Width()
+               << ") must equal number of rows of B (" << B.Height() << ")");
+
+   const int *A_i = A.HostReadI(), *A_j = A.HostReadJ();
+   const int *B_i = B.HostReadI(), *B_j = B.HostReadJ();
+
+   int *C_i = Memory<int>(nrows+1);
+   C_i[0] = 0;
+
+   // count the entries of each row
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      std::vector<int> marker(ncols, -1);
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp for
+#endif
+      for (int ic = 0; ic < nrows; ic++)
+      {
+         int nnz = 0;
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         {
+            const int ja = A_j[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+            {
+               const int jb = B_j[ib];
+               if (marker[jb] != ic) { marker[jb] = ic; nnz++; }
+            }
+         }
+         C_i[ic+1] = nnz;
+      }
+   }
+   for (int ic = 0; ic < nrows; ic++) { C_i[ic+1] += C_i[ic]; }
+
+   int *C_j = Memory<int>(C_i[nrows]);
+   double *C_data = Memory<double>(C_i[nrows]);
+
+   // fill the column indices of each row
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      std::vector<int> marker(ncols, -1);
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp for
+#endif
+      for (int ic = 0; ic < nrows; ic++)
+      {
+         int pos = C_i[ic];
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         {
+            const int ja = A_j[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+            {
+               const int jb = B_j[ib];
+               if (marker[jb] != ic) { marker[jb] = ic; C_j[pos++] = jb; }
+            }
+         }
+      }
+   }
+
+   return new SparseMatrix(C_i, C_j, C_data, nrows, ncols);
+}
+
+// Numeric phase of the product C = A B, where C has the pattern computed by
+// SparseMultSymbolic() for the patterns of A and B.
+static void SparseMultNumeric(const SparseMatrix &A, const SparseMatrix &B,
+                              SparseMatrix &C)
+{
+   const int nrows = A.Height();
+   const int ncols = B.Width();
+
+   const int *A_i = A.HostReadI(), *A_j = A.HostReadJ();
+   const int *B_i = B.HostReadI(), *B_j = B.HostReadJ();
+   const double *A_data = A.HostReadData(), *B_data = B.HostReadData();
+   const int *C_i = C.HostReadI(), *C_j = C.HostReadJ();
+   double *C_data = C.HostWriteData();
+
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      // position of each column in the current row of C; all the columns
+      // reached in a row are part of its pattern, so no reset is needed
+      std::vector<int> position(ncols);
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp for
+#endif
+      for (int ic = 0; ic < nrows; ic++)
+      {
+         for (int k = C_i[ic]; k < C_i[ic+1]; k++)
+         {
+            position[C_j[k]] = k;
+            C_data[k] = 0.0;
+         }
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         {
+            const int ja = A_j[ia];
+            const double a_entry = A_data[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+            {
+               C_data[position[B_j[ib]]] += a_entry*B_data[ib];
+            }
+         }
+      }
+   }
+}
+
+SparseRAP::SparseRAP(const SparseMatrix &Rt_, const SparseMatrix &A,
+                     const SparseMatrix &P_)
+   : Rt(&Rt_), P(&P_)
+{
+   MFEM_VERIFY(A.Finalized() && Rt->Finalized() && P->Finalized(),
+               "all matrices must be finalized");
+   MFEM_VERIFY(Rt->Height() == A.Height() && A.Width() == P->Height(),
+               "incompatible matrix sizes");
+
+   R = Transpose(*Rt);
+   AP = SparseMultSymbolic(A, *P);
+   RtAP = SparseMultSymbolic(*R, *AP);
+
+   A_I.SetSize(A.Height()+1);
+   A_I.Assign(A.HostReadI());
+   A_J.SetSize(A.NumNonZeroElems());
+   A_J.Assign(A.HostReadJ());
+}
+
+bool SparseRAP::HasStructure(const SparseMatrix &Rt_, const SparseMatrix &A,
+                             const SparseMatrix &P_) const
+{
+   if (&Rt_ != Rt || &P_ != P || !A.Finalized() ||
+       A.Height() != A_I.Size()-1 || A.Width() != AP->Height() ||
+       A.NumNonZeroElems() != A_J.Size())
+   {
+      return false;
+   }
+   return std::equal(A_I.begin(), A_I.end(), A.HostReadI()) &&
+          std::equal(A_J.begin(), A_J.end(), A.HostReadJ());
+}
+
+SparseMatrix *SparseRAP::Mult(const SparseMatrix &A)
+{
+   MFEM_ASSERT(HasStructure(*Rt, A, *P), "the pattern of A has changed");
+
+   SparseMultNumeric(A, *P, *AP);
+   SparseMatrix *C = new SparseMatrix(*RtAP);
+   SparseMultNumeric(*R, *AP, *C);
+   return C;
+}
+
+SparseRAP::~SparseRAP()
+{
+   delete RtAP;
+   delete AP;
+   delete R;
+}
+
 SparseMatrix * Add(double a, const SparseMatrix & A, double b,
                    const SparseMatrix & B)
 {
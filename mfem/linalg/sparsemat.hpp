@@ -762,6 +762,40 @@ SparseMatrix *RAP(const SparseMatrix &Rt, const SparseMatrix &A,
 SparseMatrix *Mult_AtDA(const SparseMatrix &A, const Vector &D,
                         SparseMatrix *OAtDA = NULL);
 
+/** @brief Sparse triple product R A P, with R = Rt^T, split into a symbolic
+    phase, done once in the constructor, and a numeric phase, Mult().
+
+    The sparsity patterns of the intermediate product A P and of R A P are
+    computed once. Mult() can then be called repeatedly for matrices A that
+    have the sparsity pattern given to the constructor, e.g. when a form is
+    reassembled on the same space, and only computes values. Both phases are
+    threaded over the rows when MFEM_USE_LEGACY_OPENMP is enabled.
+
+    The matrices @a Rt and @a P are not copied and must stay valid while the
+    object is used. All matrices must be finalized. */
+class SparseRAP
+{
+protected:
+   const SparseMatrix *Rt, *P;
+   SparseMatrix *R;        ///< Transpose of Rt. Owned.
+   SparseMatrix *AP, *RtAP; ///< Patterns of A P and of R A P. Owned.
+   Array<int> A_I, A_J;    ///< Copy of the pattern of A.
+
+public:
+   SparseRAP(const SparseMatrix &Rt, const SparseMatrix &A,
+             const SparseMatrix &P);
+
+   /** @brief Return true if @a A has the pattern given to the constructor and
+       @a Rt and @a P are the matrices given to the constructor. */
+   bool HasStructure(const SparseMatrix &Rt, const SparseMatrix &A,
+                     const SparseMatrix &P) const;
+
+   /// Return a new matrix equal to R A P, reusing the symbolic phase.
+   SparseMatrix *Mult(const SparseMatrix &A);
+
+   ~SparseRAP();
+};
+
 
 /// Matrix addition result = A + B.
 SparseMatrix * Add(const SparseMatrix & A, const SparseMatrix & B);
@@ -1490,6 +1490,7 @@ void Mesh::DestroyTables()
    delete el_to_face;
    delete el_to_el;
    DeleteGeometricFactors();
+   DeleteElementCenterTree();
 
    if (Dim == 3)
    {
@@ -8226,6 +8227,7 @@ void Mesh::MoveVertices(const Vector &displacements)
       {
          vertices[i](j) += displacements(j*nv+i);
       }
+   DeleteElementCenterTree();
 }
 
 void Mesh::GetVertices(Vector &vert_coord) const
@@ -8246,6 +8248,7 @@ void Mesh::SetVertices(const Vector &vert_coord)
       {
          vertices[i](j) = vert_coord(j*nv+i);
       }
+   DeleteElementCenterTree();
 }
 
 void Mesh::GetNode(int i, double *coord) const
@@ -8292,6 +8295,7 @@ void Mesh::MoveNodes(const Vector &displacements)
    if (Nodes)
    {
       (*Nodes) += displacements;
+      DeleteElementCenterTree();
    }
    else
    {
@@ -9731,6 +9735,8 @@ void Mesh::Swap(Mesh& other, bool non_geometry)
    mfem::Swap(bdr_attributes, other.bdr_attributes);
 
    mfem::Swap(geom_factors, other.geom_factors);
+   mfem::Swap(elem_center_tree, other.elem_center_tree);
+   mfem::Swap(elem_center_tree_sequence, other.elem_center_tree_sequence);
 
 #ifdef MFEM_USE_MEMALLOC
    TetMemory.Swap(other.TetMemory);
@@ -12313,6 +12319,48 @@ std::ostream &operator<<(std::ostream &os, const Mesh &mesh)
    return os;
 }
 
+KDTree3D &Mesh::GetElementCenterTree()
+{
+   if (elem_center_tree && elem_center_tree_sequence == sequence &&
+       elem_center_tree->size() == (size_t) GetNE())
+   {
+      return *elem_center_tree;
+   }
+   DeleteElementCenterTree();
+
+   // Compute the element centers, the unused coordinates are set to zero.
+   const int NE = GetNE();
+   DenseMatrix centers(3, NE);
+   centers = 0.0;
+   IsoparametricTransformation eltrans;
+   Vector center;
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for private(eltrans, center)
+#endif
+   for (int i = 0; i < NE; i++)
+   {
+      GetElementTransformation(i, &eltrans);
+      center.SetDataAndSize(centers.GetColumn(i), spaceDim);
+      eltrans.Transform(Geometries.GetCenter(GetElementBaseGeometry(i)),
+                        center);
+   }
+
+   elem_center_tree = new KDTree3D;
+   for (int i = 0; i < NE; i++)
+   {
+      elem_center_tree->AddPoint(centers.GetColumn(i), i);
+   }
+   elem_center_tree->Sort();
+   elem_center_tree_sequence = sequence;
+   return *elem_center_tree;
+}
+
+void Mesh::DeleteElementCenterTree()
+{
+   delete elem_center_tree;
+   elem_center_tree = nullptr;
+}
+
 int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
                      Array<IntegrationPoint>& ips, bool warn,
                      InverseElementTransformation *inv_trans)
@@ -12330,39 +12378,44 @@ int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
    inv_tr = inv_tr ? inv_tr : new InverseElementTransformation;
 
    // For each point in 'point_mat', find the element whose center is closest.
-   Vector min_dist(npts);
+   KDTree3D &tree = GetElementCenterTree();
    Array<int> e_idx(npts);
-   min_dist = std::numeric_limits<double>::max();
-   e_idx = -1;
-
-   Vector pt(spaceDim);
-   for (int i = 0; i < GetNE(); i++)
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int k = 0; k < npts; k++)
    {
-      GetElementTransformation(i)->Transform(
-         Geometries.GetCenter(GetElementBaseGeometry(i)), pt);
-      for (int k = 0; k < npts; k++)
-      {
-         double dist = pt.DistanceTo(data+k*spaceDim);
-         if (dist < min_dist(k))
-         {
-            min_dist(k) = dist;
-            e_idx[k] = i;
-         }
-      }
+      KDTree3D::PointND pt;
+      for (int d = 0; d < spaceDim; d++) { pt.xx[d] = data[k*spaceDim+d]; }
+      e_idx[k] = tree.FindClosestPoint(pt);
    }
 
-   // Checks if the points lie in the closest element
+   // Checks if the points lie in the closest element. Without a user-given
+   // inverse transformation, the points are processed independently.
    int pts_found = 0;
-   pt.NewDataAndSize(NULL, spaceDim);
-   for (int k = 0; k < npts; k++)
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel if (inv_trans == NULL) reduction(+:pts_found)
+#endif
    {
-      pt.SetData(data+k*spaceDim);
-      inv_tr->SetTransformation(*GetElementTransformation(e_idx[k]));
-      int res = inv_tr->Transform(pt, ips[k]);
-      if (res == InverseElementTransformation::Inside)
+      IsoparametricTransformation eltrans;
+      InverseElementTransformation local_inv_tr;
+      InverseElementTransformation *inv_tr_k =
+         inv_trans ? inv_trans : &local_inv_tr;
+      Vector pt;
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp for
+#endif
+      for (int k = 0; k < npts; k++)
       {
-         elem_ids[k] = e_idx[k];
-         pts_found++;
+         pt.SetDataAndSize(data+k*spaceDim, spaceDim);
+         GetElementTransformation(e_idx[k], &eltrans);
+         inv_tr_k->SetTransformation(eltrans);
+         int res = inv_tr_k->Transform(pt, ips[k]);
+         if (res == InverseElementTransformation::Inside)
+         {
+            elem_ids[k] = e_idx[k];
+            pts_found++;
+         }
       }
    }
    if (pts_found != npts)
@@ -12373,7 +12426,7 @@ int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
       {
          if (elem_ids[k] != -1) { continue; }
          // Try all vertex-neighbors of element e_idx[k]
-         pt.SetData(data+k*spaceDim);
+         Vector pt(data+k*spaceDim, spaceDim);
          GetElementVertices(e_idx[k], elvertices);
          for (int v = 0; v < elvertices.Size(); v++)
          {
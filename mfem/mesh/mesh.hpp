@@ -15,6 +15,7 @@
 #include "../config/config.hpp"
 #include "../general/stable3d.hpp"
 #include "../general/globals.hpp"
+#include "../general/kdtree.hpp"
 #include "triangle.hpp"
 #include "tetrahedron.hpp"
 #include "vertex.hpp"
@@ -279,7 +280,6 @@ public:
    Array<GeometricFactors*> geom_factors; ///< Optional geometric factors.
    Array<FaceGeometricFactors*> face_geom_factors; /**< Optional face geometric
                                                         factors. */
-
    // Global parameter that can be used to control the removal of unused
    // vertices performed when reading a mesh in MFEM format. The default value
    // (true) is set in mesh_readers.cpp.
@@ -288,6 +288,11 @@ public:
 protected:
    Operation last_operation;
 
+   /// Optional k-d tree of the element centers, see FindPoints().
+   KDTree3D *elem_center_tree = nullptr;
+   /// Mesh sequence number at which #elem_center_tree was built.
+   long elem_center_tree_sequence = -1;
+
    void Init();
    void InitTables();
    void SetEmpty();  // Init all data members with empty values
@@ -296,6 +301,8 @@ protected:
    void DestroyPointers(); // Delete data specifically allocated by class Mesh.
    void Destroy();         // Delete all owned data.
    void ResetLazyData();
+   /// Return the k-d tree of the element centers, building it if needed.
+   KDTree3D &GetElementCenterTree();
 
    Element *ReadElementWithoutAttr(std::istream &);
    static void PrintElementWithoutAttr(const Element *, std::ostream &);
@@ -1828,11 +1835,12 @@ public:
        have been updated externally, e.g. by modifying the internal nodal
        GridFunction returned by GetNodes(). */
    /** It deletes internal quantities derived from the node coordinates,
-       such as the (Face)GeometricFactors.
+       such as the (Face)GeometricFactors and the element center tree used by
+       FindPoints().
 
        @note Unlike the similarly named protected method UpdateNodes() this
        method does not modify the nodes. */
-   void NodesUpdated() { DeleteGeometricFactors(); }
+   void NodesUpdated() { DeleteGeometricFactors(); DeleteElementCenterTree(); }
 
    /// @}
 
@@ -2135,12 +2143,26 @@ public:
 
        @returns The total number of points that were found.
 
+       The candidate element for each point is the element with the closest
+       center, found with a k-d tree of the element centers that is built on
+       the first call and reused until the mesh is modified (see
+       NodesUpdated() and DeleteElementCenterTree()). When MFEM is built with
+       MFEM_USE_LEGACY_OPENMP and @a inv_trans is NULL, the points are
+       processed in parallel.
+
        @note This method is not 100 percent reliable, i.e. it is not guaranteed
        to find a point, even if it lies inside a mesh element. */
    virtual int FindPoints(DenseMatrix& point_mat, Array<int>& elem_ids,
                           Array<IntegrationPoint>& ips, bool warn = true,
                           InverseElementTransformation *inv_trans = NULL);
 
+   /** @brief Destroy the k-d tree of the element centers used by
+       FindPoints(), forcing it to be rebuilt on the next call.
+
+       The tree is destroyed automatically by NodesUpdated() and when the
+       elements of the mesh change, e.g. on refinement. */
+   void DeleteElementCenterTree();
+
    /** @brief Computes geometric parameters associated with a Jacobian matrix
        in 2D/3D. These parameters are
        (1) Area/Volume,
@@ -1627,6 +1627,22 @@ void NCMesh::Refine(const Array<Refinement>& refinements)
       ref_stack.Append(Refinement(leaf_elements[ref.index], ref.ref_type));
    }
 
+   // the whole batch is known in advance: size the node and face tables once
+   // instead of letting them rehash repeatedly while the refinement proceeds.
+   // Shared edges and faces are counted as half, which is exact for interior
+   // hexes; forced refinements are not anticipated. Note that only the table
+   // sizes are batched: the nodes and faces are still looked up and created
+   // one at a time by RefineElement.
+   int new_nodes = 0, new_faces = 0;
+   for (int i = 0; i < ref_stack.Size(); i++)
+   {
+      const GeomInfo &gi = GI[elements[ref_stack[i].index].Geom()];
+      new_nodes += 1 + gi.nf/2 + gi.ne/4;
+      new_faces += gi.ne + 2*gi.nf;
+   }
+   nodes.Reserve(nodes.Size() + new_nodes);
+   faces.Reserve(faces.Size() + new_faces);
+
    // keep refining as long as the stack contains something
    int nforced = 0;
    while (ref_stack.Size())
@@ -559,6 +559,11 @@ void CreateVTKElementConnectivity(Array<int> &con, Geometry::Type geom, int ref)
 void WriteVTKEncodedCompressed(std::ostream &os, const void *bytes,
                                uint32_t nbytes, int compression_level)
 {
+   if (VTKDeferredStream *ds = dynamic_cast<VTKDeferredStream*>(&os))
+   {
+      ds->AppendEncoded(bytes, nbytes, compression_level);
+      return;
+   }
    if (compression_level == 0)
    {
       // First write size of buffer (as uint32_t), encoded with base 64
@@ -654,9 +659,45 @@ void WriteBinaryOrASCII<float>(std::ostream &os, std::vector<char> &buf,
 void WriteBase64WithSizeAndClear(std::ostream &os, std::vector<char> &buf,
                                  int compression_level)
 {
-   WriteVTKEncodedCompressed(os, buf.data(), buf.size(), compression_level);
+   if (VTKDeferredStream *ds = dynamic_cast<VTKDeferredStream*>(&os))
+   {
+      ds->AppendEncoded(std::move(buf), compression_level);
+   }
+   else
+   {
+      WriteVTKEncodedCompressed(os, buf.data(), buf.size(), compression_level);
+   }
    os << '\n';
    buf.clear();
 }
 
+void VTKDeferredStream::AppendEncoded(const void *bytes, uint32_t nbytes,
+                                      int compression_level)
+{
+   const char *b = static_cast<const char *>(bytes);
+   AppendEncoded(std::vector<char>(b, b + nbytes), compression_level);
+}
+
+void VTKDeferredStream::AppendEncoded(std::vector<char> &&bytes,
+                                      int compression_level)
+{
+#ifndef MFEM_USE_ZLIB
+   MFEM_VERIFY(compression_level == 0, "MFEM must be compiled with ZLib "
+               "support to output compressed binary data.");
+#endif
+   blocks.push_back(Block{text.str(), std::move(bytes), compression_level});
+   text.str(std::string());
+}
+
+void VTKDeferredStream::WriteEncoded(std::ostream &os) const
+{
+   for (const Block &b : blocks)
+   {
+      os << b.prefix;
+      WriteVTKEncodedCompressed(os, b.bytes.data(), b.bytes.size(),
+                                b.compression_level);
+   }
+   os << text.str();
+}
+
 } // namespace mfem
@@ -13,6 +13,9 @@
 #define MFEM_VTK
 
 #include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "../fem/geom.hpp"
 #include "../general/binaryio.hpp"
@@ -120,9 +123,48 @@ void CreateVTKElementConnectivity(Array<int> &con, Geometry::Type geom,
 /// The binary data will be base 64 encoded, and compressed if @a
 /// compression_level is not zero. The proper header will be prepended to the
 /// data.
+///
+/// If @a os is a VTKDeferredStream, the data is stored and the encoding is
+/// deferred to VTKDeferredStream::WriteEncoded().
 void WriteVTKEncodedCompressed(std::ostream &os, const void *bytes,
                                uint32_t nbytes, int compression_level);
 
+/// @brief Output stream deferring the encoding of the VTK binary data arrays.
+///
+/// Text written to the stream is stored as is, while the binary data passed to
+/// WriteVTKEncodedCompressed() (or WriteBase64WithSizeAndClear()) is stored
+/// unencoded. The compression, base 64 encoding and output of the data can then
+/// be performed later with WriteEncoded(), e.g. on another thread: that call
+/// only accesses the data stored in this object.
+class VTKDeferredStream : public std::ostream
+{
+public:
+   VTKDeferredStream() : std::ostream(nullptr) { rdbuf(&text); }
+
+   /// Store the binary data @a bytes, to be encoded by WriteEncoded().
+   void AppendEncoded(const void *bytes, uint32_t nbytes,
+                      int compression_level);
+
+   /// Same as above, moving the data out of @a bytes.
+   void AppendEncoded(std::vector<char> &&bytes, int compression_level);
+
+   /// @brief Write the stored text and the stored binary data, encoded as in
+   /// WriteVTKEncodedCompressed(), to @a os.
+   void WriteEncoded(std::ostream &os) const;
+
+private:
+   /// Binary data array, preceded by the text written before it.
+   struct Block
+   {
+      std::string prefix;
+      std::vector<char> bytes;
+      int compression_level;
+   };
+
+   std::stringbuf text;
+   std::vector<Block> blocks;
+};
+
 /// @brief Return the VTK node index of the barycentric point @a b in a
 /// triangle with refinement level @a ref.
 ///
@@ -0,0 +1,105 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+/*
+  This benchmark measures the setup time of an H1 FiniteElementSpace on a 3D
+  hexahedral mesh with NE = N^3 elements: the dof numbering, the element to
+  dof table and, on nonconforming meshes, the conforming prolongation.
+
+   * --benchmark_filter=FESpace/[N]/[order]/[prob]
+   * --benchmark_context=device=[cpu/cuda/hip]
+
+  With MFEM_USE_LEGACY_OPENMP, the number of threads is set with
+  OMP_NUM_THREADS.
+*/
+
+// The maximum polynomial order used for benchmarking
+const int max_order = 4;
+// The maximum number of elements per direction used for benchmarking
+const int max_N = 64;
+
+struct SetupMesh
+{
+   Mesh mesh;
+
+   SetupMesh(int N, double prob)
+      : mesh(Mesh::MakeCartesian3D(N,N,N,Element::HEXAHEDRON))
+   {
+      if (prob >= 0.0)
+      {
+         mesh.EnsureNCMesh();
+         if (prob > 0.0) { mesh.RandomRefinement(prob); }
+      }
+   }
+};
+
+/// Construction of the space, as done in the setup phase of a solver
+static void FESpace(bm::State &state)
+{
+   const int N = state.range(0);
+   const int p = state.range(1);
+   const double prob = ((double)state.range(2))/100;
+   SetupMesh setup(N, prob);
+   Mesh &mesh = setup.mesh;
+   H1_FECollection fec(p, 3);
+
+   int dofs = 0;
+   while (state.KeepRunning())
+   {
+      FiniteElementSpace fes(&mesh, &fec);
+      fes.GetElementToDofTable();
+      fes.GetConformingProlongation();
+      dofs = fes.GetTrueVSize();
+   }
+   state.counters["NE"] = bm::Counter(mesh.GetNE());
+   state.counters["Dofs"] = bm::Counter(dofs);
+   state.counters["Order"] = bm::Counter(p);
+   state.counters["Prob"] = bm::Counter(state.range(2));
+   state.counters["NE/s"] = bm::Counter(mesh.GetNE(),
+                                        bm::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(FESpace)->ArgsProduct(
+{
+   benchmark::CreateRange(4, max_N, /*multi=*/2),
+   benchmark::CreateDenseRange(1, max_order, /*step=*/1),
+   {-1, 0, 10}
+})->Unit(bm::kMillisecond);
+
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+
+   // Device setup, cpu by default
+   std::string device_config = "cpu";
+   if (bmi::global_context != nullptr)
+   {
+      const auto device = bmi::global_context->find("device");
+      if (device != bmi::global_context->end())
+      {
+         mfem::out << device->first << " : " << device->second << std::endl;
+         device_config = device->second;
+      }
+   }
+   Device device(device_config.c_str());
+   device.Print();
+
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
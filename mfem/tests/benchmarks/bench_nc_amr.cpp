@@ -0,0 +1,123 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+/*
+  This benchmark measures the AMR bookkeeping of a nonconforming 3D hexahedral
+  mesh with NE = N^3 elements. Each iteration is one refine/derefine cycle, as
+  done in a time-dependent adaptive simulation: a fixed fraction of the
+  elements is refined, the H1 space and a GridFunction are updated, then the
+  mesh is derefined back to the initial one and updated again.
+
+   * --benchmark_filter=NC_AMR/[N]/[order]/[percentage of refined elements]
+   * --benchmark_context=device=[cpu/cuda/hip]
+*/
+
+// The maximum polynomial order used for benchmarking
+const int max_order = 3;
+// The maximum number of elements per direction used for benchmarking
+const int max_N = 32;
+
+struct AMRMesh
+{
+   Mesh mesh;
+   Array<int> marked;
+
+   AMRMesh(int N, int percent)
+      : mesh(Mesh::MakeCartesian3D(N,N,N,Element::HEXAHEDRON))
+   {
+      mesh.EnsureNCMesh();
+
+      // the same elements are marked in every cycle
+      srand(0);
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         if (rand() % 100 < percent) { marked.Append(i); }
+      }
+   }
+};
+
+/// One refine/derefine cycle of the mesh, space and solution
+static void NC_AMR(bm::State &state)
+{
+   const int N = state.range(0);
+   const int p = state.range(1);
+   const int percent = state.range(2);
+   AMRMesh setup(N, percent);
+   Mesh &mesh = setup.mesh;
+   H1_FECollection fec(p, 3);
+   FiniteElementSpace fes(&mesh, &fec);
+   GridFunction x(&fes);
+   x = 1.0;
+
+   const int ne = mesh.GetNE();
+   Array<double> elem_error;
+   int refined_ne = 0;
+   while (state.KeepRunning())
+   {
+      mesh.GeneralRefinement(setup.marked, 1);
+      fes.Update();
+      x.Update();
+      refined_ne = mesh.GetNE();
+
+      // zero error everywhere: all the refinements of the cycle are undone
+      elem_error.SetSize(mesh.GetNE());
+      elem_error = 0.0;
+      mesh.DerefineByError(elem_error, 1.0);
+      fes.Update();
+      x.Update();
+      fes.UpdatesFinished();
+   }
+   MFEM_VERIFY(mesh.GetNE() == ne, "the mesh was not derefined");
+
+   state.counters["NE"] = bm::Counter(ne);
+   state.counters["Refined NE"] = bm::Counter(refined_ne);
+   state.counters["Order"] = bm::Counter(p);
+   state.counters["Percent"] = bm::Counter(percent);
+   state.counters["Cycles/s"] = bm::Counter(state.iterations(),
+                                            bm::Counter::kIsRate);
+}
+
+BENCHMARK(NC_AMR)->ArgsProduct(
+{
+   benchmark::CreateRange(4, max_N, /*multi=*/2),
+   benchmark::CreateDenseRange(1, max_order, /*step=*/1),
+   {10, 30, 100}
+})->Unit(bm::kMillisecond);
+
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+
+   // Device setup, cpu by default
+   std::string device_config = "cpu";
+   if (bmi::global_context != nullptr)
+   {
+      const auto device = bmi::global_context->find("device");
+      if (device != bmi::global_context->end())
+      {
+         mfem::out << device->first << " : " << device->second << std::endl;
+         device_config = device->second;
+      }
+   }
+   Device device(device_config.c_str());
+   device.Print();
+
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
@@ -138,7 +138,8 @@ enum class Problem { Mass,
                      Diffusion,
                      VectorMass,
                      VectorDiffusion,
-                     MassDiffusion
+                     MassDiffusion,
+                     Elasticity
                    };
 
 std::string getString(Problem pb)
@@ -163,6 +164,9 @@ std::string getString(Problem pb)
       case Problem::MassDiffusion:
          return "MassDiffusion";
          break;
+      case Problem::Elasticity:
+         return "Elasticity";
+         break;
    }
    MFEM_ABORT("Unknown Problem.");
    return "";
@@ -252,7 +256,8 @@ void test_ceed_operator(const char* input, int order,
    InitCoeff(mesh, fec, dim, coeff_type, gf, coeff_fes, coeff, vcoeff);
 
    // Build the BilinearForm
-   bool vecOp = pb == Problem::VectorMass || pb == Problem::VectorDiffusion;
+   bool vecOp = pb == Problem::VectorMass || pb == Problem::VectorDiffusion ||
+                pb == Problem::Elasticity;
    const int vdim = vecOp ? dim : 1;
    FiniteElementSpace fes(&mesh, &fec, vdim);
 
@@ -273,8 +278,16 @@ void test_ceed_operator(const char* input, int order,
          k_test.AddDomainIntegrator(new DiffusionIntegrator(*coeff));
          break;
       case Problem::VectorMass:
-         k_ref.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
-         k_test.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
+         if (vcoeff)
+         {
+            k_ref.AddDomainIntegrator(new VectorMassIntegrator(*vcoeff));
+            k_test.AddDomainIntegrator(new VectorMassIntegrator(*vcoeff));
+         }
+         else
+         {
+            k_ref.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
+            k_test.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
+         }
          break;
       case Problem::VectorDiffusion:
          k_ref.AddDomainIntegrator(new VectorDiffusionIntegrator(*coeff));
@@ -286,6 +299,10 @@ void test_ceed_operator(const char* input, int order,
          k_ref.AddDomainIntegrator(new DiffusionIntegrator(*coeff));
          k_test.AddDomainIntegrator(new DiffusionIntegrator(*coeff));
          break;
+      case Problem::Elasticity:
+         k_ref.AddDomainIntegrator(new ElasticityIntegrator(*coeff, *coeff));
+         k_test.AddDomainIntegrator(new ElasticityIntegrator(*coeff, *coeff));
+         break;
    }
 
    k_ref.Assemble();
@@ -305,6 +322,32 @@ void test_ceed_operator(const char* input, int order,
    y_test -= y_ref;
 
    REQUIRE(y_test.Norml2() < 1.e-12);
+
+   // Apply again after modifying the vectors in place: backends copying the
+   // arrays set on their vectors (e.g. /cpu/self/memcheck) must see the new
+   // data.
+   x.Randomize(2);
+   y_test.Randomize(3);
+
+   k_ref.Mult(x,y_ref);
+   k_test.Mult(x,y_test);
+
+   y_test -= y_ref;
+
+   REQUIRE(y_test.Norml2() < 1.e-12);
+
+   // Compare the diagonals, all the domain integrators of k_test are combined
+   // into a single libCEED operator. On nonconforming meshes the diagonal is
+   // only approximated on the conforming space.
+   if (!mesh.Nonconforming())
+   {
+      Vector d_ref(fes.GetVSize()), d_test(fes.GetVSize());
+      k_ref.SpMat().GetDiag(d_ref);
+      k_test.AssembleDiagonal(d_test);
+      d_test -= d_ref;
+
+      REQUIRE(d_test.Normlinf() < 1.e-12);
+   }
    delete gf;
    delete coeff_fes;
    delete coeff;
@@ -336,7 +379,8 @@ void test_mixed_p_ceed_operator(const char* input, int order,
    InitCoeff(mesh, fec, dim, coeff_type, gf, coeff_fes, coeff, vcoeff);
 
    // Build the BilinearForm
-   bool vecOp = pb == Problem::VectorMass || pb == Problem::VectorDiffusion;
+   bool vecOp = pb == Problem::VectorMass || pb == Problem::VectorDiffusion ||
+                pb == Problem::Elasticity;
    const int vdim = vecOp ? dim : 1;
    FiniteElementSpace fes(&mesh, &fec, vdim);
    fes.SetElementOrder(0, order+1);
@@ -360,8 +404,16 @@ void test_mixed_p_ceed_operator(const char* input, int order,
          k_test.AddDomainIntegrator(new DiffusionIntegrator(*coeff));
          break;
       case Problem::VectorMass:
-         k_ref.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
-         k_test.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
+         if (vcoeff)
+         {
+            k_ref.AddDomainIntegrator(new VectorMassIntegrator(*vcoeff));
+            k_test.AddDomainIntegrator(new VectorMassIntegrator(*vcoeff));
+         }
+         else
+         {
+            k_ref.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
+            k_test.AddDomainIntegrator(new VectorMassIntegrator(*coeff));
+         }
          break;
       case Problem::VectorDiffusion:
          k_ref.AddDomainIntegrator(new VectorDiffusionIntegrator(*coeff));
@@ -373,6 +425,10 @@ void test_mixed_p_ceed_operator(const char* input, int order,
          k_ref.AddDomainIntegrator(new DiffusionIntegrator(*coeff));
          k_test.AddDomainIntegrator(new DiffusionIntegrator(*coeff));
          break;
+      case Problem::Elasticity:
+         k_ref.AddDomainIntegrator(new ElasticityIntegrator(*coeff, *coeff));
+         k_test.AddDomainIntegrator(new ElasticityIntegrator(*coeff, *coeff));
+         break;
    }
 
    k_ref.Assemble();
@@ -398,6 +454,110 @@ void test_mixed_p_ceed_operator(const char* input, int order,
    delete vcoeff;
 }
 
+enum class VectorFEProblem { CurlCurl, VectorFEMass };
+
+std::string getString(VectorFEProblem pb)
+{
+   switch (pb)
+   {
+      case VectorFEProblem::CurlCurl:
+         return "CurlCurl";
+         break;
+      case VectorFEProblem::VectorFEMass:
+         return "VectorFEMass";
+         break;
+   }
+   MFEM_ABORT("Unknown Problem.");
+   return "";
+}
+
+// Test the H(curl) and H(div) operators. The same integration rule is used by
+// the reference and the CEED integrators since the default rules of the
+// partial assembly and of the legacy element matrices differ.
+void test_ceed_vectorfe_operator(const char* input, int order,
+                                 const CeedCoeffType coeff_type,
+                                 const VectorFEProblem pb, bool hdiv,
+                                 const AssemblyLevel assembly)
+{
+   std::string section = "assembly: " + getString(assembly) + "\n" +
+                         "coeff_type: " + getString(coeff_type) + "\n" +
+                         "pb: " + getString(pb) + "\n" +
+                         "space: " + (hdiv ? "RT" : "ND") + "\n" +
+                         "order: " + std::to_string(order) + "\n" +
+                         "mesh: " + input;
+   INFO(section);
+   Mesh mesh(input, 1, 1);
+   mesh.EnsureNodes();
+   int dim = mesh.Dimension();
+   H1_FECollection coeff_fec(order, dim);
+
+   // Coefficient Initialization
+   GridFunction *gf = nullptr;
+   FiniteElementSpace *coeff_fes = nullptr;
+   Coefficient *coeff = nullptr;
+   VectorCoefficient *vcoeff = nullptr;
+   InitCoeff(mesh, coeff_fec, dim, coeff_type, gf, coeff_fes, coeff, vcoeff);
+
+   FiniteElementCollection *fec = nullptr;
+   if (hdiv) { fec = new RT_FECollection(order - 1, dim); }
+   else { fec = new ND_FECollection(order, dim); }
+   FiniteElementSpace fes(&mesh, fec);
+
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule &ir =
+      IntRules.Get(el.GetGeomType(), 2*el.GetOrder() + 2);
+
+   BilinearForm k_test(&fes);
+   BilinearForm k_ref(&fes);
+   BilinearFormIntegrator *integ_ref = nullptr, *integ_test = nullptr;
+   switch (pb)
+   {
+      case VectorFEProblem::CurlCurl:
+         integ_ref = new CurlCurlIntegrator(*coeff);
+         integ_test = new CurlCurlIntegrator(*coeff);
+         break;
+      case VectorFEProblem::VectorFEMass:
+         integ_ref = new VectorFEMassIntegrator(*coeff);
+         integ_test = new VectorFEMassIntegrator(*coeff);
+         break;
+   }
+   integ_ref->SetIntRule(&ir);
+   integ_test->SetIntRule(&ir);
+   k_ref.AddDomainIntegrator(integ_ref);
+   k_test.AddDomainIntegrator(integ_test);
+
+   k_ref.Assemble();
+   k_ref.Finalize();
+
+   k_test.SetAssemblyLevel(assembly);
+   k_test.Assemble();
+
+   // Compare ceed with mfem.
+   GridFunction x(&fes), y_ref(&fes), y_test(&fes);
+
+   x.Randomize(1);
+
+   k_ref.Mult(x,y_ref);
+   k_test.Mult(x,y_test);
+
+   y_test -= y_ref;
+
+   REQUIRE(y_test.Norml2() < 1.e-12);
+
+   // Compare the diagonals
+   Vector d_ref(fes.GetVSize()), d_test(fes.GetVSize());
+   k_ref.SpMat().GetDiag(d_ref);
+   k_test.AssembleDiagonal(d_test);
+   d_test -= d_ref;
+
+   REQUIRE(d_test.Normlinf() < 1.e-12);
+   delete fec;
+   delete gf;
+   delete coeff_fes;
+   delete coeff;
+   delete vcoeff;
+}
+
 void test_ceed_nloperator(const char* mesh_filename, int order,
                           const CeedCoeffType coeff_type,
                           const NLProblem pb, const AssemblyLevel assembly)
@@ -526,6 +686,67 @@ TEST_CASE("CEED mass & diffusion", "[CEED]")
    test_ceed_operator(mesh, order, coeff_type, pb, assembly);
 } // test case
 
+TEST_CASE("CEED elasticity", "[CEED]")
+{
+   auto assembly = GENERATE(AssemblyLevel::PARTIAL,AssemblyLevel::NONE);
+   auto coeff_type = GENERATE(CeedCoeffType::Const,CeedCoeffType::Grid,
+                              CeedCoeffType::Quad);
+   auto order = GENERATE(1,2);
+   auto mesh = GENERATE("../../data/inline-quad.mesh",
+                        "../../data/inline-hex.mesh",
+                        "../../data/star-q2.mesh",
+                        "../../data/fichera-q2.mesh",
+                        "../../data/square-mixed.mesh",
+                        "../../data/fichera-mixed.mesh");
+   test_ceed_operator(mesh, order, coeff_type, Problem::Elasticity, assembly);
+} // test case
+
+TEST_CASE("CEED vector mass with vector coefficient", "[CEED]")
+{
+   auto assembly = GENERATE(AssemblyLevel::PARTIAL,AssemblyLevel::NONE);
+   auto coeff_type = GENERATE(CeedCoeffType::VecConst,CeedCoeffType::VecGrid,
+                              CeedCoeffType::VecQuad);
+   auto order = GENERATE(1);
+   auto mesh = GENERATE("../../data/inline-quad.mesh",
+                        "../../data/inline-hex.mesh",
+                        "../../data/star-q2.mesh",
+                        "../../data/square-mixed.mesh",
+                        "../../data/fichera-mixed.mesh");
+   test_ceed_operator(mesh, order, coeff_type, Problem::VectorMass, assembly);
+} // test case
+
+TEST_CASE("CEED H(curl) and H(div)", "[CEED]")
+{
+   auto assembly = GENERATE(AssemblyLevel::PARTIAL,AssemblyLevel::NONE);
+   auto coeff_type = GENERATE(CeedCoeffType::Const,CeedCoeffType::Grid,
+                              CeedCoeffType::Quad);
+   auto order = GENERATE(1,2);
+   auto mesh = GENERATE("../../data/inline-quad.mesh",
+                        "../../data/inline-tri.mesh",
+                        "../../data/inline-hex.mesh",
+                        "../../data/star-q2.mesh",
+                        "../../data/fichera-q2.mesh");
+   // H(curl): curl-curl and mass
+   test_ceed_vectorfe_operator(mesh, order, coeff_type,
+                               VectorFEProblem::CurlCurl, false, assembly);
+   test_ceed_vectorfe_operator(mesh, order, coeff_type,
+                               VectorFEProblem::VectorFEMass, false, assembly);
+   // H(div): mass
+   test_ceed_vectorfe_operator(mesh, order, coeff_type,
+                               VectorFEProblem::VectorFEMass, true, assembly);
+} // test case
+
+TEST_CASE("CEED lowest order H(curl) on tetrahedra", "[CEED]")
+{
+   // Higher order Nedelec tetrahedra require a DofTransformation, which is not
+   // supported by the CEED restrictions.
+   auto assembly = GENERATE(AssemblyLevel::PARTIAL,AssemblyLevel::NONE);
+   auto coeff_type = GENERATE(CeedCoeffType::Const,CeedCoeffType::Quad);
+   auto pb = GENERATE(VectorFEProblem::CurlCurl,VectorFEProblem::VectorFEMass);
+   test_ceed_vectorfe_operator("../../data/inline-tet.mesh", 1, coeff_type,
+                               pb, false, assembly);
+} // test case
+
 TEST_CASE("CEED p-adaptivity", "[CEED]")
 {
    auto assembly = GENERATE(AssemblyLevel::PARTIAL,AssemblyLevel::NONE);
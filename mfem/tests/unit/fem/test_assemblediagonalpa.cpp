@@ -501,4 +501,181 @@ TEST_CASE("Hcurl/Hdiv diagonal PA",
    }  // dimension
 }
 
+// Compare the diagonal of the assembled form with the diagonal of the
+// unassembled form, reduced from the element diagonals, and of the form
+// with element assembly when the integrator supports it.
+void TestElementDiagonal(FiniteElementSpace &fes,
+                         BilinearFormIntegrator *integ_fa,
+                         BilinearFormIntegrator *integ_el,
+                         BilinearFormIntegrator *integ_ea = nullptr)
+{
+   BilinearForm a_fa(&fes), a_el(&fes), a_ea(&fes);
+   a_fa.AddDomainIntegrator(integ_fa);
+   a_fa.Assemble();
+   a_fa.Finalize();
+   a_el.AddDomainIntegrator(integ_el);
+
+   const int n = fes.GetTrueVSize();
+   Vector diag_fa(n), diag_el(n);
+   a_fa.AssembleDiagonal(diag_fa);
+   a_el.AssembleDiagonal(diag_el);
+   diag_el -= diag_fa;
+   REQUIRE(diag_el.Normlinf() <= 1e-12 * diag_fa.Normlinf());
+
+   if (integ_ea)
+   {
+      Vector diag_ea(n);
+      a_ea.SetAssemblyLevel(AssemblyLevel::ELEMENT);
+      a_ea.SetElementMatrixStorage(true, false);
+      a_ea.AddDomainIntegrator(integ_ea);
+      a_ea.Assemble();
+      a_ea.AssembleDiagonal(diag_ea);
+      diag_ea -= diag_fa;
+      REQUIRE(diag_ea.Normlinf() <= 1e-12 * diag_fa.Normlinf());
+   }
+}
+
+TEST_CASE("Element-local diagonal", "[AssembleDiagonal]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const bool simplex = GENERATE(false, true);
+   CAPTURE(dim, order, simplex);
+
+   const int ne = 2;
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(ne, ne, simplex ? Element::TRIANGLE :
+                                     Element::QUADRILATERAL, true) :
+               Mesh::MakeCartesian3D(ne, ne, ne, simplex ? Element::TETRAHEDRON :
+                                     Element::HEXAHEDRON);
+
+   FunctionCoefficient q(coeffFunction);
+
+   SECTION("H1")
+   {
+      H1_FECollection fec(order, dim);
+      FiniteElementSpace fes(&mesh, &fec);
+      // The element assembly kernels require tensor-product elements
+      TestElementDiagonal(fes, new DiffusionIntegrator(q),
+                          new DiffusionIntegrator(q),
+                          simplex ? nullptr : new DiffusionIntegrator(q));
+      TestElementDiagonal(fes, new MassIntegrator(q), new MassIntegrator(q),
+                          simplex ? nullptr : new MassIntegrator(q));
+   }
+
+   SECTION("Elasticity")
+   {
+      H1_FECollection fec(order, dim);
+      FiniteElementSpace fes(&mesh, &fec, dim);
+      ConstantCoefficient lambda(2.0);
+      TestElementDiagonal(fes, new ElasticityIntegrator(lambda, q),
+                          new ElasticityIntegrator(lambda, q));
+   }
+
+   SECTION("H(curl)")
+   {
+      ND_FECollection fec(order, dim);
+      FiniteElementSpace fes(&mesh, &fec);
+      TestElementDiagonal(fes, new CurlCurlIntegrator(q),
+                          new CurlCurlIntegrator(q));
+      TestElementDiagonal(fes, new VectorFEMassIntegrator(q),
+                          new VectorFEMassIntegrator(q));
+   }
+}
+
+// Diffusion integrator without AssembleDiagonalPA(), so that the partial
+// assembly extension uses the element-local diagonals instead.
+class ElementDiagonalDiffusionIntegrator : public DiffusionIntegrator
+{
+public:
+   using DiffusionIntegrator::DiffusionIntegrator;
+   virtual bool SupportsAssembleDiagonalPA() const { return false; }
+   virtual void AssembleDiagonalPA(Vector &)
+   {
+      MFEM_ABORT("AssembleDiagonalPA should not be called");
+   }
+};
+
+TEST_CASE("PA diagonal and action", "[PartialAssembly][AssembleDiagonal]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const bool simplex = GENERATE(false, true);
+   CAPTURE(dim, order, simplex);
+
+   const int ne = 2;
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(ne, ne, simplex ? Element::TRIANGLE :
+                                     Element::QUADRILATERAL, true) :
+               Mesh::MakeCartesian3D(ne, ne, ne, simplex ? Element::TETRAHEDRON :
+                                     Element::HEXAHEDRON);
+   // Curved elements, so that the Jacobians vary at the quadrature points
+   mesh.SetCurvature(2);
+   GridFunction &nodes = *mesh.GetNodes();
+   Vector pert(nodes.Size());
+   pert.Randomize(1);
+   nodes.Add(0.02, pert);
+
+   FunctionCoefficient q(coeffFunction);
+   H1_FECollection fec(order, dim);
+
+   auto test = [&](FiniteElementSpace &fes, BilinearFormIntegrator *integ_fa,
+                   BilinearFormIntegrator *integ_pa)
+   {
+      BilinearForm a_fa(&fes), a_pa(&fes);
+      a_fa.AddDomainIntegrator(integ_fa);
+      a_fa.Assemble();
+      a_fa.Finalize();
+      a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      a_pa.AddDomainIntegrator(integ_pa);
+      a_pa.Assemble();
+
+      const int n = fes.GetTrueVSize();
+      Vector diag_fa(n), diag_pa(n);
+      a_fa.AssembleDiagonal(diag_fa);
+      a_pa.AssembleDiagonal(diag_pa);
+      diag_pa -= diag_fa;
+      REQUIRE(diag_pa.Normlinf() <= 1e-12 * diag_fa.Normlinf());
+
+      Vector x(n), y_fa(n), y_pa(n);
+      x.Randomize(1);
+      a_fa.Mult(x, y_fa);
+      a_pa.Mult(x, y_pa);
+      y_pa -= y_fa;
+      REQUIRE(y_pa.Normlinf() <= 1e-12 * y_fa.Normlinf());
+   };
+
+   SECTION("Elasticity")
+   {
+      const Ordering::Type ordering = GENERATE(Ordering::byNODES,
+                                               Ordering::byVDIM);
+      FiniteElementSpace fes(&mesh, &fec, dim, ordering);
+      ConstantCoefficient lambda(2.0);
+      test(fes, new ElasticityIntegrator(lambda, q),
+           new ElasticityIntegrator(lambda, q));
+      test(fes, new ElasticityIntegrator(q, 1.5, 0.5),
+           new ElasticityIntegrator(q, 1.5, 0.5));
+
+      // Element diagonals computed from scratch and from the data of
+      // AssemblePA()
+      ElasticityIntegrator integ(lambda, q);
+      Vector ediag(fes.GetFE(0)->GetDof()*dim*mesh.GetNE()), ediag_pa;
+      ediag_pa.SetSize(ediag.Size());
+      integ.AssembleElementDiagonals(fes, ediag, false);
+      integ.AssemblePA(fes);
+      integ.AssembleElementDiagonals(fes, ediag_pa, false);
+      ediag_pa -= ediag;
+      REQUIRE(ediag_pa.Normlinf() <= 1e-12 * ediag.Normlinf());
+   }
+
+   SECTION("Element-local diagonal fallback")
+   {
+      FiniteElementSpace fes(&mesh, &fec);
+      const IntegrationRule &ir =
+         IntRules.Get(mesh.GetElementGeometry(0), 2*order + 2);
+      test(fes, new DiffusionIntegrator(q, &ir),
+           new ElementDiagonalDiffusionIntegrator(q, &ir));
+   }
+}
+
 } // namespace assemblediagonalpa
@@ -228,6 +228,64 @@ TEST_CASE("H1 Assembly Levels", "[AssemblyLevel], [PartialAssembly], [CUDA]")
    }
 } // H1 Assembly Levels test case
 
+TEST_CASE("Element Assembly Storage", "[AssemblyLevel], [CUDA]")
+{
+   auto pb = GENERATE(Problem::Mass, Problem::Convection, Problem::Diffusion);
+   auto meshname = GENERATE("../../data/star-q3.mesh",
+                            "../../data/fichera-q3.mesh");
+   auto symmetric = GENERATE(false, true);
+   auto single = GENERATE(false, true);
+   const int order = 2;
+
+   INFO("mesh=" << meshname << ", problem=" << getString(pb)
+        << ", symmetric=" << symmetric << ", single=" << single);
+
+   Mesh mesh(meshname);
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   ConstantCoefficient one(1.0);
+   VectorFunctionCoefficient vel_coeff(dim, velocity_function);
+
+   BilinearForm k_ref(&fes), k_ea(&fes);
+   k_ea.SetAssemblyLevel(AssemblyLevel::ELEMENT);
+   k_ea.SetElementMatrixStorage(symmetric, single);
+   for (BilinearForm *k : {&k_ref, &k_ea})
+   {
+      switch (pb)
+      {
+         case Problem::Mass:
+            k->AddDomainIntegrator(new MassIntegrator(one));
+            break;
+         case Problem::Convection:
+            AddConvectionIntegrators(*k, vel_coeff, false);
+            break;
+         case Problem::Diffusion:
+            k->AddDomainIntegrator(new DiffusionIntegrator(one));
+            break;
+      }
+      k->Assemble();
+   }
+   k_ref.Finalize();
+
+   GridFunction x(&fes), y_ref(&fes), y_ea(&fes);
+   x.Randomize(1);
+   // Single precision storage is accurate to about 1e-7 relative to the
+   // entries of the element matrices.
+   const double rtol = single ? 1e-5 : 1e-12;
+
+   k_ref.Mult(x, y_ref);
+   k_ea.Mult(x, y_ea);
+   y_ea -= y_ref;
+   REQUIRE(y_ea.Normlinf() <= rtol * std::max(1.0, y_ref.Normlinf()));
+
+   k_ref.MultTranspose(x, y_ref);
+   k_ea.MultTranspose(x, y_ea);
+   y_ea -= y_ref;
+   REQUIRE(y_ea.Normlinf() <= rtol * std::max(1.0, y_ref.Normlinf()));
+}
+
 TEST_CASE("L2 Assembly Levels", "[AssemblyLevel], [PartialAssembly], [CUDA]")
 {
    const bool dg = true;
@@ -517,6 +575,86 @@ TEST_CASE("Parallel H1 Full Assembly", "[AssemblyLevel], [Parallel], [CUDA]")
    REQUIRE(B1.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("Parallel H1 Partial Assembly", "[AssemblyLevel], [Parallel]")
+{
+   auto order = GENERATE(1, 3);
+   auto vdim = GENERATE(1, 2);
+   auto mesh_fname = GENERATE(
+                        "../../data/star.mesh",
+                        "../../data/fichera.mesh"
+                     );
+
+   Mesh serial_mesh(mesh_fname);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+
+   int dim = mesh.Dimension();
+
+   H1_FECollection fec(order, dim);
+   ParFiniteElementSpace fespace(&mesh, &fec, vdim);
+
+   Array<int> ess_tdof_list;
+   fespace.GetBoundaryTrueDofs(ess_tdof_list);
+
+   // With domain integrators only, the PA operator overlaps the communication
+   // of the prolongation with the element restriction and, for the
+   // integrators supporting element subsets, with the element kernels, see
+   // ParPAOverlapOperator.
+   ParBilinearForm a_pa(&fespace);
+   ParBilinearForm a_legacy(&fespace);
+
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_legacy.SetAssemblyLevel(AssemblyLevel::LEGACY);
+   a_legacy.SetDiagonalPolicy(Operator::DIAG_ONE);
+
+   if (vdim == 1)
+   {
+      a_pa.AddDomainIntegrator(new DiffusionIntegrator);
+      a_legacy.AddDomainIntegrator(new DiffusionIntegrator);
+      a_pa.AddDomainIntegrator(new MassIntegrator);
+      a_legacy.AddDomainIntegrator(new MassIntegrator);
+   }
+   else
+   {
+      a_pa.AddDomainIntegrator(new VectorDiffusionIntegrator);
+      a_legacy.AddDomainIntegrator(new VectorDiffusionIntegrator);
+      a_pa.AddDomainIntegrator(new VectorMassIntegrator);
+      a_legacy.AddDomainIntegrator(new VectorMassIntegrator);
+   }
+
+   a_pa.Assemble();
+   a_legacy.Assemble();
+   a_legacy.Finalize();
+
+   OperatorHandle A_pa, A_legacy;
+   a_pa.FormSystemMatrix(ess_tdof_list, A_pa);
+   a_legacy.FormSystemMatrix(ess_tdof_list, A_legacy);
+
+   auto *A_con = dynamic_cast<ConstrainedOperator*>(A_pa.Ptr());
+   REQUIRE(A_con != nullptr);
+   auto *overlap = dynamic_cast<const ParPAOverlapOperator*>(
+                      &A_con->GetUnconstrainedOperator());
+   REQUIRE(overlap != nullptr);
+   // Only the scalar mass and diffusion integrators support element subsets
+   REQUIRE(overlap->OverlapsElementKernels() == (vdim == 1));
+
+   Vector x(fespace.GetTrueVSize()), y_pa(x.Size()), y_legacy(x.Size());
+   x.Randomize(1);
+   for (int it = 0; it < 2; it++)
+   {
+      A_pa->Mult(x, y_pa);
+      A_legacy->Mult(x, y_legacy);
+      y_pa -= y_legacy;
+      REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+
+      A_pa->MultTranspose(x, y_pa);
+      A_legacy->MultTranspose(x, y_legacy);
+      y_pa -= y_legacy;
+      REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+      x.Randomize(2);
+   }
+}
+
 #endif
 
 } // namespace assembly_levels
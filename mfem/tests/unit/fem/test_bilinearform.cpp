@@ -142,3 +142,206 @@ TEST_CASE("FormLinearSystem/SolutionScope",
       REQUIRE(AsConst(sol)(bdr_dof) == 0.0);
    }
 }
+
+static double batched_coeff(const Vector &x)
+{
+   return 1.0 + x(0)*x(0) + 0.5*x(1);
+}
+
+static void batched_vcoeff(const Vector &x, Vector &v)
+{
+   for (int i = 0; i < v.Size(); i++) { v(i) = 1.0 + (i+1)*x(i)*x(i); }
+}
+
+enum class BatchedIntegrator
+{
+   MASS, DIFFUSION, VECTOR_MASS, DIAG_VECTOR_MASS, ELASTICITY, CURL_CURL,
+   ND_MASS, RT_MASS
+};
+
+TEST_CASE("Batched element matrices", "[BilinearForm]")
+{
+   const auto geom = GENERATE(Element::QUADRILATERAL, Element::TRIANGLE,
+                              Element::HEXAHEDRON, Element::TETRAHEDRON);
+   const auto integ = GENERATE(BatchedIntegrator::MASS,
+                               BatchedIntegrator::DIFFUSION,
+                               BatchedIntegrator::VECTOR_MASS,
+                               BatchedIntegrator::DIAG_VECTOR_MASS,
+                               BatchedIntegrator::ELASTICITY,
+                               BatchedIntegrator::CURL_CURL,
+                               BatchedIntegrator::ND_MASS,
+                               BatchedIntegrator::RT_MASS);
+   const int order = GENERATE(1, 2, 3);
+   CAPTURE(geom, int(integ), order);
+
+   const bool is_3d = geom == Element::HEXAHEDRON ||
+                      geom == Element::TETRAHEDRON;
+   Mesh mesh = is_3d ? Mesh::MakeCartesian3D(2, 2, 2, geom) :
+               Mesh::MakeCartesian2D(3, 3, geom);
+   const int dim = mesh.Dimension();
+   mesh.SetCurvature(2);
+   GridFunction &nodes = *mesh.GetNodes();
+   Vector pert(nodes.Size());
+   pert.Randomize(1);
+   nodes.Add(0.02, pert);
+
+   FunctionCoefficient coeff(batched_coeff);
+   VectorFunctionCoefficient vcoeff(dim, batched_vcoeff);
+   ConstantCoefficient two(2.0);
+
+   std::unique_ptr<FiniteElementCollection> fec;
+   int vdim = 1;
+   switch (integ)
+   {
+      case BatchedIntegrator::CURL_CURL:
+      case BatchedIntegrator::ND_MASS:
+         fec.reset(new ND_FECollection(order, dim));
+         break;
+      case BatchedIntegrator::RT_MASS:
+         fec.reset(new RT_FECollection(order - 1, dim));
+         break;
+      case BatchedIntegrator::VECTOR_MASS:
+      case BatchedIntegrator::DIAG_VECTOR_MASS:
+      case BatchedIntegrator::ELASTICITY:
+         vdim = dim;
+         fec.reset(new H1_FECollection(order, dim));
+         break;
+      default:
+         fec.reset(new H1_FECollection(order, dim));
+   }
+   FiniteElementSpace fes(&mesh, fec.get(), vdim);
+
+   auto new_integ = [&]() -> BilinearFormIntegrator*
+   {
+      switch (integ)
+      {
+         case BatchedIntegrator::MASS: return new MassIntegrator(coeff);
+         case BatchedIntegrator::DIFFUSION:
+            return new DiffusionIntegrator(coeff);
+         case BatchedIntegrator::VECTOR_MASS:
+            return new VectorMassIntegrator(coeff);
+         case BatchedIntegrator::DIAG_VECTOR_MASS:
+            return new VectorMassIntegrator(vcoeff);
+         case BatchedIntegrator::ELASTICITY:
+            return new ElasticityIntegrator(coeff, two);
+         case BatchedIntegrator::CURL_CURL:
+            return new CurlCurlIntegrator(coeff);
+         default: return new VectorFEMassIntegrator(coeff);
+      }
+   };
+
+   SECTION("Element matrices")
+   {
+      std::unique_ptr<BilinearFormIntegrator> bfi(new_integ());
+      REQUIRE(bfi->SupportsBatchedElementMatrices(fes));
+
+      const int n = fes.GetFE(0)->GetDof()*vdim;
+      DenseTensor emats(n, n, fes.GetNE());
+      bfi->AssembleElementMatrices(fes, emats, false);
+
+      DenseMatrix elmat;
+      for (int e = 0; e < fes.GetNE(); e++)
+      {
+         bfi->AssembleElementMatrix(*fes.GetFE(e),
+                                    *fes.GetElementTransformation(e), elmat);
+         elmat -= emats(e);
+         REQUIRE(elmat.MaxMaxNorm() <= 1e-10 * emats(e).MaxMaxNorm());
+      }
+
+      // A range of elements, as used by BilinearForm::Assemble()
+      const int e_begin = fes.GetNE() / 3;
+      DenseTensor emats_range(n, n, fes.GetNE() - e_begin);
+      bfi->AssembleElementMatrices(fes, emats_range, false, e_begin);
+      for (int e = e_begin; e < fes.GetNE(); e++)
+      {
+         elmat = emats_range(e - e_begin);
+         elmat -= emats(e);
+         REQUIRE(elmat.MaxMaxNorm() <= 1e-12 * emats(e).MaxMaxNorm());
+      }
+   }
+
+   SECTION("Sparse matrix")
+   {
+      // Restricting the integrator to all attributes disables batching.
+      Array<int> all_attr(mesh.attributes.Max());
+      all_attr = 1;
+      BilinearForm a_batched(&fes), a_legacy(&fes);
+      a_batched.AddDomainIntegrator(new_integ());
+      a_batched.AddDomainIntegrator(new_integ());
+      a_legacy.AddDomainIntegrator(new_integ(), all_attr);
+      a_legacy.AddDomainIntegrator(new_integ(), all_attr);
+      REQUIRE(a_batched.UsesBatchedElementMatrices());
+      REQUIRE(!a_legacy.UsesBatchedElementMatrices());
+      a_batched.Assemble();
+      a_batched.Finalize();
+      a_legacy.Assemble();
+      a_legacy.Finalize();
+
+      SparseMatrix *D = Add(1.0, a_batched.SpMat(), -1.0, a_legacy.SpMat());
+      REQUIRE(D->MaxNorm() <= 1e-10 * a_legacy.SpMat().MaxNorm());
+      delete D;
+   }
+}
+
+// Exposes the cached symbolic RAP product of the conforming assembly.
+class ConformingRAPBilinearForm : public BilinearForm
+{
+public:
+   using BilinearForm::BilinearForm;
+   using BilinearForm::ConformingAssemble;
+   const SparseRAP *GetConformingRAP() const { return conf_rap.get(); }
+};
+
+TEST_CASE("Conforming assembly reuses the RAP pattern", "[BilinearForm]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   mesh.EnsureNCMesh();
+   Array<int> refs({0, 5, 10});
+   mesh.GeneralRefinement(refs);
+
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   ConformingRAPBilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator);
+   a.AddDomainIntegrator(new MassIntegrator);
+
+   auto check = [&]()
+   {
+      BilinearForm a_ref(&fes);
+      a_ref.AddDomainIntegrator(new DiffusionIntegrator);
+      a_ref.AddDomainIntegrator(new MassIntegrator);
+      a_ref.Assemble();
+      a_ref.Finalize();
+      const SparseMatrix &P = *fes.GetConformingProlongation();
+      SparseMatrix *A_ref = RAP(P, a_ref.SpMat(), P);
+      SparseMatrix *D = Add(1.0, a.SpMat(), -1.0, *A_ref);
+      REQUIRE(D->MaxNorm() <= 1e-12 * A_ref->MaxNorm());
+      delete D;
+      delete A_ref;
+   };
+
+   a.Assemble();
+   a.ConformingAssemble();
+   const SparseRAP *rap = a.GetConformingRAP();
+   REQUIRE(rap != nullptr);
+   check();
+
+   // Reassembling on the same space keeps the symbolic product.
+   a.Update();
+   a.Assemble();
+   a.ConformingAssemble();
+   REQUIRE(a.GetConformingRAP() == rap);
+   check();
+
+   // Refining the mesh invalidates it.
+   Array<int> refs2({1, 2});
+   mesh.GeneralRefinement(refs2);
+   fes.Update();
+   a.Update();
+   REQUIRE(a.GetConformingRAP() == nullptr);
+   a.Assemble();
+   a.ConformingAssemble();
+   REQUIRE(a.GetConformingRAP() != nullptr);
+   check();
+}
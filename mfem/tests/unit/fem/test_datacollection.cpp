@@ -325,3 +325,94 @@ TEST_CASE("ParaView restart mode", "[ParaView]")
    REQUIRE(remove("ParaView/ParaView.pvd") == 0);
    REQUIRE(rmdir("ParaView") == 0);
 }
+
+static std::string ReadFile(const std::string &fname)
+{
+   std::ifstream in(fname, std::ios::binary);
+   std::stringstream ss;
+   ss << in.rdbuf();
+   return ss.str();
+}
+
+TEST_CASE("ParaView asynchronous save", "[ParaView]")
+{
+   auto format = GENERATE(VTKFormat::ASCII, VTKFormat::BINARY,
+                          VTKFormat::BINARY32);
+#ifdef MFEM_USE_ZLIB
+   auto compression = GENERATE(false, true);
+#else
+   const bool compression = false;
+#endif
+   CAPTURE(int(format), compression);
+
+   Mesh mesh = Mesh::MakeCartesian2D(3, 2, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   FiniteElementSpace vfes(&mesh, &fec, 2);
+   GridFunction u(&fes), v(&vfes);
+   QuadratureSpace qs(&mesh, 2);
+   QuadratureFunction q(&qs);
+
+   auto SetFields = [&](int cycle)
+   {
+      FunctionCoefficient u_coeff([cycle](const Vector &x)
+      {
+         return cycle + sin(x(0)) * x(1);
+      });
+      u.ProjectCoefficient(u_coeff);
+      v = 1.0 + cycle;
+      q = 2.0 * cycle;
+   };
+
+   const int ncycles = 4;
+   for (int async = 0; async <= 1; async++)
+   {
+      ParaViewDataCollection dc(async ? "ParaViewAsync" : "ParaViewSync",
+                                &mesh);
+      dc.SetDataFormat(format);
+      dc.SetCompression(compression);
+      dc.SetLevelsOfDetail(2);
+      dc.RegisterField("u", &u);
+      dc.RegisterField("v", &v);
+      dc.RegisterQField("q", &q);
+      if (async) { dc.SetAsyncSave(true); }
+      REQUIRE(dc.IsAsyncSave() == bool(async));
+      for (int c = 0; c < ncycles; c++)
+      {
+         // The fields are modified right after each Save(): the asynchronous
+         // saves must write the staged data.
+         SetFields(c);
+         SaveDataCollection(dc, c, c);
+      }
+      SetFields(-1);
+      dc.WaitForSave();
+      REQUIRE(dc.Error() == DataCollection::NO_ERROR);
+   }
+
+   for (int c = 0; c < ncycles; c++)
+   {
+      for (std::string fname : {"data.pvtu", "proc000000.vtu", "q.pvtu",
+                                "q000000.vtu"
+                               })
+      {
+         const std::string path = "/Cycle00000" + std::to_string(c) + "/"
+                                  + fname;
+         const std::string sync_data = ReadFile("ParaViewSync" + path);
+         REQUIRE(sync_data.size() > 0);
+         REQUIRE(sync_data == ReadFile("ParaViewAsync" + path));
+         REQUIRE(remove(("ParaViewSync" + path).c_str()) == 0);
+         REQUIRE(remove(("ParaViewAsync" + path).c_str()) == 0);
+      }
+      for (std::string dir : {"ParaViewSync", "ParaViewAsync"})
+      {
+         const std::string path = dir + "/Cycle00000" + std::to_string(c);
+         REQUIRE(rmdir(path.c_str()) == 0);
+      }
+   }
+   REQUIRE(ReadFile("ParaViewSync/ParaViewSync.pvd") ==
+           ReadFile("ParaViewAsync/ParaViewAsync.pvd"));
+   REQUIRE(remove("ParaViewSync/ParaViewSync.pvd") == 0);
+   REQUIRE(remove("ParaViewAsync/ParaViewAsync.pvd") == 0);
+   REQUIRE(rmdir("ParaViewSync") == 0);
+   REQUIRE(rmdir("ParaViewAsync") == 0);
+}
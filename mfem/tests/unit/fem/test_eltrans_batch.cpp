@@ -0,0 +1,155 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace eltrans_batch
+{
+
+void Curve(const Vector &x, Vector &y)
+{
+   y = x;
+   y(0) += 0.1*sin(M_PI*x(1));
+   y(1) += 0.1*sin(M_PI*x(0));
+   if (x.Size() == 3) { y(2) += 0.1*x(0)*x(1); }
+}
+
+Mesh MakeMesh(int dim, Element::Type type, int curvature, int sdim)
+{
+   Mesh mesh = (dim == 2) ? Mesh::MakeCartesian2D(3, 2, type, false, 1.0, 2.0)
+               : Mesh::MakeCartesian3D(2, 2, 2, type, 1.0, 2.0, 1.0);
+   if (curvature > 0)
+   {
+      mesh.SetCurvature(curvature, false, sdim, Ordering::byVDIM);
+      mesh.Transform(Curve);
+   }
+   return mesh;
+}
+
+TEST_CASE("ElementTransformationBatch", "[ElementTransformation]")
+{
+   const int dim = GENERATE(2, 3);
+   const int curvature = GENERATE(0, 2);
+   const bool simplex = GENERATE(false, true);
+   const bool surface = GENERATE(false, true);
+   CAPTURE(dim, curvature, simplex, surface);
+   // Surface meshes are curved 2D meshes in 3D space.
+   if (surface && (dim == 3 || curvature == 0)) { return; }
+
+   const Element::Type type =
+      (dim == 2) ? (simplex ? Element::TRIANGLE : Element::QUADRILATERAL)
+      : (simplex ? Element::TETRAHEDRON : Element::HEXAHEDRON);
+   Mesh mesh = MakeMesh(dim, type, curvature, surface ? 3 : dim);
+   const Geometry::Type geom = mesh.GetElementGeometry(0);
+   const IntegrationRule &ir = IntRules.Get(geom, 5);
+   const IntegrationPoint off_ip = Geometries.GetCenter(geom);
+
+   // Use a range that does not start at the first element.
+   const int e_begin = 1, e_end = mesh.GetNE();
+   ElementTransformationBatch batch(mesh, ir, geom);
+   batch.Compute(e_begin, e_end);
+
+   BatchedIsoparametricTransformation T;
+   IsoparametricTransformation T_ref;
+   Vector x, x_ref;
+   DenseMatrix X, X_ref;
+   for (int e = e_begin; e < e_end; e++)
+   {
+      REQUIRE(batch.IsBatched(e));
+      batch.GetElementTransformation(e, &T);
+      mesh.GetElementTransformation(e, &T_ref);
+      REQUIRE(T.ElementNo == e);
+      REQUIRE(T.Attribute == T_ref.Attribute);
+      REQUIRE(T.OrderW() == T_ref.OrderW());
+
+      for (int q = 0; q <= ir.GetNPoints(); q++)
+      {
+         // The last point is not in the rule and is evaluated directly.
+         const IntegrationPoint &ip = (q < ir.GetNPoints()) ? ir.IntPoint(q)
+                                      : off_ip;
+         T.SetIntPoint(&ip);
+         T_ref.SetIntPoint(&ip);
+
+         REQUIRE(T.Weight() == MFEM_Approx(T_ref.Weight()));
+         DenseMatrix J(T.Jacobian());
+         J -= T_ref.Jacobian();
+         REQUIRE(J.MaxMaxNorm() == MFEM_Approx(0.0));
+         DenseMatrix A(T.AdjugateJacobian());
+         A -= T_ref.AdjugateJacobian();
+         REQUIRE(A.MaxMaxNorm() == MFEM_Approx(0.0));
+         DenseMatrix I(T.InverseJacobian());
+         I -= T_ref.InverseJacobian();
+         REQUIRE(I.MaxMaxNorm() == MFEM_Approx(0.0));
+
+         T.Transform(ip, x);
+         T_ref.Transform(ip, x_ref);
+         x -= x_ref;
+         REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
+      }
+
+      T.Transform(ir, X);
+      T_ref.Transform(ir, X_ref);
+      X -= X_ref;
+      REQUIRE(X.MaxMaxNorm() == MFEM_Approx(0.0));
+   }
+}
+
+TEST_CASE("ElementTransformationBatch Assembly", "[ElementTransformation]")
+{
+   const int order = GENERATE(1, 3);
+   const int curvature = GENERATE(0, 2);
+   CAPTURE(order, curvature);
+
+   Mesh mesh = MakeMesh(2, Element::QUADRILATERAL, curvature, 2);
+   H1_FECollection fec(order, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   // The integrators use their default rules, so that Assemble() evaluates
+   // the transformations in batches, and the coefficient uses the physical
+   // points. The element markers select the element-by-element assembly loop.
+   FunctionCoefficient coeff([](const Vector &x) { return 1.0 + x(0)*x(1); });
+   MassIntegrator *mass = new MassIntegrator(coeff);
+   DiffusionIntegrator *diff = new DiffusionIntegrator(coeff);
+   Array<int> marker(mesh.attributes.Max());
+   marker = 1;
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(mass, marker);
+   a.AddDomainIntegrator(diff, marker);
+   a.Assemble();
+   a.Finalize();
+
+   SparseMatrix A_ref(fes.GetVSize());
+   Array<int> vdofs;
+   DenseMatrix elmat, elmat2;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      const FiniteElement &fe = *fes.GetFE(e);
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      mass->AssembleElementMatrix(fe, T, elmat);
+      diff->AssembleElementMatrix(fe, T, elmat2);
+      elmat += elmat2;
+      fes.GetElementVDofs(e, vdofs);
+      A_ref.AddSubMatrix(vdofs, vdofs, elmat);
+   }
+   A_ref.Finalize();
+
+   Vector x(fes.GetVSize()), y(fes.GetVSize()), y_ref(fes.GetVSize());
+   x.Randomize(1);
+   a.Mult(x, y);
+   A_ref.Mult(x, y_ref);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+}
+
+} // namespace eltrans_batch
@@ -4950,4 +4950,85 @@ TEST_CASE("3D GetDivergence",
              << npts << " 3D points" << std::endl;
 }
 
+void Curve_Transform(const Vector &x, Vector &y)
+{
+   y = x;
+   y(0) += 0.05 * sin(M_PI * x(1));
+   y(1) += 0.05 * sin(M_PI * x(0));
+}
+
+TEST_CASE("GetPointValues",
+          "[GridFunction]")
+{
+   const auto type = GENERATE(Element::QUADRILATERAL, Element::TRIANGLE,
+                              Element::HEXAHEDRON);
+   const int order = GENERATE(1, 3);
+   const int vdim = GENERATE(1, 2);
+   const bool l2 = GENERATE(false, true);
+   const bool curved = GENERATE(false, true);
+   CAPTURE(type, order, vdim, l2, curved);
+
+   Mesh mesh = (type == Element::HEXAHEDRON) ?
+               Mesh::MakeCartesian3D(2, 2, 2, type, 1.0, 1.0, 1.0) :
+               Mesh::MakeCartesian2D(3, 2, type, 1, 1.0, 1.0);
+   const int dim = mesh.Dimension();
+   if (curved)
+   {
+      mesh.SetCurvature(2);
+      mesh.Transform(Curve_Transform);
+   }
+
+   H1_FECollection h1_fec(order, dim);
+   L2_FECollection l2_fec(order, dim);
+   FiniteElementCollection *fec = l2 ? (FiniteElementCollection*)&l2_fec :
+                                  (FiniteElementCollection*)&h1_fec;
+   FiniteElementSpace fes(&mesh, fec, vdim, Ordering::byVDIM);
+   GridFunction x(&fes);
+   x.Randomize(1);
+
+   // Points inside the reference elements, the last one is not found
+   const int npts = 40;
+   Array<int> elem_ids(npts);
+   Array<IntegrationPoint> ips(npts);
+   for (int k = 0; k < npts; k++)
+   {
+      elem_ids[k] = (k < npts - 1) ? k % mesh.GetNE() : -1;
+      ips[k].x = 0.1 + 0.03 * ((7 * k) % 10);
+      ips[k].y = 0.1 + 0.03 * ((3 * k) % 10);
+      ips[k].z = 0.1 + 0.03 * ((9 * k) % 10);
+   }
+
+   Vector vals, grads;
+   x.GetPointValues(elem_ids, ips, vals, Ordering::byVDIM);
+   x.GetPointGradients(elem_ids, ips, grads);
+   vals.HostRead();
+   grads.HostRead();
+   REQUIRE(vals.Size() == vdim * npts);
+   REQUIRE(grads.Size() == vdim * dim * npts);
+
+   IsoparametricTransformation T;
+   Vector val;
+   DenseMatrix grad;
+   for (int k = 0; k < npts; k++)
+   {
+      if (elem_ids[k] < 0)
+      {
+         for (int c = 0; c < vdim; c++) { REQUIRE(vals(c + vdim*k) == 0.0); }
+         continue;
+      }
+      mesh.GetElementTransformation(elem_ids[k], &T);
+      T.SetIntPoint(&ips[k]);
+      x.GetVectorValue(T, ips[k], val);
+      x.GetVectorGradient(T, grad);
+      for (int c = 0; c < vdim; c++)
+      {
+         REQUIRE(vals(c + vdim*k) == MFEM_Approx(val(c)));
+         for (int d = 0; d < dim; d++)
+         {
+            REQUIRE(grads(k + npts*(c + vdim*d)) == MFEM_Approx(grad(c,d)));
+         }
+      }
+   }
+}
+
 } // namespace get_value
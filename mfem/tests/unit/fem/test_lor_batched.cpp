@@ -11,6 +11,7 @@
 
 #include "mfem.hpp"
 #include "unit_tests.hpp"
+#include "../../fem/lor/lor_batched.hpp"
 #include "../../fem/lor/lor_ads.hpp"
 #include "../../fem/lor/lor_ams.hpp"
 #include <memory>
@@ -141,6 +142,58 @@ TEST_CASE("LOR Batched H1", "[LOR][BatchedLOR][CUDA]")
    TestBatchedLOR<H1_FECollection,MassIntegrator,DiffusionIntegrator>();
 }
 
+TEST_CASE("LOR Batched H1 Vector", "[LOR][BatchedLOR][CUDA]")
+{
+   const int order = 4;
+   const auto mesh_fname = GENERATE(
+                              "../../data/star-q3.mesh",
+                              "../../data/fichera-q3.mesh"
+                           );
+   const bool elasticity = GENERATE(true, false);
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+
+   Mesh mesh = Mesh::LoadFromFile(mesh_fname);
+   const int dim = mesh.Dimension();
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fespace(&mesh, &fec, dim, ordering);
+
+   Array<int> ess_dofs;
+   fespace.GetBoundaryTrueDofs(ess_dofs);
+
+   H1_FECollection h1fec(2, dim);
+   FiniteElementSpace h1fes(&mesh, &h1fec);
+   GridFunction gf1(&h1fes), gf2(&h1fes), gf3(&h1fes);
+   gf1.Randomize(1);
+   gf2.Randomize(2);
+   gf3.Randomize(3);
+
+   GridFunctionCoefficient mass_coeff(&gf1);
+   GridFunctionCoefficient lambda_coeff(&gf2);
+   GridFunctionCoefficient mu_coeff(&gf3);
+
+   BilinearForm a(&fespace);
+   a.AddDomainIntegrator(new VectorMassIntegrator(mass_coeff));
+   if (elasticity)
+   {
+      a.AddDomainIntegrator(new ElasticityIntegrator(lambda_coeff, mu_coeff));
+   }
+   else
+   {
+      a.AddDomainIntegrator(new VectorDiffusionIntegrator(mu_coeff));
+   }
+   REQUIRE(BatchedLORAssembly::FormIsSupported(a));
+
+   LORDiscretization lor(fespace);
+   lor.LegacyAssembleSystem(a, ess_dofs);
+   SparseMatrix A1 = lor.GetAssembledMatrix(); // deep copy
+   lor.AssembleSystem(a, ess_dofs);
+   SparseMatrix &A2 = lor.GetAssembledMatrix();
+
+   TestSameMatrices(A1, A2);
+   TestSameMatrices(A2, A1);
+}
+
 TEST_CASE("LOR Batched ND", "[LOR][BatchedLOR][CUDA]")
 {
    TestBatchedLOR<ND_FECollection,VectorFEMassIntegrator,CurlCurlIntegrator>();
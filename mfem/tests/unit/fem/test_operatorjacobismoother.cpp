@@ -138,3 +138,89 @@ TEST_CASE("OperatorJacobiSmoother Fichera", "[OperatorJacobiSmoother]")
       }
    }
 }
+
+TEST_CASE("EABlockJacobiSmoother", "[OperatorJacobiSmoother]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2, 3);
+   CAPTURE(dim, order);
+
+   const int ne = 3;
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(ne, ne, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(ne, ne, ne, Element::HEXAHEDRON);
+   ConstantCoefficient one(1.0);
+
+   SECTION("DG mass")
+   {
+      // The mass matrix is block diagonal: the smoother is its inverse
+      L2_FECollection fec(order, dim);
+      FiniteElementSpace fes(&mesh, &fec);
+      BilinearForm m(&fes);
+      m.SetAssemblyLevel(AssemblyLevel::ELEMENT);
+      m.AddDomainIntegrator(new MassIntegrator(one));
+      m.Assemble();
+      Array<int> empty;
+      EABlockJacobiSmoother smoother(m, empty);
+
+      Vector x(fes.GetTrueVSize()), y(x.Size()), z(x.Size());
+      x.Randomize(1);
+      smoother.Mult(x, y);
+      m.Mult(y, z);
+      z -= x;
+      REQUIRE(z.Normlinf() <= 1e-10 * x.Normlinf());
+   }
+
+   SECTION("H1 diffusion")
+   {
+      H1_FECollection fec(order, dim);
+      FiniteElementSpace fes(&mesh, &fec);
+      Array<int> ess_tdof_list, ess_bdr(mesh.bdr_attributes.Max());
+      ess_bdr = 1;
+      fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+      BilinearForm a(&fes);
+      a.SetAssemblyLevel(AssemblyLevel::ELEMENT);
+      a.AddDomainIntegrator(new DiffusionIntegrator(one));
+      a.Assemble();
+      EABlockJacobiSmoother smoother(a, ess_tdof_list);
+
+      // The smoother is symmetric
+      Vector u(fes.GetTrueVSize()), v(u.Size()), Su(u.Size()), Sv(u.Size());
+      u.Randomize(1);
+      v.Randomize(2);
+      smoother.Mult(u, Su);
+      smoother.Mult(v, Sv);
+      REQUIRE((Su*v) == MFEM_Approx(u*Sv));
+      for (int i : ess_tdof_list) { REQUIRE(Su(i) == u(i)); }
+   }
+
+   SECTION("H1 collocated mass")
+   {
+      // With the Gauss-Lobatto basis and quadrature points the element
+      // matrices are diagonal: the smoother is the Jacobi smoother
+      H1_FECollection fec(order, dim);
+      FiniteElementSpace fes(&mesh, &fec);
+      Array<int> ess_tdof_list, ess_bdr(mesh.bdr_attributes.Max());
+      ess_bdr = 0;
+      ess_bdr[0] = 1;
+      fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+      IntegrationRules gll_rules(0, Quadrature1D::GaussLobatto);
+      const IntegrationRule &ir =
+         gll_rules.Get(mesh.GetElementGeometry(0), 2*order - 1);
+      BilinearForm m(&fes);
+      m.SetAssemblyLevel(AssemblyLevel::ELEMENT);
+      m.AddDomainIntegrator(new MassIntegrator(one, &ir));
+      m.Assemble();
+      EABlockJacobiSmoother smoother(m, ess_tdof_list);
+      OperatorJacobiSmoother jacobi(m, ess_tdof_list);
+
+      Vector x(fes.GetTrueVSize()), y(x.Size()), y_jacobi(x.Size());
+      x.Randomize(1);
+      smoother.Mult(x, y);
+      jacobi.Mult(x, y_jacobi);
+      y -= y_jacobi;
+      REQUIRE(y.Normlinf() <= 1e-12 * y_jacobi.Normlinf());
+   }
+}
@@ -11,6 +11,8 @@
 
 #include "unit_tests.hpp"
 #include "mfem.hpp"
+#include "../../fem/integ/bilininteg_diffusion_kernels.hpp"
+#include "../../fem/integ/bilininteg_mass_kernels.hpp"
 
 #include <fstream>
 #include <iostream>
@@ -573,6 +575,250 @@ TEST_CASE("PA Diffusion", "[PartialAssembly], [CUDA]")
    test_pa_integrator<DiffusionIntegrator>();
 } // PA Diffusion test case
 
+template <typename INTEGRATOR>
+static void test_pa_non_tensor(FiniteElementSpace &fes, INTEGRATOR *integ_fa,
+                               INTEGRATOR *integ_pa)
+{
+   GridFunction x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+
+   BilinearForm blf_fa(&fes);
+   blf_fa.AddDomainIntegrator(integ_fa);
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+   blf_fa.Mult(x, y_fa);
+
+   BilinearForm blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_pa.AddDomainIntegrator(integ_pa);
+   blf_pa.Assemble();
+   blf_pa.Mult(x, y_pa);
+
+   y_fa -= y_pa;
+   REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
+
+   Vector diag_fa(fes.GetTrueVSize()), diag_pa(fes.GetTrueVSize());
+   blf_fa.AssembleDiagonal(diag_fa);
+   blf_pa.AssembleDiagonal(diag_pa);
+   diag_fa -= diag_pa;
+   REQUIRE(diag_fa.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("PA Non-Tensor", "[PartialAssembly]")
+{
+   auto fname = GENERATE("../../data/beam-tri.mesh", "../../data/beam-tet.mesh",
+                         "../../data/beam-wedge.mesh");
+   auto order = GENERATE(1, 2, 3);
+
+   Mesh mesh(fname);
+   const int dim = mesh.Dimension();
+   // Use curved, non-affine elements
+   mesh.SetCurvature(order);
+   GridFunction &nodes = *mesh.GetNodes();
+   Vector pert(nodes.Size());
+   pert.Randomize(1);
+   nodes.Add(0.01, pert);
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   FunctionCoefficient coeff(f1);
+
+   SECTION("Mass")
+   {
+      test_pa_non_tensor(fes, new MassIntegrator(coeff), new MassIntegrator(coeff));
+   }
+   SECTION("Diffusion")
+   {
+      test_pa_non_tensor(fes, new DiffusionIntegrator(coeff),
+                         new DiffusionIntegrator(coeff));
+   }
+   SECTION("Diffusion (matrix coefficient)")
+   {
+      auto M = [](const Vector &x, DenseMatrix &m)
+      {
+         const int d = x.Size();
+         for (int i = 0; i < d; i++)
+         {
+            for (int j = 0; j < d; j++)
+            {
+               m(i,j) = (i == j) ? 2.0 + x(i)*x(i) : 0.1*(i+1) + 0.2*x(j);
+            }
+         }
+      };
+      MatrixFunctionCoefficient mcoeff(dim, M);
+      test_pa_non_tensor(fes, new DiffusionIntegrator(mcoeff),
+                         new DiffusionIntegrator(mcoeff));
+   }
+   SECTION("Vector Mass")
+   {
+      FiniteElementSpace vfes(&mesh, &fec, dim);
+      ConstantCoefficient c(2.5);
+      test_pa_non_tensor(vfes, new VectorMassIntegrator(c),
+                         new VectorMassIntegrator(c));
+   }
+}
+
+// The action of an integrator on a subset of the elements, as used by
+// ParPAOverlapOperator, gives the corresponding blocks of the full action and
+// leaves the other blocks unchanged.
+static void test_pa_elements(FiniteElementSpace &fes,
+                             BilinearFormIntegrator *integ)
+{
+   std::unique_ptr<BilinearFormIntegrator> integ_ptr(integ);
+   REQUIRE(integ->SupportsPAElements());
+   integ->AssemblePA(fes);
+
+   const int ne = fes.GetNE();
+   const int nd = fes.GetFE(0)->GetDof();
+   Vector x(nd*ne), y(nd*ne), y_sub(nd*ne);
+   x.Randomize(1);
+   y = 0.0;
+   integ->AddMultPA(x, y);
+
+   // Every other element, in reverse order
+   Array<int> elems;
+   Array<bool> listed(ne);
+   listed = false;
+   for (int e = ne - 1; e >= 0; e -= 2) { elems.Append(e); listed[e] = true; }
+   for (int transpose = 0; transpose < 2; transpose++)
+   {
+      y_sub = 0.0;
+      if (transpose) { integ->AddMultTransposePAElements(elems, x, y_sub); }
+      else { integ->AddMultPAElements(elems, x, y_sub); }
+      y.HostRead();
+      y_sub.HostReadWrite();
+      for (int e = 0; e < ne; e++)
+      {
+         if (!listed[e]) { continue; }
+         for (int i = 0; i < nd; i++) { y_sub(i + nd*e) -= y(i + nd*e); }
+      }
+      REQUIRE(y_sub.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
+TEST_CASE("PA Element Subsets", "[PartialAssembly]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const bool simplex = GENERATE(false, true);
+   CAPTURE(dim, order, simplex);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, simplex ? Element::TRIANGLE :
+                                     Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, simplex ? Element::TETRAHEDRON :
+                                     Element::HEXAHEDRON);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   FunctionCoefficient coeff(f1);
+
+   test_pa_elements(fes, new MassIntegrator(coeff));
+   test_pa_elements(fes, new DiffusionIntegrator(coeff));
+}
+
+template <typename INTEGRATOR>
+static double test_pa_specialization(int dim, int order, int q1d)
+{
+   Mesh mesh = dim == 2 ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   mesh.SetCurvature(order);
+   GridFunction &nodes = *mesh.GetNodes();
+   Vector pert(nodes.Size());
+   pert.Randomize(1);
+   nodes.Add(0.02, pert);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   const IntegrationRule &ir =
+      IntRules.Get(mesh.GetElementGeometry(0), 2*q1d - 1);
+
+   GridFunction x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+
+   BilinearForm blf_fa(&fes);
+   blf_fa.AddDomainIntegrator(new INTEGRATOR(&ir));
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+   blf_fa.Mult(x, y_fa);
+
+   BilinearForm blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_pa.AddDomainIntegrator(new INTEGRATOR(&ir));
+   blf_pa.Assemble();
+   blf_pa.Mult(x, y_pa);
+
+   y_fa -= y_pa;
+   return y_fa.Normlinf();
+}
+
+static int kernel_dispatch_fallback(int, int) { return 0; }
+
+template <int D1D, int Q1D>
+static int kernel_dispatch_specialized(int, int) { return 100*D1D + Q1D; }
+
+TEST_CASE("Kernel Dispatch Table", "[PartialAssembly]")
+{
+   using TestKernel = int (*)(int, int);
+   KernelDispatchTable<TestKernel> table(&kernel_dispatch_fallback);
+   REQUIRE(table.Size() == 0);
+   REQUIRE_FALSE(table.Has(3,5));
+   REQUIRE(table.Get(3,5)(3,5) == 0);
+
+   table.Add(3, 5, &kernel_dispatch_specialized<3,5>);
+   table.Add(5, 3, &kernel_dispatch_specialized<5,3>);
+   // Sizes with Q1D >= 16 must not alias other sizes.
+   table.Add(2, 17, &kernel_dispatch_specialized<2,17>);
+   REQUIRE(table.Size() == 3);
+   REQUIRE(table.Has(3,5));
+   REQUIRE(table.Get(3,5)(3,5) == 305);
+   REQUIRE(table.Get(5,3)(5,3) == 503);
+   REQUIRE(table.Get(2,17)(2,17) == 217);
+   REQUIRE_FALSE(table.Has(3,1));
+   REQUIRE(table.Get(3,1)(3,1) == 0);
+
+   table.Add(3, 5, &kernel_dispatch_specialized<4,6>);
+   REQUIRE(table.Size() == 3);
+   REQUIRE(table.Get(3,5)(3,5) == 406);
+
+   table.Remove(3, 5);
+   REQUIRE_FALSE(table.Has(3,5));
+   REQUIRE(table.Get(3,5)(3,5) == 0);
+}
+
+TEST_CASE("PA Kernel Specializations", "[PartialAssembly]")
+{
+   using namespace internal;
+
+   // Over-integrated sizes that are not specialized by default (they may be
+   // requested with MFEM_PA_KERNELS). The global tables are restored at the
+   // end so that the other tests are not affected.
+   auto &diff_kernels = PADiffusionApplyKernels(3);
+   const bool diff_had = diff_kernels.Has(3,5);
+   const auto diff_kernel = diff_kernels.Get(3,5);
+   auto &mass_kernels = PAMassApplyKernels(2);
+   const bool mass_had = mass_kernels.Has(3,7);
+   const auto mass_kernel = mass_kernels.Get(3,7);
+
+   diff_kernels.Remove(3,5);
+   REQUIRE(test_pa_specialization<DiffusionIntegrator>(3, 2, 5) ==
+           MFEM_Approx(0.0));
+   AddPADiffusionApplySpecialization<3,3,5>();
+   REQUIRE(diff_kernels.Has(3,5));
+   REQUIRE(test_pa_specialization<DiffusionIntegrator>(3, 2, 5) ==
+           MFEM_Approx(0.0));
+
+   mass_kernels.Remove(3,7);
+   REQUIRE(test_pa_specialization<MassIntegrator>(2, 2, 7) == MFEM_Approx(0.0));
+   AddPAMassApplySpecialization<2,3,7>();
+   REQUIRE(mass_kernels.Has(3,7));
+   REQUIRE(test_pa_specialization<MassIntegrator>(2, 2, 7) == MFEM_Approx(0.0));
+
+   diff_kernels.Remove(3,5);
+   if (diff_had) { diff_kernels.Add(3, 5, diff_kernel); }
+   mass_kernels.Remove(3,7);
+   if (mass_had) { mass_kernels.Add(3, 7, mass_kernel); }
+}
+
 TEST_CASE("PA Markers", "[PartialAssembly], [CUDA]")
 {
    const bool all_tests = launch_all_non_regression_tests;
@@ -664,4 +910,158 @@ TEST_CASE("PA Boundary Mass", "[PartialAssembly], [CUDA]")
    REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("PA DG Diffusion", "[PartialAssembly], [CUDA]")
+{
+   const bool all_tests = launch_all_non_regression_tests;
+
+   auto fname = GENERATE("../../data/star.mesh", "../../data/star-q3.mesh",
+                         "../../data/periodic-square.mesh",
+                         "../../data/fichera.mesh", "../../data/fichera-q3.mesh");
+   auto order = !all_tests ? GENERATE(1, 3) : GENERATE(1, 2, 3, 4);
+   auto sigma = GENERATE(-1.0, 1.0);
+   auto coeff_type = GENERATE(0, 1, 2); // none, scalar, matrix
+   CAPTURE(fname, order, sigma, coeff_type);
+
+   Mesh mesh(fname);
+   int dim = mesh.Dimension();
+   L2_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   FunctionCoefficient q([](const Vector &x) { return 1.0 + x(0)*x(0); });
+   MatrixFunctionCoefficient mq(dim, [](const Vector &x, DenseMatrix &m)
+   {
+      m.Diag(1.0 + x(0)*x(0), x.Size());
+      m(0,1) = 0.1*x(1);
+      m(1,0) = 0.2;
+   });
+   const double kappa = (order+1)*(order+1);
+   auto new_integ = [&]() -> BilinearFormIntegrator*
+   {
+      switch (coeff_type)
+      {
+         case 1: return new DGDiffusionIntegrator(q, sigma, kappa);
+         case 2: return new DGDiffusionIntegrator(mq, sigma, kappa);
+         default: return new DGDiffusionIntegrator(sigma, kappa);
+      }
+   };
+
+   // The boundary faces with odd attributes are left out.
+   for (int i = 0; i < mesh.GetNBE(); ++i) { mesh.SetBdrAttribute(i, 1 + i%2); }
+   mesh.SetAttributes();
+   Array<int> marker(2);
+   marker[0] = 1;
+   marker[1] = 0;
+
+   BilinearForm blf_fa(&fes), blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   for (BilinearForm *blf : {&blf_fa, &blf_pa})
+   {
+      blf->AddInteriorFaceIntegrator(new_integ());
+      blf->AddBdrFaceIntegrator(new_integ(), marker);
+      blf->Assemble();
+   }
+   blf_fa.Finalize();
+
+   GridFunction x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+
+   blf_fa.Mult(x, y_fa);
+   blf_pa.Mult(x, y_pa);
+   y_fa -= y_pa;
+   REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
+
+   blf_fa.MultTranspose(x, y_fa);
+   blf_pa.MultTranspose(x, y_pa);
+   y_fa -= y_pa;
+   REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
+}
+
+// Mass integrator counting the calls to AssemblePA() and AssemblePAUpdate(),
+// so that the fallback of AssemblePAUpdate() to AssemblePA() is detected.
+class CountingMassIntegrator : public MassIntegrator
+{
+public:
+   int num_assemble = 0, num_update = 0;
+
+   CountingMassIntegrator(Coefficient &q) : MassIntegrator(q) { }
+
+   using MassIntegrator::AssemblePA;
+   virtual void AssemblePA(const FiniteElementSpace &fes)
+   {
+      num_assemble++;
+      MassIntegrator::AssemblePA(fes);
+   }
+
+   virtual void AssemblePAUpdate(const FiniteElementSpace &fes,
+                                 const Array<int> &old_elem)
+   {
+      num_update++;
+      MassIntegrator::AssemblePAUpdate(fes, old_elem);
+   }
+};
+
+TEST_CASE("PA Incremental Update", "[PartialAssembly], [AMR]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const bool simplex = GENERATE(false, true);
+   CAPTURE(dim, order, simplex);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, simplex ? Element::TRIANGLE :
+                                     Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, simplex ? Element::TETRAHEDRON :
+                                     Element::HEXAHEDRON);
+   mesh.EnsureNCMesh(true);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   FunctionCoefficient coeff(f1);
+   BilinearForm blf_inc(&fes), blf_full(&fes);
+   blf_inc.EnableIncrementalPAUpdate();
+   auto *mass_inc = new CountingMassIntegrator(coeff);
+   blf_inc.AddDomainIntegrator(mass_inc);
+   blf_full.AddDomainIntegrator(new MassIntegrator(coeff));
+   for (BilinearForm *blf : {&blf_inc, &blf_full})
+   {
+      blf->SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      blf->AddDomainIntegrator(new DiffusionIntegrator(coeff));
+      blf->Assemble();
+   }
+
+   // Two refinements, followed by a derefinement of the refined elements
+   for (int it = 0; it < 3; it++)
+   {
+      if (it < 2)
+      {
+         Array<int> refs;
+         refs.Append(0);
+         refs.Append(mesh.GetNE() - 1);
+         mesh.GeneralRefinement(refs);
+      }
+      else
+      {
+         Vector errors(mesh.GetNE());
+         errors = 0.0;
+         REQUIRE(mesh.DerefineByError(errors, 1.0));
+      }
+      fes.Update(false);
+      for (BilinearForm *blf : {&blf_inc, &blf_full})
+      {
+         blf->Update();
+         blf->Assemble();
+      }
+      // The data was updated, not assembled again
+      REQUIRE(mass_inc->num_assemble == 1);
+      REQUIRE(mass_inc->num_update == it + 1);
+
+      GridFunction x(&fes), y_inc(&fes), y_full(&fes);
+      x.Randomize(1);
+      blf_inc.Mult(x, y_inc);
+      blf_full.Mult(x, y_full);
+      y_inc -= y_full;
+      REQUIRE(y_inc.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
 } // namespace pa_kernels
@@ -0,0 +1,156 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace patch_assembly
+{
+
+// Tensor product rules on each patch, obtained by applying the 1D rule of the
+// given order to each knot interval.
+NURBSMeshRules *MakePatchRules(Mesh &mesh, int ir_order)
+{
+   const int dim = mesh.Dimension();
+   NURBSMeshRules *patchRule = new NURBSMeshRules(mesh.NURBSext->GetNP(), dim);
+   for (int p=0; p<mesh.NURBSext->GetNP(); ++p)
+   {
+      Array<const KnotVector*> kv(dim);
+      mesh.NURBSext->GetPatchKnotVectors(p, kv);
+
+      std::vector<const IntegrationRule*> ir1D(dim);
+      const IntegrationRule *ir = &IntRules.Get(Geometry::SEGMENT, ir_order);
+      for (int i=0; i<dim; ++i)
+      {
+         ir1D[i] = ir->ApplyToKnotIntervals(*kv[i]);
+      }
+      patchRule->SetPatchRules1D(p, ir1D);
+   }
+   patchRule->Finalize(mesh);
+   return patchRule;
+}
+
+// Compare the patch-wise partial assembly of the integrator with the
+// element-wise full assembly, using the same integration points.
+void TestPatchPA(FiniteElementSpace &fes, BilinearFormIntegrator *integ_pa,
+                 BilinearFormIntegrator *integ_fa, NURBSMeshRules *patchRule,
+                 const IntegrationRule &ir, NonlinearFormIntegrator::Mode mode,
+                 double tol)
+{
+   integ_pa->SetIntegrationMode(mode);
+   integ_pa->SetNURBSPatchIntRule(patchRule);
+   integ_fa->SetIntRule(&ir);
+
+   BilinearForm a_pa(&fes), a_fa(&fes);
+   a_pa.AddDomainIntegrator(integ_pa);
+   a_fa.AddDomainIntegrator(integ_fa);
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_pa.Assemble();
+   a_fa.Assemble();
+   a_fa.Finalize();
+
+   GridFunction x(&fes), y_pa(&fes), y_fa(&fes);
+   x.Randomize(1);
+
+   a_pa.Mult(x, y_pa);
+   a_fa.Mult(x, y_fa);
+
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() <= tol * y_fa.Normlinf());
+}
+
+double coeff_function(const Vector &x)
+{
+   return 1.0 + x(0)*x(0) + 0.5*x(1)*x(2);
+}
+
+void matrix_coeff_function(const Vector &x, DenseMatrix &m)
+{
+   m.SetSize(3);
+   for (int i = 0; i < 3; i++)
+   {
+      for (int j = 0; j < 3; j++)
+      {
+         m(i,j) = (i == j) ? 2.0 + x(i) : 0.1 * (i + 2*j) * x(0);
+      }
+   }
+}
+
+TEST_CASE("NURBS patch partial assembly", "[NURBS][PartialAssembly]")
+{
+   const int degree_increase = GENERATE(0, 1);
+
+   Mesh mesh("../../data/beam-hex-nurbs.mesh", 1, 1);
+   if (degree_increase > 0) { mesh.DegreeElevate(degree_increase); }
+   mesh.UniformRefinement();
+
+   const FiniteElementCollection *fec = mesh.GetNodes()->OwnFEC();
+   const int order = fec->GetOrder();
+   const int ir_order = 2*order + 2;
+   const IntegrationRule &ir = IntRules.Get(Geometry::CUBE, ir_order);
+   NURBSMeshRules *patchRule = MakePatchRules(mesh, ir_order);
+
+   const auto mode = NonlinearFormIntegrator::Mode::PATCHWISE;
+
+   FunctionCoefficient q(coeff_function);
+   FunctionCoefficient mu(coeff_function);
+   ConstantCoefficient lambda(2.5);
+   MatrixFunctionCoefficient mq(3, matrix_coeff_function);
+
+   SECTION("MassIntegrator")
+   {
+      FiniteElementSpace fes(&mesh, fec);
+      TestPatchPA(fes, new MassIntegrator(q), new MassIntegrator(q),
+                  patchRule, ir, mode, 1e-12);
+   }
+
+   SECTION("VectorMassIntegrator")
+   {
+      FiniteElementSpace fes(&mesh, fec, 3);
+      TestPatchPA(fes, new VectorMassIntegrator(q), new VectorMassIntegrator(q),
+                  patchRule, ir, mode, 1e-12);
+      TestPatchPA(fes, new VectorMassIntegrator(mq),
+                  new VectorMassIntegrator(mq), patchRule, ir, mode, 1e-12);
+   }
+
+   SECTION("ElasticityIntegrator")
+   {
+      FiniteElementSpace fes(&mesh, fec, 3);
+      TestPatchPA(fes, new ElasticityIntegrator(lambda, mu),
+                  new ElasticityIntegrator(lambda, mu),
+                  patchRule, ir, mode, 1e-12);
+      TestPatchPA(fes, new ElasticityIntegrator(mu, 1.5, 0.5),
+                  new ElasticityIntegrator(mu, 1.5, 0.5),
+                  patchRule, ir, mode, 1e-12);
+   }
+
+#ifdef MFEM_USE_LAPACK
+   SECTION("Reduced quadrature")
+   {
+      // With constant coefficients on this affine mesh, the reduced rules
+      // integrate the mass matrix exactly.
+      ConstantCoefficient one(1.0);
+      const auto reduced = NonlinearFormIntegrator::Mode::PATCHWISE_REDUCED;
+      FiniteElementSpace fes(&mesh, fec);
+      TestPatchPA(fes, new MassIntegrator(one), new MassIntegrator(one),
+                  patchRule, ir, reduced, 1e-8);
+      FiniteElementSpace vfes(&mesh, fec, 3);
+      TestPatchPA(vfes, new VectorMassIntegrator(one),
+                  new VectorMassIntegrator(one), patchRule, ir, reduced, 1e-8);
+   }
+#endif
+
+   delete patchRule;
+}
+
+} // namespace patch_assembly
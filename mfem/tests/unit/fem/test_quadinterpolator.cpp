@@ -337,3 +337,66 @@ TEST_CASE("QuadratureInterpolator", "[QuadratureInterpolator][CUDA]")
       }
    }
 }
+
+TEST_CASE("QuadratureInterpolator MultTranspose",
+          "[QuadratureInterpolator][CUDA]")
+{
+   using QI = QuadratureInterpolator;
+   const auto mesh_fname = GENERATE(
+                              "../../data/inline-segment.mesh",
+                              "../../data/inline-quad.mesh",
+                              "../../data/inline-tri.mesh",
+                              "../../data/star-q3.mesh",
+                              "../../data/inline-hex.mesh",
+                              "../../data/inline-tet.mesh",
+                              "../../data/fichera-q3.mesh",
+                              "../../data/star-surf.mesh" // surface mesh
+                           );
+   const int order = GENERATE(1, 2, 3);
+   const bool tensor = GENERATE(true, false);
+   const auto l = GENERATE(QVectorLayout::byNODES, QVectorLayout::byVDIM);
+   const unsigned flags = GENERATE(QI::VALUES, QI::DERIVATIVES,
+                                   QI::PHYSICAL_DERIVATIVES,
+                                   QI::VALUES | QI::DERIVATIVES,
+                                   QI::VALUES | QI::PHYSICAL_DERIVATIVES);
+
+   Mesh mesh = Mesh::LoadFromFile(mesh_fname);
+   const int dim = mesh.Dimension();
+   const int sdim = mesh.SpaceDimension();
+   // Non-tensor physical derivatives require a square element Jacobian
+   if (!tensor && dim != sdim && (flags & QI::PHYSICAL_DERIVATIVES)) { return; }
+   H1_FECollection fec(order, dim);
+
+   for (int vdim : {1, sdim})
+   {
+      FiniteElementSpace fes(&mesh, &fec, vdim);
+      const IntegrationRule &ir =
+         IntRules.Get(mesh.GetElementBaseGeometry(0), 2*order + 1);
+      const QuadratureInterpolator *qi = fes.GetQuadratureInterpolator(ir);
+      qi->SetOutputLayout(l);
+      if (tensor) { qi->EnableTensorProducts(); }
+      else { qi->DisableTensorProducts(); }
+
+      const int NE = mesh.GetNE();
+      const int NQ = ir.GetNPoints();
+      const int ND = fes.GetFE(0)->GetDof();
+      const int nder = (flags & QI::PHYSICAL_DERIVATIVES) ? sdim : dim;
+
+      Vector x(ND*vdim*NE), y(ND*vdim*NE);
+      Vector q_val(NQ*vdim*NE), q_der(NQ*vdim*nder*NE), q_det;
+      Vector w_val(q_val.Size()), w_der(q_der.Size());
+      x.Randomize(1);
+      w_val.Randomize(2);
+      w_der.Randomize(3);
+      q_val = 0.0;
+      q_der = 0.0;
+
+      // <Mult(x), w> = <x, MultTranspose(w)>
+      qi->Mult(x, flags, q_val, q_der, q_det);
+      qi->MultTranspose(flags, w_val, w_der, y);
+
+      const double lhs = (q_val*w_val) + (q_der*w_der);
+      const double rhs = x*y;
+      REQUIRE(lhs == MFEM_Approx(rhs));
+   }
+}
@@ -0,0 +1,37 @@
+// Copyright (c) 2010-2023, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("HashTable Reserve", "[HashTable]")
+{
+   const int n = 1000;
+   HashTable<Hashed2> table;
+
+   // Reserving with items already in the table rehashes them
+   for (int i = 0; i < n/2; i++) { REQUIRE(table.GetId(i, i+1) == i); }
+   table.Reserve(2*n);
+   for (int i = n/2; i < n; i++) { REQUIRE(table.GetId(i, i+1) == i); }
+
+   REQUIRE(table.Size() == n);
+   for (int i = 0; i < n; i++)
+   {
+      REQUIRE(table.FindId(i+1, i) == i);
+      REQUIRE(table.FindId(i, i+2) == -1);
+   }
+
+   // Reserving less than the current capacity does nothing
+   table.Reserve(1);
+   for (int i = 0; i < n; i++) { REQUIRE(table.FindId(i, i+1) == i); }
+}
@@ -314,6 +314,60 @@ TEST_CASE("DenseTensor LinearSolve methods",
    }
 }
 
+TEST_CASE("Batched interleaved kernels", "[DenseMatrix]")
+{
+   const int dim = GENERATE(2, 3, 4, 8, 27);
+   const int n = 7, NB = 3;
+   CAPTURE(dim);
+
+   // Symmetric positive definite matrices, so that they are invertible, with
+   // the first two rows swapped for the larger sizes to exercise pivoting.
+   Vector A(n*dim*dim*NB);
+   auto a = Reshape(A.HostWrite(), n, dim, dim, NB);
+   std::vector<DenseMatrix> Am(n*NB);
+   for (int m = 0; m < n*NB; m++)
+   {
+      DenseMatrix R(dim);
+      Vector(R.Data(), dim*dim).Randomize(m);
+      Am[m].SetSize(dim);
+      MultAAt(R, Am[m]);
+      for (int i = 0; i < dim; i++) { Am[m](i,i) += 1.0; }
+      if (dim > 3)
+      {
+         for (int j = 0; j < dim; j++) { std::swap(Am[m](0,j), Am[m](1,j)); }
+      }
+      for (int i = 0; i < dim; i++)
+      {
+         for (int j = 0; j < dim; j++) { a(m%n,i,j,m/n) = Am[m](i,j); }
+      }
+   }
+
+   Vector det, Ainv;
+   if (dim <= 3) { BatchDet(dim, n, A, det); }
+   BatchInverse(dim, n, A, Ainv);
+
+   const auto ai = Reshape(Ainv.HostRead(), n, dim, dim, NB);
+   for (int m = 0; m < n*NB; m++)
+   {
+      const int k = m % n, e = m / n;
+      if (dim <= 3)
+      {
+         REQUIRE(det.HostRead()[k + n*e] == MFEM_Approx(Am[m].Det()));
+      }
+
+      DenseMatrixInverse inv(Am[m]);
+      DenseMatrix Am_inv;
+      inv.GetInverseMatrix(Am_inv);
+      for (int i = 0; i < dim; i++)
+      {
+         for (int j = 0; j < dim; j++)
+         {
+            REQUIRE(ai(k,i,j,e) == MFEM_Approx(Am_inv(i,j)));
+         }
+      }
+   }
+}
+
 TEST_CASE("DenseTensor copy", "[DenseMatrix][DenseTensor]")
 {
    DenseTensor t1(2,3,4);
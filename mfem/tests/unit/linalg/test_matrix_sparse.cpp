@@ -77,4 +77,51 @@ TEST_CASE("SparseMatrixAbsMult", "[SparseMatrixAbsMult]")
    }
 }
 
+TEST_CASE("SparseRAP", "[SparseMatrix]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   mesh.EnsureNCMesh();
+   Array<int> refs({0, 5, 10});
+   mesh.GeneralRefinement(refs);
+
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   const SparseMatrix &P = *fes.GetConformingProlongation();
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator);
+   a.AddDomainIntegrator(new MassIntegrator);
+   a.Assemble();
+   a.Finalize();
+   SparseMatrix &A = a.SpMat();
+
+   SparseRAP rap(P, A, P);
+   REQUIRE(rap.HasStructure(P, A, P));
+   REQUIRE(!rap.HasStructure(P, P, P));
+
+   Vector x(P.Width()), y1(P.Width()), y2(P.Width());
+   x.Randomize(1);
+   for (int it = 0; it < 2; it++)
+   {
+      // change the values of A, keeping its pattern
+      if (it == 1)
+      {
+         double *data = A.GetData();
+         for (int k = 0; k < A.NumNonZeroElems(); k++) { data[k] *= 1.0 + k%3; }
+      }
+
+      SparseMatrix *C1 = rap.Mult(A);
+      SparseMatrix *C2 = RAP(P, A, P);
+      REQUIRE(C1->NumNonZeroElems() == C2->NumNonZeroElems());
+
+      C1->Mult(x, y1);
+      C2->Mult(x, y2);
+      y1 -= y2;
+      REQUIRE(y1.Normlinf() == MFEM_Approx(0.0));
+
+      delete C1;
+      delete C2;
+   }
+}
+
 } // namespace mfem
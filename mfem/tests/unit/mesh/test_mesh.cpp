@@ -180,3 +180,83 @@ TEST_CASE("MakeSimplicial", "[Mesh]")
    // on the original mesh, but it doesn't happen for these test cases.
    REQUIRE(simplex_mesh.GetNE() == orig_mesh.GetNE()*factor);
 }
+
+TEST_CASE("FindPoints", "[Mesh]")
+{
+   const int dim = GENERATE(1, 2, 3);
+   const bool simplex = GENERATE(false, true);
+
+   Mesh mesh = dim == 1 ? Mesh::MakeCartesian1D(16) :
+               dim == 2 ? Mesh::MakeCartesian2D(
+                  8, 8, simplex ? Element::TRIANGLE : Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(
+                  4, 4, 4, simplex ? Element::TETRAHEDRON : Element::HEXAHEDRON);
+
+   const int npts = 100;
+   DenseMatrix points(dim, npts);
+   {
+      Vector p(points.GetData(), dim*npts);
+      p.Randomize(17);
+   }
+
+   auto check_points = [&](const Vector &shift)
+   {
+      DenseMatrix pts(points);
+      for (int k = 0; k < npts; k++)
+      {
+         for (int d = 0; d < dim; d++) { pts(d,k) += shift(d); }
+      }
+      Array<int> elem_ids;
+      Array<IntegrationPoint> ips;
+      REQUIRE(mesh.FindPoints(pts, elem_ids, ips) == npts);
+      Vector x(dim);
+      for (int k = 0; k < npts; k++)
+      {
+         REQUIRE(elem_ids[k] >= 0);
+         mesh.GetElementTransformation(elem_ids[k])->Transform(ips[k], x);
+         for (int d = 0; d < dim; d++)
+         {
+            REQUIRE(x(d) == MFEM_Approx(pts(d,k)));
+         }
+      }
+   };
+
+   Vector shift(dim);
+   shift = 0.0;
+   check_points(shift);
+
+   // Points outside of the mesh are not found
+   {
+      DenseMatrix outside(dim, 1);
+      outside = 2.0;
+      Array<int> elem_ids;
+      Array<IntegrationPoint> ips;
+      REQUIRE(mesh.FindPoints(outside, elem_ids, ips, false) == 0);
+      REQUIRE(elem_ids[0] == -1);
+   }
+
+   // Moving the mesh invalidates the element center tree
+   const int nv = mesh.GetNV();
+   Vector displacements(dim*nv);
+   displacements = 0.0;
+   for (int i = 0; i < nv; i++) { displacements(i) = 1.5; }
+   mesh.MoveVertices(displacements);
+   shift(0) = 1.5;
+   check_points(shift);
+
+   // So does refinement
+   mesh.UniformRefinement();
+   check_points(shift);
+
+   // And changes of the nodes reported through NodesUpdated()
+   mesh.EnsureNodes();
+   GridFunction &nodes = *mesh.GetNodes();
+   const FiniteElementSpace &nfes = *nodes.FESpace();
+   for (int i = 0; i < nfes.GetNDofs(); i++)
+   {
+      nodes(nfes.DofToVDof(i, 0)) -= 1.5;
+   }
+   mesh.NodesUpdated();
+   shift(0) = 0.0;
+   check_points(shift);
+}